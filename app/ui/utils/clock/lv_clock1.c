@@ -26,10 +26,12 @@ lv_obj_t * init_clock1_obj(lv_obj_t* parent,lv_clock_t *lv_clock){
 
     lv_clock->hour_img = lv_img_create(lv_clock->dial_img);
     lv_img_set_src(lv_clock->hour_img, GET_IMAGE_PATH("icon_time1_h.png"));
+    lv_img_set_transform_cache(lv_clock->hour_img, true);
     lv_obj_align(lv_clock->hour_img,  LV_ALIGN_CENTER, 0, 0);
 
     lv_clock->minute_img = lv_img_create(lv_clock->dial_img);
     lv_img_set_src(lv_clock->minute_img, GET_IMAGE_PATH("icon_time1_m.png"));
+    lv_img_set_transform_cache(lv_clock->minute_img, true);
     lv_obj_align(lv_clock->minute_img,  LV_ALIGN_CENTER, 0, 0);
 
     lv_clock->sec_img = lv_img_create(lv_clock->dial_img);
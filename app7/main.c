@@ -9,9 +9,14 @@
 #include "net/http_manager.h"
 #include "wifi/wpa_manager.h"
 #include "ui_msg.h"  // 引入UI消息队列
+#include "ui_loop.h" // 引入事件驱动主循环
+#include "mem_track.h" // 内存分配统计
+#include "img_pack.h"  // 预解码图片包
+#include "image_conf.h"
 
 extern void lv_port_disp_init(bool is_disp_orientation);
 extern void lv_port_indev_init(void);
+extern int lv_port_indev_get_fd(void);
 
 // pageStart的天气数据回调函数
 extern void pageStart_weather_callback(weather_data_t *data);
@@ -33,6 +38,10 @@ int main() {
     lv_port_indev_init();
     //初始化字体库（注册外部.OTF字体文件路径）
     FONT_INIT();
+    //打开预解码图片包，res/image下的图片直接从包里显示（没有包时照常解码PNG）
+    img_pack_open(IMAGE_PACK_FILE, GET_IMAGE_PATH(""));
+    //返回按钮每个子页面都有，常驻图片缓存
+    lv_img_cache_pin(GET_IMAGE_PATH("main/back.png"));
 
     //lv_example_hello_world();//执行功能函数
 
@@ -47,6 +56,17 @@ int main() {
         return -1;
     }
     
+    /* ========== 初始化主循环（epoll等待LVGL定时器/消息/触摸输入） ========== */
+    if (ui_loop_init() != 0) {
+        printf("❌ Failed to initialize UI loop!\n");
+        return -1;
+    }
+    // 触摸屏有输入时立即唤醒；模拟器没有fd，保持周期读取
+    ui_loop_add_indev(lv_indev_get_next(NULL), lv_port_indev_get_fd());
+    
+    /* ========== 内存统计：每10分钟写一次快照，用 mem_track_diff 对比找出增长 ========== */
+    mem_track_start("/usr/data/mem_track.bin", 10 * 60 * 1000);
+    
     /* ========== 先初始化界面（避免阻塞） ========== */
     init_pageStart();
     
@@ -87,20 +107,8 @@ int main() {
    
     /* ========== 主循环（UI线程） ========== */
     printf("🚀 Entering main loop (UI thread)...\n\n");
-    ui_msg_t msg;
-    
-    while (1) {
-        // 1. 处理LVGL任务
-        lv_task_handler();
-        
-        // 2. 处理UI消息队列（非阻塞）
-        //    ⚠️ 这是唯一操作LVGL的地方（主线程）
-        while (ui_msg_recv(&msg) == 0) {
-            ui_msg_handle(&msg);
-        }
-        
-        // 3. 延时，保证cpu占有率不会过高
-        usleep(1000);
-    }
+    // 空闲时阻塞在epoll上，直到LVGL定时器到期、收到UI消息或有触摸输入
+    // ⚠️ UI消息在主线程中处理，这是唯一操作LVGL的地方
+    ui_loop_run(ui_msg_process);
     return 0;
 }
\ No newline at end of file
@@ -19,6 +19,7 @@
 #include "http_manager.h"
 #include "osal_thread.h"
 #include "osal_queue.h"
+#include "mem_track.h"
 
 #ifndef __linux__
 #include "wifi/wpa_manager.h"  // T113环境需要WiFi检测
@@ -52,7 +53,7 @@ static pending_request_t g_pending_request = {
  */
 static int assemble_url(const char *host, const char *path, char **url)
 {
-    *url = malloc(strlen(host) + strlen(path) + 1);
+    *url = mem_track_malloc(MEM_TAG_NET, strlen(host) + strlen(path) + 1);
     strcpy(*url, host);
     strcat(*url, path);
     return 0;
@@ -66,7 +67,7 @@ static size_t write_callback(void *data, size_t size, size_t nmemb, void *userp)
     size_t realsize = size * nmemb;
     http_resp_data_t *mem = (http_resp_data_t *)userp;
 
-    char *ptr = realloc(mem->data, mem->size + realsize + 1);
+    char *ptr = mem_track_realloc(MEM_TAG_NET, mem->data, mem->size + realsize + 1);
     if (!ptr) return 0; // 内存分配失败
 
     mem->data = ptr;
@@ -76,6 +77,10 @@ static size_t write_callback(void *data, size_t size, size_t nmemb, void *userp)
     return realsize;
 }
 
+/**
+ * @brief 发送HTTP请求
+ * @note 成功时 *response_json 由 mem_track_malloc 分配，调用者用 mem_track_free 释放
+ */
 int http_request_method(const char *host, const char *path,  const char *method, const char *request_json, char **response_json)
 {
     CURL *curl = curl_easy_init();
@@ -116,11 +121,11 @@ int http_request_method(const char *host, const char *path,  const char *method,
     else
     {
         printf("Request failed: %s (%d)\n", curl_easy_strerror(code), code);
-        free(response_data.data); // 失败时释放内存
+        mem_track_free(response_data.data); // 失败时释放内存
     }
     // 资源清理
     curl_slist_free_all(header);
-    free(url);
+    mem_track_free(url);
     curl_easy_cleanup(curl);
     return ret;
 }
@@ -283,7 +288,7 @@ static void network_monitor_timer_cb(lv_timer_t * timer)
         case NET_GET_WEATHER:
             // 重新发送天气请求（不再检测网络，直接发送）
             {
-                net_obj *obj = (net_obj *)malloc(sizeof(net_obj));
+                net_obj *obj = (net_obj *)mem_track_malloc(MEM_TAG_NET, sizeof(net_obj));
                 if (obj != NULL) {
                     obj->id = NET_GET_WEATHER;
                     strcpy(obj->host, "https://api.seniverse.com");
@@ -309,7 +314,7 @@ static void network_monitor_timer_cb(lv_timer_t * timer)
                             printf("⏹️  Network monitor stopped\n");
                         }
                     }
-                    free(obj);
+                    mem_track_free(obj);
                 }
             }
             break;
@@ -371,7 +376,7 @@ static void* net_thread_fun(void *arg)
                     int http_ret = http_request_method(obj.host,obj.path,obj.type,obj.data,&response_json_str);
                     if (http_ret == 0 && response_json_str != NULL){
                         parseWeatherData(response_json_str);
-                        free(response_json_str);
+                        mem_track_free(response_json_str);
                         response_json_str = NULL;
                     } else {
                         printf("❌ Weather request failed (ret=%d), skipping parse\n", http_ret);
@@ -2,11 +2,53 @@
 #include <string.h>
 #include "lvgl.h"
 #include "page_conf.h"
+#include "image_conf.h"
 //图标大小110*110
 /* ========== 全局变量 ========== */
 // 通用样式
 static lv_style_t com_style;
 
+/* ========== 图片（页面和预取资源共用） ========== */
+#define IMG_MENU_BLUETOOTH   GET_IMAGE_PATH("menu/menu_bluetooth.png")
+#define IMG_MENU_WIFI        GET_IMAGE_PATH("menu/menu_wifi1.png")
+#define IMG_MENU_SETTING     GET_IMAGE_PATH("menu/menu_setting.png")
+#define IMG_MENU_CLOCK       GET_IMAGE_PATH("menu/menu_clock.png")
+#define IMG_MENU_CALENDAR    GET_IMAGE_PATH("menu/menu_calendar.png")
+#define IMG_MENU_RADIO       GET_IMAGE_PATH("menu/menu_radio.png")
+#define IMG_MENU_MUSIC       GET_IMAGE_PATH("menu/menu_music.png")
+#define IMG_MENU_PHOTO       GET_IMAGE_PATH("menu/menu_photo.png")
+#define IMG_MENU_INFORMATION GET_IMAGE_PATH("menu/menu_information.png")
+#define IMG_MENU_GAME        GET_IMAGE_PATH("menu/menu_game.png")
+#define IMG_MENU_NOTEBOOK    GET_IMAGE_PATH("menu/menu_notebook.png")
+
+/* ========== 预取资源 ========== */
+static const char *const page_imgs[] = {
+    IMG_MENU_BLUETOOTH,
+    IMG_MENU_WIFI,
+    IMG_MENU_SETTING,
+    IMG_MENU_CLOCK,
+    IMG_MENU_CALENDAR,
+    IMG_MENU_RADIO,
+    IMG_MENU_MUSIC,
+    IMG_MENU_PHOTO,
+    IMG_MENU_INFORMATION,
+    IMG_MENU_GAME,
+    IMG_MENU_NOTEBOOK,
+    NULL
+};
+// 按菜单顺序，右滑返回的启动页面放在最后
+static const page_assets_t *const next_pages[] = {
+    &page_assets_wifi,
+    &page_assets_setting,
+    &page_assets_clock,
+    &page_assets_music,
+    &page_assets_information,
+    &page_assets_notebook,
+    &page_assets_start,
+    NULL
+};
+const page_assets_t page_assets_menu = {"Menu", page_imgs, NULL, next_pages};
+
 // 前向声明
 static void swipe_event_cb(lv_event_t * e);
 
@@ -204,42 +246,42 @@ static lv_obj_t * init_menu_list(lv_obj_t *parent)
     lv_obj_set_style_border_width(cont, 0, LV_PART_MAIN);
 
     // 初始化菜单 - 蓝牙设置
-    init_item(cont, "A:res/image/menu/menu_bluetooth.png", "Bluetooth");
+    init_item(cont, IMG_MENU_BLUETOOTH, "Bluetooth");
     
     // 初始化菜单 - WiFi设置
-    init_item(cont, "A:res/image/menu/menu_wifi1.png", "WiFi");
+    init_item(cont, IMG_MENU_WIFI, "WiFi");
     
     // 初始化菜单 - 设置
-    init_item(cont, "A:res/image/menu/menu_setting.png", "Setting");
+    init_item(cont, IMG_MENU_SETTING, "Setting");
     
     // 初始化菜单 - 闹钟
-    init_item(cont, "A:res/image/menu/menu_clock.png", "Clock");
+    init_item(cont, IMG_MENU_CLOCK, "Clock");
     
     // 初始化菜单 - 日历
-    init_item(cont, "A:res/image/menu/menu_calendar.png", "Calendar");
+    init_item(cont, IMG_MENU_CALENDAR, "Calendar");
     
     // 初始化菜单 - 收音机
-    init_item(cont, "A:res/image/menu/menu_radio.png", "Radio");
+    init_item(cont, IMG_MENU_RADIO, "Radio");
     
     // 初始化菜单 - 音乐播放器
-    init_item(cont, "A:res/image/menu/menu_music.png", "Music");
+    init_item(cont, IMG_MENU_MUSIC, "Music");
     
  
     // 初始化菜单 - 相册
-    init_item(cont, "A:res/image/menu/menu_photo.png", "Photo");
+    init_item(cont, IMG_MENU_PHOTO, "Photo");
     
     // 初始化菜单 - 信息
-    init_item(cont, "A:res/image/menu/menu_information.png", "Information");
+    init_item(cont, IMG_MENU_INFORMATION, "Information");
 
     // 初始化菜单 - 游戏
-    init_item(cont, "A:res/image/menu/menu_game.png", "Game");
+    init_item(cont, IMG_MENU_GAME, "Game");
     
     // 初始化菜单 - 记事本
-    init_item(cont, "A:res/image/menu/menu_notebook.png", "Notebook");
+    init_item(cont, IMG_MENU_NOTEBOOK, "Notebook");
     
     
     // TODO: 后续添加更多菜单项
-    // init_item(cont, "A:res/image/menu/xxx.png", "菜单名称");
+    // init_item(cont, GET_IMAGE_PATH("menu/xxx.png"), "菜单名称");
     
     return cont;
 }
@@ -265,6 +307,9 @@ static void init_common_style(void)
  */
 void init_pageMenu(void)
 {
+    page_prefetch_enter(&page_assets_menu);
+    page_build_begin();
+
     // 设置屏幕背景颜色为白色
     lv_obj_set_style_bg_color(lv_scr_act(), lv_color_hex(0xFFFFFF), LV_PART_MAIN);
     
@@ -277,4 +322,5 @@ void init_pageMenu(void)
     // 添加滑动手势检测
     lv_obj_add_event_cb(lv_scr_act(), swipe_event_cb, LV_EVENT_GESTURE, NULL);
     lv_obj_clear_flag(lv_scr_act(), LV_OBJ_FLAG_GESTURE_BUBBLE);
+    page_build_end();
 }
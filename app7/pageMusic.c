@@ -32,6 +32,33 @@ static lv_timer_t * update_timer = NULL;     // 进度更新定时器
 /* ========== 当前播放的音频索引 ========== */
 static int current_track = 0;  // 0: audio_start, 1: audio_warn2
 
+/* ========== 图片和文字（页面和预取资源共用） ========== */
+#define IMG_BACK            GET_IMAGE_PATH("main/back.png")
+#define IMG_LEFT            GET_IMAGE_PATH("music/music_left.png")
+#define IMG_PAUSE           GET_IMAGE_PATH("music/music_pause.png")
+#define IMG_RIGHT           GET_IMAGE_PATH("music/music_right.png")
+#define IMG_START           GET_IMAGE_PATH("music/music_start.png")
+
+#define TEXT_TITLE          "音乐播放"
+#define TEXT_SONG_UNKNOWN   "未知歌曲"
+#define TEXT_SONG_START     "启动音效"
+#define TEXT_SONG_WARN      "警告音效"
+#define TEXT_ARTIST_UNKNOWN "未知艺术家"
+#define TEXT_ARTIST_SYSTEM  "系统音频"
+#define TEXT_TIME_CHARS     "0123456789:"   // 播放时间 mm:ss 用到的字符
+
+/* ========== 预取资源 ========== */
+static const char *const page_imgs[] = {IMG_BACK, IMG_LEFT, IMG_PAUSE, IMG_RIGHT, IMG_START, NULL};
+static const page_font_t page_fonts[] = {
+    {FONT_TYPE_CN, 24, TEXT_TITLE},
+    {FONT_TYPE_CN, 18, TEXT_SONG_UNKNOWN TEXT_SONG_START TEXT_SONG_WARN},
+    {FONT_TYPE_CN, 16, TEXT_ARTIST_UNKNOWN TEXT_ARTIST_SYSTEM},
+    {FONT_TYPE_CN, 12, TEXT_TIME_CHARS},
+    {0}
+};
+static const page_assets_t *const next_pages[] = {&page_assets_menu, NULL};
+const page_assets_t page_assets_music = {"Music", page_imgs, page_fonts, next_pages};
+
 /* ========== 函数前向声明 ========== */
 static lv_obj_t * create_control_btn(lv_obj_t *parent, const char *img_path, int size);
 static void update_song_info(void);
@@ -112,14 +139,14 @@ static void update_song_info(void)
 {
     if(song_title_label != NULL) {
         if(current_track == 0) {
-            lv_label_set_text(song_title_label, "启动音效");
+            lv_label_set_text(song_title_label, TEXT_SONG_START);
         } else {
-            lv_label_set_text(song_title_label, "警告音效");
+            lv_label_set_text(song_title_label, TEXT_SONG_WARN);
         }
     }
     
     if(artist_label != NULL) {
-        lv_label_set_text(artist_label, "系统音频");
+        lv_label_set_text(artist_label, TEXT_ARTIST_SYSTEM);
     }
 }
 
@@ -144,12 +171,12 @@ static void play_btn_click_event_cb(lv_event_t * e)
     is_playing = !is_playing;
     
     if(is_playing) {
-        lv_img_set_src(img, GET_IMAGE_PATH("music/music_start.png"));
+        lv_img_set_src(img, IMG_START);
         printf("Music: Playing\n");
         
         play_current_track();
     } else {
-        lv_img_set_src(img, GET_IMAGE_PATH("music/music_pause.png"));
+        lv_img_set_src(img, IMG_PAUSE);
         printf("Music: Paused\n");
         
         // 停止播放（通过播放空音频实现暂停效果）
@@ -206,7 +233,7 @@ static lv_obj_t * init_title_view(lv_obj_t *parent)
 
     // 返回图标
     lv_obj_t *back_img = lv_img_create(cont);
-    lv_img_set_src(back_img, GET_IMAGE_PATH("main/back.png"));
+    lv_img_set_src(back_img, IMG_BACK);
     lv_obj_set_align(back_img, LV_ALIGN_TOP_LEFT);
     lv_obj_set_style_pad_left(back_img, 20, LV_PART_MAIN);
     lv_obj_set_style_pad_top(back_img, 20, LV_PART_MAIN);
@@ -218,7 +245,7 @@ static lv_obj_t * init_title_view(lv_obj_t *parent)
     // 标题文字
     lv_obj_t *title = lv_label_create(cont);
     obj_font_set(title, FONT_TYPE_CN, 24);
-    lv_label_set_text(title, "音乐播放");
+    lv_label_set_text(title, TEXT_TITLE);
     lv_obj_set_style_text_color(title, lv_color_hex(0xffffff), 0);
     lv_obj_align_to(title, back_img, LV_ALIGN_OUT_RIGHT_MID, 15, 0);
     
@@ -270,7 +297,7 @@ static lv_obj_t * init_song_info_view(lv_obj_t *parent)
     // 歌曲标题
     song_title_label = lv_label_create(cont);
     obj_font_set(song_title_label, FONT_TYPE_CN, 18);
-    lv_label_set_text(song_title_label, "未知歌曲");
+    lv_label_set_text(song_title_label, TEXT_SONG_UNKNOWN);
     lv_obj_set_style_text_color(song_title_label, lv_color_hex(0xffffff), LV_PART_MAIN);
     lv_label_set_long_mode(song_title_label, LV_LABEL_LONG_SCROLL_CIRCULAR);
     lv_obj_set_width(song_title_label, 420);
@@ -279,7 +306,7 @@ static lv_obj_t * init_song_info_view(lv_obj_t *parent)
     // 艺术家名称
     artist_label = lv_label_create(cont);
     obj_font_set(artist_label, FONT_TYPE_CN, 16);
-    lv_label_set_text(artist_label, "未知艺术家");
+    lv_label_set_text(artist_label, TEXT_ARTIST_UNKNOWN);
     lv_obj_set_style_text_color(artist_label, lv_color_hex(0x888888), LV_PART_MAIN);
     lv_obj_set_style_text_align(artist_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
     
@@ -324,19 +351,19 @@ static lv_obj_t * init_progress_view(lv_obj_t *parent)
     
     // ===== 控制按钮区域(在进度条下方)=====
     // 上一曲按钮(32x32图标)
-    prev_btn = create_control_btn(cont, GET_IMAGE_PATH("music/music_left.png"), 40);
+    prev_btn = create_control_btn(cont, IMG_LEFT, 40);
     lv_obj_t * prev_img = lv_obj_get_child(prev_btn, 0);
     lv_img_set_angle(prev_img, 1800);  // 旋转108度(LVGL使用0.1度为单位)
     lv_obj_align_to(prev_btn, progress_bar, LV_ALIGN_OUT_BOTTOM_MID, -60, 25);
     lv_obj_add_event_cb(prev_btn, prev_btn_click_event_cb, LV_EVENT_CLICKED, NULL);
     
     // 播放/暂停按钮（32x32图标）
-    play_btn = create_control_btn(cont, GET_IMAGE_PATH("music/music_pause.png"), 50);
+    play_btn = create_control_btn(cont, IMG_PAUSE, 50);
     lv_obj_align_to(play_btn, progress_bar, LV_ALIGN_OUT_BOTTOM_MID, 0, 20);
     lv_obj_add_event_cb(play_btn, play_btn_click_event_cb, LV_EVENT_CLICKED, NULL);
     
     // 下一曲按钮（32x32图标）
-    next_btn = create_control_btn(cont, GET_IMAGE_PATH("music/music_right.png"), 40);
+    next_btn = create_control_btn(cont, IMG_RIGHT, 40);
     lv_obj_align_to(next_btn, progress_bar, LV_ALIGN_OUT_BOTTOM_MID, 60, 25);
     lv_obj_add_event_cb(next_btn, next_btn_click_event_cb, LV_EVENT_CLICKED, NULL);
     
@@ -378,17 +405,17 @@ static lv_obj_t * init_control_view(lv_obj_t *parent)
     lv_obj_set_style_pad_ver(cont, 5, LV_PART_MAIN);
     
     // 上一曲按钮（32x32图标，按钮稍大一点方便点击）
-    prev_btn = create_control_btn(cont, GET_IMAGE_PATH("music/music_left.png"), 45);
+    prev_btn = create_control_btn(cont, IMG_LEFT, 45);
     lv_obj_add_event_cb(prev_btn, prev_btn_click_event_cb, LV_EVENT_CLICKED, NULL);
     
     // 播放/暂停按钮（32x32图标）
-    play_btn = create_control_btn(cont, GET_IMAGE_PATH("music/music_pause.png"), 55);
+    play_btn = create_control_btn(cont, IMG_PAUSE, 55);
     lv_obj_set_style_bg_color(play_btn, lv_color_hex(0x1F94D2), LV_PART_MAIN);
     lv_obj_set_style_bg_opa(play_btn, LV_OPA_COVER, LV_PART_MAIN);
     lv_obj_add_event_cb(play_btn, play_btn_click_event_cb, LV_EVENT_CLICKED, NULL);
     
     // 下一曲按钮（32x32图标）
-    next_btn = create_control_btn(cont, GET_IMAGE_PATH("music/music_right.png"), 45);
+    next_btn = create_control_btn(cont, IMG_RIGHT, 45);
     lv_obj_add_event_cb(next_btn, next_btn_click_event_cb, LV_EVENT_CLICKED, NULL);
     
     return cont;
@@ -397,6 +424,9 @@ static lv_obj_t * init_control_view(lv_obj_t *parent)
 /* ========== 初始化音乐播放器页面 ========== */
 void init_pageMusic(void)
 {
+    page_prefetch_enter(&page_assets_music);
+    page_build_begin();
+
     printf("Initializing pageMusic...\n");
     
     // 初始化音频播放器（如果尚未初始化）
@@ -441,4 +471,5 @@ void init_pageMusic(void)
     update_song_info();
     
     printf("pageMusic initialized successfully\n");
+    page_build_end();
 }
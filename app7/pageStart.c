@@ -59,6 +59,53 @@ static struct {
     .initialized = false
 };
 
+/* ========== 图片和文字（页面和预取资源共用） ========== */
+#define IMG_AVATAR              GET_IMAGE_PATH("start/watch1.png")
+#define IMG_WEATHER_CLOUDY      GET_IMAGE_PATH("start/weather_cloudy.png")
+#define IMG_WEATHER_SMALLRAIN   GET_IMAGE_PATH("start/weather_smallrain.png")
+#define IMG_WEATHER_HEAVYRAIN   GET_IMAGE_PATH("start/weather_heavyrain.png")
+#define IMG_WEATHER_SNOW        GET_IMAGE_PATH("start/weather_snow.png")
+#define IMG_WEATHER_THUNDER     GET_IMAGE_PATH("start/weather_thunder.png")
+#define IMG_WEATHER_FOG         GET_IMAGE_PATH("start/weather_fog.png")
+
+#define TEXT_SUN                "周日"
+#define TEXT_MON                "周一"
+#define TEXT_TUE                "周二"
+#define TEXT_WED                "周三"
+#define TEXT_THU                "周四"
+#define TEXT_FRI                "周五"
+#define TEXT_SAT                "周六"
+#define TEXT_FOG                "雾"
+#define TEXT_SUNNY              "晴"
+#define TEXT_CLOUDY             "多云"
+#define TEXT_RAIN               "雨"
+#define TEXT_SNOW               "雪"
+#define TEXT_OVERCAST           "阴"
+#define TEXT_CITY_DEFAULT       "北京"
+#define TEXT_TEMP_UNIT          "°C"
+#define TEXT_DIGITS             "0123456789"
+#define TEXT_TIME_CHARS         TEXT_DIGITS ":-/"   // 时间、日期用到的字符
+
+static const char *const weekday_names[] = {TEXT_SUN, TEXT_MON, TEXT_TUE, TEXT_WED, TEXT_THU, TEXT_FRI, TEXT_SAT};
+// 测试用随机天气
+static const char *const weather_states[] = {TEXT_FOG, TEXT_SUNNY, TEXT_CLOUDY, TEXT_RAIN, TEXT_SNOW, TEXT_OVERCAST};
+
+/* ========== 预取资源 ========== */
+static const char *const page_imgs[] = {
+    IMG_AVATAR,
+    IMG_WEATHER_CLOUDY,     // 默认天气图标
+    NULL
+};
+static const page_font_t page_fonts[] = {
+    {FONT_TYPE_NUMBER, 20, TEXT_TIME_CHARS},
+    {FONT_TYPE_CN, 20, TEXT_SUN TEXT_MON TEXT_TUE TEXT_WED TEXT_THU TEXT_FRI TEXT_SAT
+                       TEXT_FOG TEXT_SUNNY TEXT_CLOUDY TEXT_RAIN TEXT_SNOW TEXT_OVERCAST
+                       TEXT_CITY_DEFAULT TEXT_TEMP_UNIT TEXT_DIGITS},
+    {0}
+};
+static const page_assets_t *const next_pages[] = {&page_assets_menu, NULL};
+const page_assets_t page_assets_start = {"Start", page_imgs, page_fonts, next_pages};
+
 // 前向声明
 static void swipe_event_cb(lv_event_t * e);
 
@@ -86,41 +133,41 @@ static const char* get_weather_icon(const char *code) {
     switch(code_int) {
         case 0:  // 晴（白天）
         case 1:  // 晴（夜间）
-            return "A:res/image/start/weather_cloudy.png";  // 晴天（暂用weather_cloudy.png）
+            return IMG_WEATHER_CLOUDY;  // 晴天（暂用weather_cloudy.png）
             
         case 4:  // 多云
         case 5:  // 多云转阴
-            return "A:res/image/start/weather_cloudy.png";
+            return IMG_WEATHER_CLOUDY;
             
         case 9:  // 阴天
-            return "A:res/image/start/weather_cloudy.png";
+            return IMG_WEATHER_CLOUDY;
             
         case 10: // 阵雨
         case 13: // 小雨
-            return "A:res/image/start/weather_smallrain.png";
+            return IMG_WEATHER_SMALLRAIN;
             
         case 14: // 中雨
         case 15: // 大雨
         case 16: // 暴雨
         case 17: // 大暴雨
         case 18: // 特大暴雨
-            return "A:res/image/start/weather_heavyrain.png";
+            return IMG_WEATHER_HEAVYRAIN;
             
         case 19: // 冰雹
-            return "A:res/image/start/weather_heavyrain.png";
+            return IMG_WEATHER_HEAVYRAIN;
             
         case 20: // 雨夹雪
-            return "A:res/image/start/weather_snow.png";
+            return IMG_WEATHER_SNOW;
             
         case 21: // 雷阵雨
         case 22: // 雷阵雨伴有冰雹
-            return "A:res/image/start/weather_thunder.png";
+            return IMG_WEATHER_THUNDER;
             
         case 26: // 小雪
         case 27: // 中雪
         case 28: // 大雪
         case 29: // 暴雪
-            return "A:res/image/start/weather_snow.png";
+            return IMG_WEATHER_SNOW;
             
         case 30: // 雾
         case 31: // 霾
@@ -130,10 +177,10 @@ static const char* get_weather_icon(const char *code) {
         case 35: // 大雾
         case 49: // 浓雾
         case 53: // 霾
-            return "A:res/image/start/weather_fog.png";
+            return IMG_WEATHER_FOG;
             
         default:
-            return "A:res/image/start/weather_cloudy.png";  // 默认多云图标
+            return IMG_WEATHER_CLOUDY;  // 默认多云图标
     }
 }
 
@@ -236,7 +283,6 @@ static void update_weather_ui(ui_weather_data_t *weather) {
     
     // 更新星期
     if(label_week != NULL) {
-        const char *weekday_names[] = {"周日", "周一", "周二", "周三", "周四", "周五", "周六"};
         if(g_weather_state.weekday >= 0 && g_weather_state.weekday <= 6) {
             lv_label_set_text(label_week, weekday_names[g_weather_state.weekday]);
             printf("✅ 星期标签已更新: %s\n", weekday_names[g_weather_state.weekday]);
@@ -252,7 +298,7 @@ static void update_weather_ui(ui_weather_data_t *weather) {
     // 更新天气状态和温度
     if(label_weather != NULL) {
         char weather_display[64];
-        snprintf(weather_display, sizeof(weather_display), "%s %s°C", 
+        snprintf(weather_display, sizeof(weather_display), "%s %s" TEXT_TEMP_UNIT, 
                  g_weather_state.weather, g_weather_state.temperature);
         lv_label_set_text(label_weather, weather_display);
         printf("✅ 天气标签已更新: %s\n", weather_display);
@@ -414,6 +460,9 @@ static void time_update_timer_cb(lv_timer_t * timer)
  */
 void init_pageStart(void)
 {
+    page_prefetch_enter(&page_assets_start);
+    page_build_begin();
+
     /* ========== 0. 设置屏幕背景颜色 ========== */
     lv_obj_set_style_bg_color(lv_scr_act(), lv_color_hex(0x000000), LV_PART_MAIN);  // 黑色背景
     
@@ -430,7 +479,7 @@ void init_pageStart(void)
     // 创建头像图片对象（用户需自行添加图片路径）
     lv_obj_t * img_avatar = lv_img_create(avatar_container);
     // TODO: 用户添加头像图片路径，例如：
-    lv_img_set_src(img_avatar, "A:res/image/start/watch1.png");
+    lv_img_set_src(img_avatar, IMG_AVATAR);
     // 或使用图片数组：lv_img_set_src(img_avatar, &avatar_img);
     lv_obj_center(img_avatar);  // 头像居中
     
@@ -481,7 +530,6 @@ lv_obj_align(label_date, LV_ALIGN_TOP_RIGHT, -5, 130);
 label_week = lv_label_create(time_container);
 // 从缓存恢复星期，如果有的话
 if(g_weather_state.initialized && g_weather_state.weekday >= 0 && g_weather_state.weekday <= 6) {
-    const char *weekday_names[] = {"周日", "周一", "周二", "周三", "周四", "周五", "周六"};
     lv_label_set_text(label_week, weekday_names[g_weather_state.weekday]);
 } else {
     lv_label_set_text(label_week, "---");  // 等待API同步
@@ -508,7 +556,7 @@ if(g_weather_state.initialized && strlen(g_weather_state.weather_code) > 0) {
     const char *icon_path = get_weather_icon(g_weather_state.weather_code);
     lv_img_set_src(icon_label, icon_path);
 } else {
-    lv_img_set_src(icon_label, "A:res/image/start/weather_cloudy.png");  // 默认多云图标
+    lv_img_set_src(icon_label, IMG_WEATHER_CLOUDY);  // 默认多云图标
 }
 lv_obj_set_size(icon_label,36,36);  // 设置图标大小
 lv_obj_align(icon_label, LV_ALIGN_TOP_LEFT, 15, 90); 
@@ -519,7 +567,7 @@ label_city = lv_label_create(weather_container);
 if(strlen(g_weather_state.city) > 0) {
     lv_label_set_text(label_city, g_weather_state.city);
 } else {
-    lv_label_set_text(label_city, "北京");  // 默认占位符
+    lv_label_set_text(label_city, TEXT_CITY_DEFAULT);  // 默认占位符
 }
 obj_font_set(label_city, FONT_TYPE_CN, 20);  // 使用中文字体
 lv_obj_set_style_text_color(label_city, lv_color_hex(0xECF0F1), LV_PART_MAIN);
@@ -530,15 +578,14 @@ label_weather = lv_label_create(weather_container);
 // 从缓存恢复天气数据，如果有的话
 if(g_weather_state.initialized && strlen(g_weather_state.weather) > 0) {
     char weather_display[64];
-    snprintf(weather_display, sizeof(weather_display), "%s %s°C", 
+    snprintf(weather_display, sizeof(weather_display), "%s %s" TEXT_TEMP_UNIT, 
              g_weather_state.weather, g_weather_state.temperature);
     lv_label_set_text(label_weather, weather_display);
 } else {
     // 测试用随机天气（仅首次显示）
-    const char * weather_states[] = {"雾", "晴", "多云", "雨", "雪", "阴"};
     int random_index = lv_rand(0, 5);
     int random_temp  = lv_rand(15, 30);
-    lv_label_set_text_fmt(label_weather, "%s %d°C",
+    lv_label_set_text_fmt(label_weather, "%s %d" TEXT_TEMP_UNIT,
                           weather_states[random_index], random_temp);
 }
 obj_font_set(label_weather, FONT_TYPE_CN, 20);  // 使用中文字体
@@ -550,11 +597,10 @@ lv_obj_align(label_city, LV_ALIGN_TOP_LEFT,5,140);
 label_weather = lv_label_create(weather_container);
 
 // 测试用随机天气
-const char * weather_states[] = {"雾", "晴", "多云", "雨", "雪", "阴"};
 int random_index = lv_rand(0, 5);
 int random_temp  = lv_rand(15, 30);
 
-lv_label_set_text_fmt(label_weather, "%s %d°C",
+lv_label_set_text_fmt(label_weather, "%s %d" TEXT_TEMP_UNIT,
                       weather_states[random_index], random_temp);
 
 obj_font_set(label_weather, FONT_TYPE_CN, 20);  // 使用中文字体
@@ -596,5 +642,6 @@ lv_obj_align(label_weather, LV_ALIGN_TOP_LEFT,5,160);
     /* ========== 6. 添加滑动手势检测 ========== */
     lv_obj_add_event_cb(lv_scr_act(), swipe_event_cb, LV_EVENT_GESTURE, NULL);
     lv_obj_clear_flag(lv_scr_act(), LV_OBJ_FLAG_GESTURE_BUBBLE);
+    page_build_end();
 }
 
@@ -14,6 +14,83 @@ static lv_obj_t * keyboard = NULL;      // 键盘对象
 static lv_obj_t * label_status = NULL;  // 状态提示标签
 static lv_obj_t * scan_list = NULL;     // WiFi扫描结果列表
 
+/* ========== 图片（页面和预取资源共用） ========== */
+#define IMG_BACK            GET_IMAGE_PATH("main/back.png")
+
+/* ========== 预取资源 ========== */
+static const char *const page_imgs[] = {IMG_BACK, NULL};
+static const page_assets_t *const next_pages[] = {&page_assets_menu, NULL};
+const page_assets_t page_assets_wifi = {"WiFi", page_imgs, NULL, next_pages};
+
+/* ========== 样式设置 ========== */
+/* 页面控件使用 lv_style_get_shared() 获取的共享样式：
+ * 属性相同的控件共用一份样式，页面反复进入时也不会重复分配。
+ * 运行中会改变的属性（如状态标签颜色）仍使用本地样式。 */
+
+/**
+ * @brief 设置文字颜色
+ */
+static void obj_text_color_set(lv_obj_t *obj, uint32_t color)
+{
+    lv_obj_add_style(obj, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_TEXT_COLOR(lv_color_hex(color)),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
+}
+
+/**
+ * @brief 设置卡片容器样式：白色背景、圆角10、1像素灰色边框
+ * @param pad 内边距
+ */
+static void card_style_set(lv_obj_t *obj, lv_coord_t pad)
+{
+    lv_obj_add_style(obj, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BG_COLOR(lv_color_hex(0xFFFFFF)),
+        LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+        LV_STYLE_CONST_RADIUS(10),
+        LV_STYLE_CONST_BORDER_WIDTH(1),
+        LV_STYLE_CONST_BORDER_COLOR(lv_color_hex(0xCCCCCC)),
+        LV_STYLE_CONST_PAD_TOP(pad),
+        LV_STYLE_CONST_PAD_BOTTOM(pad),
+        LV_STYLE_CONST_PAD_LEFT(pad),
+        LV_STYLE_CONST_PAD_RIGHT(pad),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
+}
+
+/**
+ * @brief 设置输入框样式：浅灰背景、2像素边框，获得焦点时边框变蓝
+ */
+static void ta_style_set(lv_obj_t *ta)
+{
+    lv_obj_add_style(ta, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BG_COLOR(lv_color_hex(0xF8F9FA)),
+        LV_STYLE_CONST_BORDER_WIDTH(2),
+        LV_STYLE_CONST_BORDER_COLOR(lv_color_hex(0xDEE2E6)),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
+    lv_obj_add_style(ta, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BORDER_COLOR(lv_color_hex(0x3498DB)),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN | LV_STATE_FOCUSED);
+}
+
+/**
+ * @brief 设置按钮样式：背景色、按下时背景色和圆角8
+ */
+static void btn_style_set(lv_obj_t *btn, uint32_t bg_color, uint32_t pressed_color)
+{
+    lv_obj_add_style(btn, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BG_COLOR(lv_color_hex(bg_color)),
+        LV_STYLE_CONST_RADIUS(8),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
+    lv_obj_add_style(btn, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BG_COLOR(lv_color_hex(pressed_color)),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN | LV_STATE_PRESSED);
+}
+
 /**
  * @brief 清理WiFi页面资源
  */
@@ -345,6 +422,9 @@ static void ta_event_cb(lv_event_t * e)
  */
 void init_pageWifi(void)
 {
+    page_prefetch_enter(&page_assets_wifi);
+    page_build_begin();
+
     /* ========== 0. 初始化 WiFi 管理器 ========== */
     printf("Initializing WiFi manager...\n");
     
@@ -369,22 +449,31 @@ void init_pageWifi(void)
     lv_obj_t * back_container = lv_obj_create(lv_scr_act());
     lv_obj_set_size(back_container, 200, 50);
     lv_obj_align(back_container, LV_ALIGN_TOP_LEFT, 10, 5);
-    lv_obj_set_style_bg_opa(back_container, LV_OPA_TRANSP, LV_PART_MAIN);
-    lv_obj_set_style_border_width(back_container, 0, LV_PART_MAIN);
-    lv_obj_set_style_pad_all(back_container, 0, LV_PART_MAIN);
+    lv_obj_add_style(back_container, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BG_OPA(LV_OPA_TRANSP),
+        LV_STYLE_CONST_BORDER_WIDTH(0),
+        LV_STYLE_CONST_PAD_TOP(0),
+        LV_STYLE_CONST_PAD_BOTTOM(0),
+        LV_STYLE_CONST_PAD_LEFT(0),
+        LV_STYLE_CONST_PAD_RIGHT(0),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
     lv_obj_add_flag(back_container, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_clear_flag(back_container, LV_OBJ_FLAG_SCROLLABLE);
     
     // 返回图标
     lv_obj_t * back_img = lv_img_create(back_container);
-    lv_img_set_src(back_img, GET_IMAGE_PATH("main/back.png"));
+    lv_img_set_src(back_img, IMG_BACK);
     lv_obj_align(back_img, LV_ALIGN_LEFT_MID, 10, 0);
     
     // 标题文字
     lv_obj_t * title_label = lv_label_create(back_container);
     lv_label_set_text(title_label, "WiFi Settings");
-    lv_obj_set_style_text_font(title_label, &lv_font_montserrat_14, LV_PART_MAIN);
-    lv_obj_set_style_text_color(title_label, lv_color_hex(0x2C3E50), LV_PART_MAIN);
+    lv_obj_add_style(title_label, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_14),
+        LV_STYLE_CONST_TEXT_COLOR(lv_color_hex(0x2C3E50)),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
     lv_obj_align_to(title_label, back_img, LV_ALIGN_OUT_RIGHT_MID, 10, 0);
     
     // 添加返回按钮点击事件
@@ -397,19 +486,14 @@ void init_pageWifi(void)
     lv_obj_align(input_container, LV_ALIGN_BOTTOM_LEFT, 20, -10);
     
     // 设置容器样式
-    lv_obj_set_style_bg_color(input_container, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
-    lv_obj_set_style_bg_opa(input_container, LV_OPA_COVER, LV_PART_MAIN);
-    lv_obj_set_style_radius(input_container, 10, LV_PART_MAIN);
-    lv_obj_set_style_border_width(input_container, 1, LV_PART_MAIN);
-    lv_obj_set_style_border_color(input_container, lv_color_hex(0xCCCCCC), LV_PART_MAIN);
-    lv_obj_set_style_pad_all(input_container, 15, LV_PART_MAIN);
+    card_style_set(input_container, 15);
     
     
     /* ---------- 2.1 SSID输入框 ---------- */
     // SSID标签
     lv_obj_t * label_ssid = lv_label_create(input_container);
     lv_label_set_text(label_ssid, "WiFi Name (SSID):");
-    lv_obj_set_style_text_color(label_ssid, lv_color_hex(0x34495E), LV_PART_MAIN);
+    obj_text_color_set(label_ssid, 0x34495E);
     lv_obj_align(label_ssid, LV_ALIGN_TOP_LEFT, 0, 5);
     
     // SSID输入框
@@ -420,10 +504,7 @@ void init_pageWifi(void)
     lv_textarea_set_placeholder_text(ta_ssid, "Enter WiFi name");
     
     // 设置SSID输入框样式
-    lv_obj_set_style_bg_color(ta_ssid, lv_color_hex(0xF8F9FA), LV_PART_MAIN);
-    lv_obj_set_style_border_width(ta_ssid, 2, LV_PART_MAIN);
-    lv_obj_set_style_border_color(ta_ssid, lv_color_hex(0xDEE2E6), LV_PART_MAIN);
-    lv_obj_set_style_border_color(ta_ssid, lv_color_hex(0x3498DB), LV_PART_MAIN | LV_STATE_FOCUSED);
+    ta_style_set(ta_ssid);
     
     // 添加焦点事件
     lv_obj_add_event_cb(ta_ssid, ta_event_cb, LV_EVENT_FOCUSED, NULL);
@@ -433,7 +514,7 @@ void init_pageWifi(void)
     // 密码标签
     lv_obj_t * label_password = lv_label_create(input_container);
     lv_label_set_text(label_password, "Password:");
-    lv_obj_set_style_text_color(label_password, lv_color_hex(0x34495E), LV_PART_MAIN);
+    obj_text_color_set(label_password, 0x34495E);
     lv_obj_align(label_password, LV_ALIGN_TOP_LEFT, 0, 80);
     
     // 密码输入框
@@ -445,10 +526,7 @@ void init_pageWifi(void)
     lv_textarea_set_placeholder_text(ta_password, "Enter password");
     
     // 设置密码输入框样式
-    lv_obj_set_style_bg_color(ta_password, lv_color_hex(0xF8F9FA), LV_PART_MAIN);
-    lv_obj_set_style_border_width(ta_password, 2, LV_PART_MAIN);
-    lv_obj_set_style_border_color(ta_password, lv_color_hex(0xDEE2E6), LV_PART_MAIN);
-    lv_obj_set_style_border_color(ta_password, lv_color_hex(0x3498DB), LV_PART_MAIN | LV_STATE_FOCUSED);
+    ta_style_set(ta_password);
     
     // 添加焦点事件
     lv_obj_add_event_cb(ta_password, ta_event_cb, LV_EVENT_FOCUSED, NULL);
@@ -463,9 +541,12 @@ void init_pageWifi(void)
     lv_keyboard_set_textarea(keyboard, ta_ssid);
     
     // 设置键盘样式
-    lv_obj_set_style_bg_color(keyboard, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
-    lv_obj_set_style_border_width(keyboard, 1, LV_PART_MAIN);
-    lv_obj_set_style_border_color(keyboard, lv_color_hex(0xCCCCCC), LV_PART_MAIN);
+    lv_obj_add_style(keyboard, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BG_COLOR(lv_color_hex(0xFFFFFF)),
+        LV_STYLE_CONST_BORDER_WIDTH(1),
+        LV_STYLE_CONST_BORDER_COLOR(lv_color_hex(0xCCCCCC)),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
     
     
     /* ========== 3.5 扫描结果显示区域（键盘右侧） ========== */
@@ -474,18 +555,16 @@ void init_pageWifi(void)
     lv_obj_align_to(scan_container, keyboard, LV_ALIGN_OUT_RIGHT_MID, 15, 0);
     
     // 设置扫描结果容器样式
-    lv_obj_set_style_bg_color(scan_container, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
-    lv_obj_set_style_bg_opa(scan_container, LV_OPA_COVER, LV_PART_MAIN);
-    lv_obj_set_style_radius(scan_container, 10, LV_PART_MAIN);
-    lv_obj_set_style_border_width(scan_container, 1, LV_PART_MAIN);
-    lv_obj_set_style_border_color(scan_container, lv_color_hex(0xCCCCCC), LV_PART_MAIN);
-    lv_obj_set_style_pad_all(scan_container, 10, LV_PART_MAIN);
+    card_style_set(scan_container, 10);
     
     // 标题
     lv_obj_t * scan_title = lv_label_create(scan_container);
     lv_label_set_text(scan_title, "WiFi Networks");
-    lv_obj_set_style_text_color(scan_title, lv_color_hex(0x34495E), LV_PART_MAIN);
-    lv_obj_set_style_text_font(scan_title, &lv_font_montserrat_14, LV_PART_MAIN);
+    lv_obj_add_style(scan_title, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_TEXT_COLOR(lv_color_hex(0x34495E)),
+        LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_14),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
     lv_obj_align(scan_title, LV_ALIGN_TOP_MID, 0, 0);
     
     // 创建滚动列表
@@ -496,18 +575,27 @@ void init_pageWifi(void)
     lv_obj_set_flex_align(scan_list, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
     
     // 设置列表样式
-    lv_obj_set_style_bg_color(scan_list, lv_color_hex(0xF8F9FA), LV_PART_MAIN);
-    lv_obj_set_style_border_width(scan_list, 1, LV_PART_MAIN);
-    lv_obj_set_style_border_color(scan_list, lv_color_hex(0xDEE2E6), LV_PART_MAIN);
-    lv_obj_set_style_radius(scan_list, 5, LV_PART_MAIN);
-    lv_obj_set_style_pad_all(scan_list, 8, LV_PART_MAIN);
+    lv_obj_add_style(scan_list, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BG_COLOR(lv_color_hex(0xF8F9FA)),
+        LV_STYLE_CONST_BORDER_WIDTH(1),
+        LV_STYLE_CONST_BORDER_COLOR(lv_color_hex(0xDEE2E6)),
+        LV_STYLE_CONST_RADIUS(5),
+        LV_STYLE_CONST_PAD_TOP(8),
+        LV_STYLE_CONST_PAD_BOTTOM(8),
+        LV_STYLE_CONST_PAD_LEFT(8),
+        LV_STYLE_CONST_PAD_RIGHT(8),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
     lv_obj_set_scrollbar_mode(scan_list, LV_SCROLLBAR_MODE_AUTO);
     
     // 初始提示
     lv_obj_t * hint_label = lv_label_create(scan_list);
     lv_label_set_text(hint_label, "Click 'Scan' to\nsearch WiFi networks");
-    lv_obj_set_style_text_color(hint_label, lv_color_hex(0x95A5A6), LV_PART_MAIN);
-    lv_obj_set_style_text_align(hint_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    lv_obj_add_style(hint_label, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_TEXT_COLOR(lv_color_hex(0x95A5A6)),
+        LV_STYLE_CONST_TEXT_ALIGN(LV_TEXT_ALIGN_CENTER),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
     
     
     /* ========== 4. 按钮区域 ========== */
@@ -517,14 +605,12 @@ void init_pageWifi(void)
     lv_obj_align(btn_connect, LV_ALIGN_TOP_RIGHT, -5, 28);
     
     // 设置连接按钮样式
-    lv_obj_set_style_bg_color(btn_connect, lv_color_hex(0x27AE60), LV_PART_MAIN);  // 绿色
-    lv_obj_set_style_bg_color(btn_connect, lv_color_hex(0x229954), LV_PART_MAIN | LV_STATE_PRESSED);
-    lv_obj_set_style_radius(btn_connect, 8, LV_PART_MAIN);
+    btn_style_set(btn_connect, 0x27AE60, 0x229954);  // 绿色
     
     // 连接按钮标签
     lv_obj_t * label_connect = lv_label_create(btn_connect);
     lv_label_set_text(label_connect, "Connect");
-    lv_obj_set_style_text_color(label_connect, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    obj_text_color_set(label_connect, 0xFFFFFF);
     lv_obj_center(label_connect);
     
     // 添加点击事件
@@ -537,14 +623,12 @@ void init_pageWifi(void)
     lv_obj_align(btn_cancel, LV_ALIGN_TOP_RIGHT, -5, 75);
     
     // 设置取消按钮样式
-    lv_obj_set_style_bg_color(btn_cancel, lv_color_hex(0xE74C3C), LV_PART_MAIN);  // 红色
-    lv_obj_set_style_bg_color(btn_cancel, lv_color_hex(0xC0392B), LV_PART_MAIN | LV_STATE_PRESSED);
-    lv_obj_set_style_radius(btn_cancel, 8, LV_PART_MAIN);
+    btn_style_set(btn_cancel, 0xE74C3C, 0xC0392B);  // 红色
     
     // 取消按钮标签
     lv_obj_t * label_cancel = lv_label_create(btn_cancel);
     lv_label_set_text(label_cancel, "Cancel");
-    lv_obj_set_style_text_color(label_cancel, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    obj_text_color_set(label_cancel, 0xFFFFFF);
     lv_obj_center(label_cancel);
     
     // 添加点击事件
@@ -557,14 +641,12 @@ void init_pageWifi(void)
     lv_obj_align(btn_disconnect, LV_ALIGN_TOP_RIGHT, -5, 122);
     
     // 设置断开按钮样式
-    lv_obj_set_style_bg_color(btn_disconnect, lv_color_hex(0xF39C12), LV_PART_MAIN);  // 橙色
-    lv_obj_set_style_bg_color(btn_disconnect, lv_color_hex(0xD68910), LV_PART_MAIN | LV_STATE_PRESSED);
-    lv_obj_set_style_radius(btn_disconnect, 8, LV_PART_MAIN);
+    btn_style_set(btn_disconnect, 0xF39C12, 0xD68910);  // 橙色
     
     // 断开按钮标签
     lv_obj_t * label_disconnect = lv_label_create(btn_disconnect);
     lv_label_set_text(label_disconnect, "Disconnect");
-    lv_obj_set_style_text_color(label_disconnect, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    obj_text_color_set(label_disconnect, 0xFFFFFF);
     lv_obj_center(label_disconnect);
     
     // 添加点击事件
@@ -577,14 +659,12 @@ void init_pageWifi(void)
     lv_obj_align(btn_scan, LV_ALIGN_TOP_RIGHT, -5, 169);
     
     // 设置扫描按钮样式
-    lv_obj_set_style_bg_color(btn_scan, lv_color_hex(0x3498DB), LV_PART_MAIN);  // 蓝色
-    lv_obj_set_style_bg_color(btn_scan, lv_color_hex(0x2980B9), LV_PART_MAIN | LV_STATE_PRESSED);
-    lv_obj_set_style_radius(btn_scan, 8, LV_PART_MAIN);
+    btn_style_set(btn_scan, 0x3498DB, 0x2980B9);  // 蓝色
     
     // 扫描按钮标签
     lv_obj_t * label_scan = lv_label_create(btn_scan);
     lv_label_set_text(label_scan, "Scan");
-    lv_obj_set_style_text_color(label_scan, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    obj_text_color_set(label_scan, 0xFFFFFF);
     lv_obj_center(label_scan);
     
     // 添加点击事件
@@ -597,5 +677,6 @@ void init_pageWifi(void)
     lv_obj_set_style_text_color(label_status, lv_color_hex(0x95A5A6), LV_PART_MAIN);
     lv_obj_set_style_text_font(label_status, &lv_font_montserrat_14, LV_PART_MAIN);
     lv_obj_align(label_status, LV_ALIGN_BOTTOM_LEFT, 3, -8);
+    page_build_end();
 }
 
@@ -15,6 +15,30 @@ static int time_count = 0;
 static lv_obj_t * countdown_msgbox = NULL;
 static lv_obj_t * countdown_label = NULL;
 
+//图片和文字，页面和预取资源共用
+#define IMG_BACK            GET_IMAGE_PATH("main/back.png")
+#define IMG_ALARM           GET_IMAGE_PATH("icon_alarm.png")
+
+#define TEXT_TITLE          "闹铃设置"
+#define TEXT_ROLLER_TITLE   "分钟后提醒我"
+#define TEXT_SET            "设置"
+#define TEXT_CANCEL         "取消"
+#define TEXT_DONE_PREFIX    "设置成功,"
+#define TEXT_DONE_SUFFIX    "分钟后提醒"
+#define TEXT_DIGITS         "0123456789"
+
+//页面资源，用于从菜单进入前预取
+static const char *const page_imgs[] = {IMG_BACK, IMG_ALARM, NULL};
+static const page_font_t page_fonts[] = {
+    {FONT_TYPE_CN, 24, TEXT_TITLE TEXT_ROLLER_TITLE TEXT_SET TEXT_CANCEL},
+    {FONT_TYPE_CN_LIGHT, 36, TEXT_DIGITS},
+    {FONT_TYPE_CN_LIGHT, 28, TEXT_DIGITS},
+    {FONT_TYPE_CN, 18, TEXT_DONE_PREFIX TEXT_DONE_SUFFIX TEXT_DIGITS},
+    {0}
+};
+static const page_assets_t *const next_pages[] = {&page_assets_menu, NULL};
+const page_assets_t page_assets_clock = {"Clock", page_imgs, page_fonts, next_pages};
+
 //初始化通用样式
 static void com_style_init(){
     //初始化样式
@@ -96,12 +120,12 @@ static void refresh_timer_cb_func(lv_timer_t * timer)
         lv_label_set_text_fmt(countdown_label, "%02d:%02d", minutes, seconds);
     }
     
-    lv_label_set_text_fmt(count_time_label,"设置成功,%d分钟后提醒",alarm_time);
+    lv_label_set_text_fmt(count_time_label, TEXT_DONE_PREFIX "%d" TEXT_DONE_SUFFIX, alarm_time);
     if(alarm_time > 0){
-        lv_label_set_text(lv_obj_get_child(count_time_btn,0),"取消");
+        lv_label_set_text(lv_obj_get_child(count_time_btn,0),TEXT_CANCEL);
         lv_obj_clear_flag(count_time_label,LV_OBJ_FLAG_HIDDEN);
     }else{
-        lv_label_set_text(lv_obj_get_child(count_time_btn,0),"设置");
+        lv_label_set_text(lv_obj_get_child(count_time_btn,0),TEXT_SET);
         lv_obj_add_flag(count_time_label,LV_OBJ_FLAG_HIDDEN);
     }
 }  
@@ -114,7 +138,7 @@ static void countdown_msgbox_delete_cb(lv_event_t * e){
     alarm_time = 0;
     time_count = 0;
     // 重置主界面按钮状态
-    lv_label_set_text(lv_obj_get_child(count_time_btn,0),"设置");
+    lv_label_set_text(lv_obj_get_child(count_time_btn,0),TEXT_SET);
     lv_obj_add_flag(count_time_label,LV_OBJ_FLAG_HIDDEN);
 }
 
@@ -149,7 +173,7 @@ static void select_btn_click_event_cb(lv_event_t * e){
         }
         //转换为秒
         time_count = alarm_time * 60;
-        lv_label_set_text(label, "取消"); // 修改为"取消"
+        lv_label_set_text(label, TEXT_CANCEL); // 修改为"取消"
         
         // 创建倒计时弹窗
         static const char * btns[] = {"取消", ""};
@@ -202,7 +226,7 @@ static lv_obj_t * init_title_view(lv_obj_t *parent){
     //初始化返回图像控件
     lv_obj_t *back_img = lv_img_create(cont);
     //设置显示的图片（返回图标）
-    lv_img_set_src(back_img,GET_IMAGE_PATH("main/back.png"));
+    lv_img_set_src(back_img,IMG_BACK);
     //设置对齐方式为，父对象的左上角对齐
     lv_obj_set_align(back_img,LV_ALIGN_TOP_LEFT);
     //设置左侧、顶部填充距离为20
@@ -211,7 +235,7 @@ static lv_obj_t * init_title_view(lv_obj_t *parent){
 
     //初始化菜单图像控件
     lv_obj_t *menu_img = lv_img_create(cont);
-    lv_img_set_src(menu_img,GET_IMAGE_PATH("icon_alarm.png"));
+    lv_img_set_src(menu_img,IMG_ALARM);
     lv_obj_set_align(menu_img,LV_ALIGN_TOP_LEFT);
     lv_obj_set_style_pad_top(menu_img,20,LV_PART_MAIN);
     //设置控件对齐back_img，x轴偏移20
@@ -222,7 +246,7 @@ static lv_obj_t * init_title_view(lv_obj_t *parent){
     //设置字体样式和字体大小
     obj_font_set(title,FONT_TYPE_CN, 24);
     //设置显示内容
-    lv_label_set_text(title,"闹铃设置");
+    lv_label_set_text(title,TEXT_TITLE);
     //设置颜色
     lv_obj_set_style_text_color(title,lv_color_hex(0xffffff),0);
     //设置对齐方式
@@ -254,7 +278,7 @@ static lv_obj_t * init_select_btn(lv_obj_t *parent){
     lv_obj_t  * btn_label = lv_label_create(btn);
     obj_font_set(btn_label,FONT_TYPE_CN, 24);
     lv_obj_set_style_text_color(btn_label,lv_color_hex(0xffffff),0);
-    lv_label_set_text(btn_label,"设置");
+    lv_label_set_text(btn_label,TEXT_SET);
     //进行偏移对齐
     lv_obj_align(btn_label,LV_ALIGN_CENTER,0,-5);
     return btn;
@@ -272,7 +296,7 @@ static lv_obj_t * init_setting_param_view(lv_obj_t *parent){
 
     //创建图标控件
     lv_obj_t *setting_img = lv_img_create(cont);
-    lv_img_set_src(setting_img,GET_IMAGE_PATH("icon_alarm.png"));
+    lv_img_set_src(setting_img,IMG_ALARM);
     lv_obj_set_style_pad_top(setting_img,10,LV_PART_MAIN);
 
     //创建滚轮
@@ -303,13 +327,16 @@ static lv_obj_t * init_setting_param_view(lv_obj_t *parent){
     //创建标签
     lv_obj_t *title = lv_label_create(cont);
     obj_font_set(title,FONT_TYPE_CN, 24);
-    lv_label_set_text(title,"分钟后提醒我");
+    lv_label_set_text(title,TEXT_ROLLER_TITLE);
     lv_obj_set_style_text_color(title,lv_color_hex(0xffffff),0);
     return cont;
 }
 
 void init_pageClock()
 {
+    page_prefetch_enter(&page_assets_clock);
+    page_build_begin();
+
     printf("Initializing pageClock...\n");
     
     // 初始化样式
@@ -342,10 +369,11 @@ void init_pageClock()
     count_time_label = lv_label_create(cont);
     obj_font_set(count_time_label,FONT_TYPE_CN, 18);
     lv_obj_set_style_text_color(count_time_label,lv_color_hex(0xffffff),0);
-    lv_label_set_text_fmt(count_time_label,"设置成功,%d分钟后提醒",alarm_time);
+    lv_label_set_text_fmt(count_time_label, TEXT_DONE_PREFIX "%d" TEXT_DONE_SUFFIX, alarm_time);
     lv_obj_align_to(count_time_label, count_time_btn,LV_ALIGN_OUT_BOTTOM_MID,0,10);
     lv_obj_add_flag(count_time_label,LV_OBJ_FLAG_HIDDEN);
 
     if(refresh_timer == NULL)
         refresh_timer = lv_timer_create((void*)refresh_timer_cb_func, 1000, NULL);
+    page_build_end();
 }
\ No newline at end of file
@@ -1,6 +1,19 @@
 #ifndef _PAGE_CONF_H_
 #define _PAGE_CONF_H_
 
+#include "lvgl.h"
+#include "page_prefetch.h"
+
+/* 各页面声明的资源，用于预取下一个可能打开的页面（见 page_prefetch.h） */
+extern const page_assets_t page_assets_start;
+extern const page_assets_t page_assets_menu;
+extern const page_assets_t page_assets_wifi;
+extern const page_assets_t page_assets_setting;
+extern const page_assets_t page_assets_clock;
+extern const page_assets_t page_assets_music;
+extern const page_assets_t page_assets_notebook;
+extern const page_assets_t page_assets_information;
+
 void init_page1(void);
 void init_page2(void);
 void init_pageStart(void);
@@ -19,4 +32,26 @@ void init_pageNotebook(void);
 void cleanup_pageNotebook(void);
 void init_pageInformation(void);
 void cleanup_pageInformation(void);
+
+/**
+ * @brief 开始构建页面：此后创建的对象从当前屏幕的arena分配
+ * @note 切换页面时 lv_obj_clean() 释放全部对象，arena的内存块整块归还，不产生碎片
+ */
+static inline void page_build_begin(void)
+{
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    lv_mem_arena_begin(lv_scr_act());
+#endif
+}
+
+/**
+ * @brief 结束构建页面：之后的分配（如运行时创建的对象、文本）回到普通堆
+ */
+static inline void page_build_end(void)
+{
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    lv_mem_arena_end();
+#endif
+}
+
 #endif
\ No newline at end of file
@@ -12,6 +12,24 @@ static lv_obj_t *btn_sysinfo = NULL;    // 系统信息按钮
 static lv_obj_t *btn_syslog = NULL;     // 系统日志按钮
 static int current_tab = 0;             // 当前选中的tab: 0=系统信息, 1=系统日志
 
+/* ========== 图片和文字（页面和预取资源共用） ========== */
+#define IMG_BACK            GET_IMAGE_PATH("main/back.png")
+
+#define TEXT_TITLE          "信息中心"
+#define TEXT_SYSINFO        "系统信息"
+#define TEXT_SYSLOG         "系统日志"
+
+/* ========== 预取资源 ========== */
+static const char *const page_imgs[] = {IMG_BACK, NULL};
+static const page_font_t page_fonts[] = {
+    {FONT_TYPE_CN, 24, TEXT_TITLE},
+    {FONT_TYPE_CN, 22, TEXT_SYSINFO TEXT_SYSLOG},
+    {FONT_TYPE_CN, 18, NULL},
+    {0}
+};
+static const page_assets_t *const next_pages[] = {&page_assets_menu, NULL};
+const page_assets_t page_assets_information = {"Information", page_imgs, page_fonts, next_pages};
+
 /* ========== 样式初始化 ========== */
 static void com_style_init(void)
 {
@@ -176,7 +194,7 @@ static void init_header_view(lv_obj_t *parent)
     lv_obj_set_style_bg_color(back_btn_cont, lv_color_hex(0x34495E), LV_PART_MAIN);
     
     lv_obj_t *back_img = lv_img_create(back_btn_cont);
-    lv_img_set_src(back_img, GET_IMAGE_PATH("main/back.png"));
+    lv_img_set_src(back_img, IMG_BACK);
     lv_obj_align(back_img, LV_ALIGN_CENTER, 0, 0);
     
     lv_obj_add_event_cb(back_btn_cont, back_btn_event_cb, LV_EVENT_CLICKED, NULL);
@@ -184,7 +202,7 @@ static void init_header_view(lv_obj_t *parent)
     /* ========== 中间：标题 ========== */
     lv_obj_t *title_label = lv_label_create(header);
     obj_font_set(title_label, FONT_TYPE_CN, 24);
-    lv_label_set_text(title_label, "信息中心");
+    lv_label_set_text(title_label, TEXT_TITLE);
     lv_obj_align(title_label, LV_ALIGN_CENTER, 0, 0);
     lv_obj_set_style_text_color(title_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
 }
@@ -213,7 +231,7 @@ static void init_left_buttons(lv_obj_t *parent)
     
     lv_obj_t *label_sysinfo = lv_label_create(btn_sysinfo);
     obj_font_set(label_sysinfo, FONT_TYPE_CN, 22);
-    lv_label_set_text(label_sysinfo, "系统信息");
+    lv_label_set_text(label_sysinfo, TEXT_SYSINFO);
     lv_obj_center(label_sysinfo);
     
     lv_obj_add_event_cb(btn_sysinfo, sysinfo_btn_event_cb, LV_EVENT_CLICKED, NULL);
@@ -228,7 +246,7 @@ static void init_left_buttons(lv_obj_t *parent)
     
     lv_obj_t *label_syslog = lv_label_create(btn_syslog);
     obj_font_set(label_syslog, FONT_TYPE_CN, 22);
-    lv_label_set_text(label_syslog, "系统日志");
+    lv_label_set_text(label_syslog, TEXT_SYSLOG);
     lv_obj_center(label_syslog);
     
     lv_obj_add_event_cb(btn_syslog, syslog_btn_event_cb, LV_EVENT_CLICKED, NULL);
@@ -271,6 +289,9 @@ static void init_right_content(lv_obj_t *parent)
  */
 void init_pageInformation(void)
 {
+    page_prefetch_enter(&page_assets_information);
+    page_build_begin();
+
     printf("Initializing pageInformation...\n");
     
     // 初始化样式
@@ -296,4 +317,5 @@ void init_pageInformation(void)
     update_button_state(0);
     
     printf("pageInformation initialized successfully\n");
+    page_build_end();
 }
@@ -0,0 +1,160 @@
+/**
+ * @file page_prefetch.c
+ * @brief 页面资源预取实现
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "page_prefetch.h"
+#include "font_utils.h"
+
+/* ========== 类型定义 ========== */
+
+/* 预取进度：依次处理 page->next 中每个邻居的图片、字体 */
+typedef struct {
+    const page_assets_t *page;  // 当前页面
+    uint32_t next_idx;          // 正在预取的邻居
+    uint32_t img_idx;           // 邻居中下一张图片
+    uint32_t font_idx;          // 邻居中下一个字体
+    uint32_t text_ofs;          // 字体文字中下一个字符的位置
+    uint32_t img_size;          // 已预取的图片大小（字节）
+    uint32_t img_cnt;
+    uint32_t glyph_cnt;
+} prefetch_state_t;
+
+/* ========== 全局变量 ========== */
+static prefetch_state_t state;
+static lv_timer_t *prefetch_timer = NULL;
+
+/* ========== 内部函数 ========== */
+
+/**
+ * @brief 预取一张图片，预算用完或缓存没有空闲空间时跳过
+ */
+static void img_prefetch(const char *src)
+{
+    if (state.img_size >= PAGE_PREFETCH_IMG_BUDGET) return;
+
+    // 缓存返回新占用的大小，已缓存、已在排队的图片为0
+    uint32_t size;
+    if (lv_img_cache_prefetch(src, &size) == LV_RES_OK) {
+        state.img_size += size;
+        state.img_cnt++;
+    }
+}
+
+/**
+ * @brief 文字中 ofs 之前是否已有这个字符，重复的字符不再计入字形数
+ */
+static bool text_has_letter(const char *text, uint32_t ofs, uint32_t letter)
+{
+    uint32_t i = 0;
+    while (i < ofs) {
+        if (_lv_txt_encoded_next(text, &i) == letter) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief 创建字体并渲染文字的字形，时间片用完时记下位置，下次继续
+ * @param f 字体
+ * @param start_tick 本次定时器回调开始的时间
+ * @return true-这个字体已完成，false-时间片用完
+ */
+static bool font_prefetch(const page_font_t *f, uint32_t start_tick)
+{
+    // 第一次使用的字体在这里创建（打开字体文件比较慢）
+    lv_font_t *font = get_font(f->type, f->size);
+    if (font == NULL || f->text == NULL) return true;
+
+    while (f->text[state.text_ofs] != '\0') {
+        if (state.glyph_cnt >= PAGE_PREFETCH_GLYPH_MAX) return true;
+        if (lv_tick_elaps(start_tick) >= PAGE_PREFETCH_SLICE_MS) return false;
+
+        uint32_t letter_ofs = state.text_ofs;
+        uint32_t letter = _lv_txt_encoded_next(f->text, &state.text_ofs);
+        if (text_has_letter(f->text, letter_ofs, letter)) continue;
+
+        uint32_t letter_next = _lv_txt_encoded_next(&f->text[state.text_ofs], NULL);
+        lv_font_glyph_dsc_t g;
+        if (lv_font_get_glyph_dsc(font, &g, letter, letter_next) && g.resolved_font) {
+            lv_font_get_glyph_bitmap(g.resolved_font, letter);
+            state.glyph_cnt++;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 预取下一项资源
+ * @return true-还有资源，false-全部完成
+ */
+static bool prefetch_step(uint32_t start_tick)
+{
+    const page_assets_t *next = state.page->next ? state.page->next[state.next_idx] : NULL;
+    if (next == NULL) return false;
+
+    if (next->imgs && next->imgs[state.img_idx]) {
+        img_prefetch(next->imgs[state.img_idx]);
+        state.img_idx++;
+        return true;
+    }
+
+    if (next->fonts && next->fonts[state.font_idx].size) {
+        if (font_prefetch(&next->fonts[state.font_idx], start_tick)) {
+            state.font_idx++;
+            state.text_ofs = 0;
+        }
+        return true;
+    }
+
+    // 这个邻居完成，下一个
+    state.next_idx++;
+    state.img_idx = 0;
+    state.font_idx = 0;
+    return true;
+}
+
+/**
+ * @brief 预取定时器回调：空闲时在时间片内预取
+ */
+static void prefetch_timer_cb(lv_timer_t *timer)
+{
+    // 用户正在操作或有动画时不占用UI线程
+    if (lv_disp_get_inactive_time(NULL) < PAGE_PREFETCH_IDLE_MS || lv_anim_count_running()) {
+        return;
+    }
+
+    uint32_t start_tick = lv_tick_get();
+    do {
+        if (!prefetch_step(start_tick)) {
+            // 完成后暂停定时器，空闲时不再唤醒UI线程
+            lv_timer_pause(timer);
+            printf("✅ Prefetched for %s: %u images (%u KB), %u glyphs\n", state.page->name,
+                   state.img_cnt, state.img_size / 1024, state.glyph_cnt);
+            return;
+        }
+    } while (lv_tick_elaps(start_tick) < PAGE_PREFETCH_SLICE_MS);
+}
+
+/* ========== API实现 ========== */
+
+void page_prefetch_enter(const page_assets_t *page)
+{
+    // 上一个页面的邻居还在排队解码的图片不再需要
+    lv_img_cache_prefetch_cancel();
+
+    memset(&state, 0, sizeof(state));
+    state.page = page;
+    if (page == NULL || page->next == NULL) {
+        if (prefetch_timer) lv_timer_pause(prefetch_timer);
+        return;
+    }
+
+    if (prefetch_timer == NULL) {
+        prefetch_timer = lv_timer_create(prefetch_timer_cb, PAGE_PREFETCH_PERIOD, NULL);
+    } else {
+        lv_timer_reset(prefetch_timer);
+        lv_timer_resume(prefetch_timer);
+    }
+}
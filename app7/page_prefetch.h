@@ -0,0 +1,53 @@
+/**
+ * @file page_prefetch.h
+ * @brief 页面资源预取 - 空闲时提前加载接下来可能打开的页面的图片和字体
+ * @note 每个页面用 page_assets_t 声明自己的图片、字体和能跳转到的页面（邻居）。
+ *       进入页面时调用 page_prefetch_enter()，用户停止操作后按声明顺序预取各邻居的资源：
+ *       1. 图片解码进图片缓存，只用缓存的空闲空间，不会挤掉当前页面的图片
+ *       2. 创建字体并渲染常用文字的字形，放入FreeType字形缓存
+ *       切换页面时未完成的预取全部取消，改为预取新页面的邻居
+ */
+
+#ifndef _PAGE_PREFETCH_H_
+#define _PAGE_PREFETCH_H_
+
+#include "lvgl.h"
+
+/* 无触摸输入且没有动画这么久后开始预取（毫秒） */
+#define PAGE_PREFETCH_IDLE_MS       300
+/* 预取定时器周期（毫秒） */
+#define PAGE_PREFETCH_PERIOD        50
+/* 每次定时器回调最多占用UI线程的时间（毫秒），创建字体、同步解码的一项可能超过 */
+#define PAGE_PREFETCH_SLICE_MS      5
+/* 每次进入页面最多预取的图片解码数据（字节），最后一张图片可能超出 */
+#define PAGE_PREFETCH_IMG_BUDGET    (4 * 1024 * 1024)
+/* 每次进入页面最多预渲染的字形数，FreeType字形缓存只有 LV_FREETYPE_CACHE_SIZE 字节，多了会挤掉当前页面的字形 */
+#define PAGE_PREFETCH_GLYPH_MAX     48
+
+/**
+ * @brief 页面用到的字体
+ */
+typedef struct {
+    int type;               // FONT_TYPE_CN等
+    uint16_t size;          // 字号，0表示数组结束
+    const char *text;       // 预渲染这些文字的字形（UTF-8，重复的字符只渲染一次），NULL表示只创建字体
+} page_font_t;
+
+/**
+ * @brief 页面声明的资源
+ */
+typedef struct page_assets {
+    const char *name;                       // 页面名称，用于日志
+    const char *const *imgs;                // 图片路径，NULL结尾，可为NULL
+    const page_font_t *fonts;               // 字体，size为0的项结尾，可为NULL
+    const struct page_assets *const *next;  // 能跳转到的页面，可能性大的在前，NULL结尾，可为NULL
+} page_assets_t;
+
+/**
+ * @brief 进入页面：取消上一个页面未完成的预取，空闲后预取本页面邻居的资源
+ * @param page 页面声明的资源
+ * @note 在页面初始化函数开头、page_build_begin() 之前调用（只能在UI线程中调用）
+ */
+void page_prefetch_enter(const page_assets_t *page);
+
+#endif /* _PAGE_PREFETCH_H_ */
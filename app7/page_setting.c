@@ -28,6 +28,26 @@ static void em_hal_brightness_set_value(int value)
     system(cmd);
 }
 
+//图片和文字，页面和预取资源共用
+#define IMG_BACK            GET_IMAGE_PATH("main/back.png")
+#define IMG_SETTING         GET_IMAGE_PATH("icon_setting.png")
+#define IMG_BRIGHTNESS      GET_IMAGE_PATH("icon_brightness.png")
+#define IMG_VOLUME          GET_IMAGE_PATH("icon_volume.png")
+
+#define TEXT_TITLE          "系统设置"
+#define TEXT_BRIGHTNESS     "亮度"
+#define TEXT_VOLUME         "音量"
+#define TEXT_VALUE_CHARS    "0123456789%"   // 数值 "%d%%" 用到的字符
+
+//页面资源，用于从菜单进入前预取
+static const char *const page_imgs[] = {IMG_BACK, IMG_SETTING, IMG_BRIGHTNESS, IMG_VOLUME, NULL};
+static const page_font_t page_fonts[] = {
+    {FONT_TYPE_CN, 24, TEXT_TITLE TEXT_BRIGHTNESS TEXT_VOLUME TEXT_VALUE_CHARS},
+    {0}
+};
+static const page_assets_t *const next_pages[] = {&page_assets_menu, NULL};
+const page_assets_t page_assets_setting = {"Setting", page_imgs, page_fonts, next_pages};
+
 //声明通用样式
 static lv_style_t com_style;
 //初始化通用样式
@@ -101,16 +121,16 @@ static void init_back_view(lv_obj_t *parent){
     lv_obj_clear_flag(cont, LV_OBJ_FLAG_GESTURE_BUBBLE);
 
     lv_obj_t * img_back = lv_img_create(cont);
-    lv_img_set_src(img_back, GET_IMAGE_PATH("main/back.png"));
+    lv_img_set_src(img_back, IMG_BACK);
     lv_obj_align(img_back,LV_ALIGN_LEFT_MID,20,0);
 
     lv_obj_t * img_set = lv_img_create(cont);
-    lv_img_set_src(img_set, GET_IMAGE_PATH("icon_setting.png"));
+    lv_img_set_src(img_set, IMG_SETTING);
     lv_obj_align_to(img_set,img_back,LV_ALIGN_OUT_RIGHT_MID,15,0);
 
     lv_obj_t *label = lv_label_create(cont);
     obj_font_set(label,FONT_TYPE_CN,24);
-    lv_label_set_text(label, "系统设置");
+    lv_label_set_text(label, TEXT_TITLE);
     lv_obj_align_to(label,img_set,LV_ALIGN_OUT_RIGHT_MID,5,-5);
     lv_obj_set_style_text_color(label,lv_color_hex(0xffffff),LV_PART_MAIN);
 
@@ -132,8 +152,8 @@ static int g_brightness_value = 50;  // 默认亮度50%
 static int g_volume_value = 50;      // 默认音量50%
 
 static system_setting_info_t info[2] = {
-    {0, GET_IMAGE_PATH("icon_brightness.png"), "亮度", 0},  // value将在初始化时设置
-    {1, GET_IMAGE_PATH("icon_volume.png"), "音量", 0},
+    {0, IMG_BRIGHTNESS, TEXT_BRIGHTNESS, 0},  // value将在初始化时设置
+    {1, IMG_VOLUME, TEXT_VOLUME, 0},
 };
 
 // 滑动条类型标识
@@ -226,6 +246,9 @@ static lv_obj_t * init_setting_view(lv_obj_t *parent){
 }
 
 void init_page_setting(){
+    page_prefetch_enter(&page_assets_setting);
+    page_build_begin();
+
     printf("Initializing page_setting...\n");
     
     // 初始化样式
@@ -248,6 +271,7 @@ void init_page_setting(){
     init_setting_view(cont);
     
     printf("page_setting initialized successfully\n");
+    page_build_end();
 }
 
     
\ No newline at end of file
@@ -8,33 +8,62 @@
 #include "image_conf.h"
 #include "font_conf.h"
 #include "file.h"  // 引入文件原子操作接口
+#include "mem_track.h"  // 内存分配统计
 
 /* ========== 文件路径定义 ========== */
 #define NOTEBOOK_FILE_PATH "/usr/data/note/notebook.txt"
 #define HISTORY_DIR "/usr/data/note"
 
+/* ========== 图片和文字（页面和预取资源共用） ========== */
+#define IMG_BACK            GET_IMAGE_PATH("main/back.png")
+
+#define TEXT_TITLE          "记事本"
+#define TEXT_SWITCH         "切换"
+#define TEXT_CLEAR          "清空"
+#define TEXT_SAVE           "保存"
+#define TEXT_SAVEAS         "另存"
+#define TEXT_PLACEHOLDER    "在这里输入你的记事内容..."
+
 /* ========== 全局变量 ========== */
-static lv_style_t com_style;
+static lv_style_t *com_style = NULL;  // 共享样式，页面重建时复用
 static lv_obj_t *textarea = NULL;  // 文本编辑区
 static lv_obj_t *keyboard = NULL;  // 虚拟键盘
 static lv_obj_t *content_cont = NULL;  // 内容区容器
 static lv_obj_t *history_msgbox = NULL;  // 历史记录弹窗
 static lv_obj_t *saveas_msgbox = NULL;  // 另存弹窗
-static char notebook_content[1024] = {0};  // 记事本内容缓存
+static char notebook_content[1024] = {0};  // 记事本内容缓存，未编辑时文本编辑区直接显示它
 static bool keyboard_visible = false;  // 键盘显示状态标志
 
+/* ========== 预取资源 ========== */
+static const char *const page_imgs[] = {IMG_BACK, NULL};
+static const page_font_t page_fonts[] = {
+    {FONT_TYPE_CN, 24, TEXT_TITLE},
+    {FONT_TYPE_CN, 18, TEXT_SWITCH TEXT_CLEAR TEXT_SAVE TEXT_SAVEAS},
+    {FONT_TYPE_CN, 20, TEXT_PLACEHOLDER},
+    {0}
+};
+static const page_assets_t *const next_pages[] = {&page_assets_menu, NULL};
+const page_assets_t page_assets_notebook = {"Notebook", page_imgs, page_fonts, next_pages};
+
 /* ========== 函数前向声明 ========== */
 static void switch_btn_event_cb(lv_event_t * e);
 
 /* ========== 样式初始化 ========== */
+/* 控件样式都使用 lv_style_get_shared() 获取的共享样式：
+ * 属性相同的样式只创建一次，页面重建时直接复用，不再为每个控件分配本地样式 */
 static void com_style_init(void)
 {
-    lv_style_init(&com_style);
-    lv_style_set_bg_color(&com_style, lv_color_hex(0xFFFFFF));
-    lv_style_set_radius(&com_style, 0);
-    lv_style_set_border_width(&com_style, 0);
-    lv_style_set_pad_all(&com_style, 0);
-    lv_style_set_outline_width(&com_style, 0);
+    com_style = lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BG_COLOR(lv_color_hex(0xFFFFFF)),
+        LV_STYLE_CONST_RADIUS(0),
+        LV_STYLE_CONST_BORDER_WIDTH(0),
+        LV_STYLE_CONST_PAD_TOP(0),
+        LV_STYLE_CONST_PAD_BOTTOM(0),
+        LV_STYLE_CONST_PAD_LEFT(0),
+        LV_STYLE_CONST_PAD_RIGHT(0),
+        LV_STYLE_CONST_OUTLINE_WIDTH(0),
+        {.prop = LV_STYLE_PROP_INV}
+    });
 }
 
 /* ========== 字体设置 ========== */
@@ -42,7 +71,66 @@ static void obj_font_set(lv_obj_t *obj, int type, uint16_t weight)
 {
     lv_font_t* font = get_font(type, weight);
     if(font != NULL)
-        lv_obj_set_style_text_font(obj, font, LV_PART_MAIN);
+        lv_obj_add_style(obj, lv_style_get_shared((lv_style_const_prop_t []) {
+            LV_STYLE_CONST_TEXT_FONT(font),
+            {.prop = LV_STYLE_PROP_INV}
+        }), LV_PART_MAIN);
+}
+
+/* ========== 文字颜色设置 ========== */
+static void obj_text_color_set(lv_obj_t *obj, uint32_t color)
+{
+    lv_obj_add_style(obj, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_TEXT_COLOR(lv_color_hex(color)),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
+}
+
+/**
+ * @brief 设置按钮样式：背景色和圆角
+ */
+static void btn_style_set(lv_obj_t *btn, uint32_t bg_color, lv_coord_t radius)
+{
+    lv_obj_add_style(btn, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BG_COLOR(lv_color_hex(bg_color)),
+        LV_STYLE_CONST_RADIUS(radius),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
+}
+
+/**
+ * @brief 设置弹窗样式：白色背景、蓝色边框、圆角和阴影
+ */
+static void msgbox_style_set(lv_obj_t *msgbox)
+{
+    lv_obj_add_style(msgbox, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BG_COLOR(lv_color_hex(0xFFFFFF)),
+        LV_STYLE_CONST_BORDER_COLOR(lv_color_hex(0x3498DB)),
+        LV_STYLE_CONST_BORDER_WIDTH(2),
+        LV_STYLE_CONST_RADIUS(10),
+        LV_STYLE_CONST_SHADOW_WIDTH(20),
+        LV_STYLE_CONST_SHADOW_COLOR(lv_color_hex(0x000000)),
+        LV_STYLE_CONST_SHADOW_OPA(LV_OPA_50),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
+}
+
+/**
+ * @brief 设置面板样式：背景色、1像素边框、圆角5和内边距
+ */
+static void panel_style_set(lv_obj_t *panel, uint32_t bg_color, uint32_t border_color, lv_coord_t pad)
+{
+    lv_obj_add_style(panel, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BG_COLOR(lv_color_hex(bg_color)),
+        LV_STYLE_CONST_BORDER_WIDTH(1),
+        LV_STYLE_CONST_BORDER_COLOR(lv_color_hex(border_color)),
+        LV_STYLE_CONST_RADIUS(5),
+        LV_STYLE_CONST_PAD_TOP(pad),
+        LV_STYLE_CONST_PAD_BOTTOM(pad),
+        LV_STYLE_CONST_PAD_LEFT(pad),
+        LV_STYLE_CONST_PAD_RIGHT(pad),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
 }
 
 /**
@@ -118,11 +206,7 @@ void cleanup_pageNotebook(void)
 {
     printf("Cleaning up pageNotebook resources...\n");
     
-    // 清理样式
-    if(lv_style_is_empty(&com_style) == false) {
-        lv_style_reset(&com_style);
-        printf("Style reset\n");
-    }
+    // 共享样式由LVGL统一管理，页面重建时复用，无需释放
     
     // 移除事件回调
     lv_obj_remove_event_cb(lv_scr_act(), NULL);
@@ -433,13 +517,7 @@ static void saveas_btn_event_cb(lv_event_t * e)
     saveas_msgbox = lv_obj_create(lv_scr_act());
     lv_obj_set_size(saveas_msgbox, 240, 160);
     lv_obj_center(saveas_msgbox);  // 居中显示
-    lv_obj_set_style_bg_color(saveas_msgbox, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
-    lv_obj_set_style_border_color(saveas_msgbox, lv_color_hex(0x3498DB), LV_PART_MAIN);
-    lv_obj_set_style_border_width(saveas_msgbox, 2, LV_PART_MAIN);
-    lv_obj_set_style_radius(saveas_msgbox, 10, LV_PART_MAIN);
-    lv_obj_set_style_shadow_width(saveas_msgbox, 20, LV_PART_MAIN);
-    lv_obj_set_style_shadow_color(saveas_msgbox, lv_color_hex(0x000000), LV_PART_MAIN);
-    lv_obj_set_style_shadow_opa(saveas_msgbox, LV_OPA_50, LV_PART_MAIN);
+    msgbox_style_set(saveas_msgbox);
     lv_obj_clear_flag(saveas_msgbox, LV_OBJ_FLAG_SCROLLABLE);
     
     // 创建标题
@@ -447,27 +525,26 @@ static void saveas_btn_event_cb(lv_event_t * e)
     obj_font_set(title_label, FONT_TYPE_CN, 18);
     lv_label_set_text(title_label, "另存为");
     lv_obj_align(title_label, LV_ALIGN_TOP_MID, 0, -10);
-    lv_obj_set_style_text_color(title_label, lv_color_hex(0x333333), LV_PART_MAIN);
+    obj_text_color_set(title_label, 0x333333);
     
     // 创建内容区域（可以添加文件名输入框等）
     lv_obj_t *content_label = lv_label_create(saveas_msgbox);
     obj_font_set(content_label, FONT_TYPE_CN, 14);
     lv_label_set_text(content_label, "确认另存为新文件？");
     lv_obj_align(content_label, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_text_color(content_label, lv_color_hex(0x666666), LV_PART_MAIN);
+    obj_text_color_set(content_label, 0x666666);
     
     // 左下角：取消按钮
     lv_obj_t *cancel_btn = lv_btn_create(saveas_msgbox);
     lv_obj_set_size(cancel_btn, 70, 30);
     lv_obj_align(cancel_btn, LV_ALIGN_BOTTOM_LEFT, 15, -10);
-    lv_obj_set_style_bg_color(cancel_btn, lv_color_hex(0x95A5A6), LV_PART_MAIN);
-    lv_obj_set_style_radius(cancel_btn, 5, LV_PART_MAIN);
+    btn_style_set(cancel_btn, 0x95A5A6, 5);
     
     lv_obj_t *cancel_label = lv_label_create(cancel_btn);
     obj_font_set(cancel_label, FONT_TYPE_CN, 14);
     lv_label_set_text(cancel_label, "取消");
     lv_obj_center(cancel_label);
-    lv_obj_set_style_text_color(cancel_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    obj_text_color_set(cancel_label, 0xFFFFFF);
     
     lv_obj_add_event_cb(cancel_btn, saveas_cancel_cb, LV_EVENT_CLICKED, NULL);
     
@@ -475,14 +552,13 @@ static void saveas_btn_event_cb(lv_event_t * e)
     lv_obj_t *confirm_btn = lv_btn_create(saveas_msgbox);
     lv_obj_set_size(confirm_btn, 70, 30);
     lv_obj_align(confirm_btn, LV_ALIGN_BOTTOM_RIGHT, -15, -10);
-    lv_obj_set_style_bg_color(confirm_btn, lv_color_hex(0x3498DB), LV_PART_MAIN);
-    lv_obj_set_style_radius(confirm_btn, 5, LV_PART_MAIN);
+    btn_style_set(confirm_btn, 0x3498DB, 5);
     
     lv_obj_t *confirm_label = lv_label_create(confirm_btn);
     obj_font_set(confirm_label, FONT_TYPE_CN, 14);
     lv_label_set_text(confirm_label, "确认");
     lv_obj_center(confirm_label);
-    lv_obj_set_style_text_color(confirm_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    obj_text_color_set(confirm_label, 0xFFFFFF);
     
     lv_obj_add_event_cb(confirm_btn, saveas_confirm_cb, LV_EVENT_CLICKED, NULL);
     
@@ -506,13 +582,7 @@ static void switch_btn_event_cb(lv_event_t * e)
     history_msgbox = lv_obj_create(lv_scr_act());
     lv_obj_set_size(history_msgbox, 400, 260);
     lv_obj_center(history_msgbox);  // 居中显示
-    lv_obj_set_style_bg_color(history_msgbox, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
-    lv_obj_set_style_border_color(history_msgbox, lv_color_hex(0x3498DB), LV_PART_MAIN);
-    lv_obj_set_style_border_width(history_msgbox, 2, LV_PART_MAIN);
-    lv_obj_set_style_radius(history_msgbox, 10, LV_PART_MAIN);
-    lv_obj_set_style_shadow_width(history_msgbox, 20, LV_PART_MAIN);
-    lv_obj_set_style_shadow_color(history_msgbox, lv_color_hex(0x000000), LV_PART_MAIN);
-    lv_obj_set_style_shadow_opa(history_msgbox, LV_OPA_50, LV_PART_MAIN);
+    msgbox_style_set(history_msgbox);
     lv_obj_clear_flag(history_msgbox, LV_OBJ_FLAG_SCROLLABLE);
     
     // 创建标题
@@ -520,17 +590,13 @@ static void switch_btn_event_cb(lv_event_t * e)
     obj_font_set(title_label, FONT_TYPE_CN, 20);
     lv_label_set_text(title_label, "历史记录");
     lv_obj_align(title_label, LV_ALIGN_TOP_MID, 0, 5);
-    lv_obj_set_style_text_color(title_label, lv_color_hex(0x333333), LV_PART_MAIN);
+    obj_text_color_set(title_label, 0x333333);
     
     // 创建内容区域（可滚动列表）
     lv_obj_t *content_area = lv_obj_create(history_msgbox);
     lv_obj_set_size(content_area, 380, 180);
     lv_obj_align(content_area, LV_ALIGN_TOP_MID, 0, 35);
-    lv_obj_set_style_bg_color(content_area, lv_color_hex(0xF5F5F5), LV_PART_MAIN);
-    lv_obj_set_style_border_width(content_area, 1, LV_PART_MAIN);
-    lv_obj_set_style_border_color(content_area, lv_color_hex(0xCCCCCC), LV_PART_MAIN);
-    lv_obj_set_style_radius(content_area, 5, LV_PART_MAIN);
-    lv_obj_set_style_pad_all(content_area, 8, LV_PART_MAIN);
+    panel_style_set(content_area, 0xF5F5F5, 0xCCCCCC, 8);
     lv_obj_set_flex_flow(content_area, LV_FLEX_FLOW_COLUMN);  // 垂直排列
     lv_obj_set_flex_align(content_area, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
     
@@ -543,7 +609,7 @@ static void switch_btn_event_cb(lv_event_t * e)
         lv_obj_t *error_label = lv_label_create(content_area);
         obj_font_set(error_label, FONT_TYPE_CN, 16);
         lv_label_set_text(error_label, "无法读取目录");
-        lv_obj_set_style_text_color(error_label, lv_color_hex(0xFF0000), LV_PART_MAIN);
+        obj_text_color_set(error_label, 0xFF0000);
     } else {
         struct dirent *entry;
         int file_count = 0;
@@ -584,11 +650,7 @@ static void switch_btn_event_cb(lv_event_t * e)
             // 为每个文件创建一个容器（包含3行信息）
             lv_obj_t *file_item = lv_obj_create(content_area);
             lv_obj_set_size(file_item, 360, 75);
-            lv_obj_set_style_bg_color(file_item, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
-            lv_obj_set_style_border_width(file_item, 1, LV_PART_MAIN);
-            lv_obj_set_style_border_color(file_item, lv_color_hex(0xDDDDDD), LV_PART_MAIN);
-            lv_obj_set_style_radius(file_item, 5, LV_PART_MAIN);
-            lv_obj_set_style_pad_all(file_item, 5, LV_PART_MAIN);
+            panel_style_set(file_item, 0xFFFFFF, 0xDDDDDD, 5);
             lv_obj_clear_flag(file_item, LV_OBJ_FLAG_SCROLLABLE);
             
             // 第一行：文件名（带图标）
@@ -598,7 +660,7 @@ static void switch_btn_event_cb(lv_event_t * e)
             snprintf(filename_text, sizeof(filename_text), "📄 %s", entry->d_name);
             lv_label_set_text(filename_label, filename_text);
             lv_obj_align(filename_label, LV_ALIGN_TOP_LEFT, 0, 0);
-            lv_obj_set_style_text_color(filename_label, lv_color_hex(0x2C3E50), LV_PART_MAIN);
+            obj_text_color_set(filename_label, 0x2C3E50);
             
             // 第二行：内容预览
             lv_obj_t *preview_label = lv_label_create(file_item);
@@ -607,41 +669,39 @@ static void switch_btn_event_cb(lv_event_t * e)
             snprintf(preview_text, sizeof(preview_text), "%s...", preview);
             lv_label_set_text(preview_label, preview_text);
             lv_obj_align(preview_label, LV_ALIGN_TOP_LEFT, 0, 22);
-            lv_obj_set_style_text_color(preview_label, lv_color_hex(0x7F8C8D), LV_PART_MAIN);
+            obj_text_color_set(preview_label, 0x7F8C8D);
             
             // 第三行：编辑和删除按钮
             // 编辑按钮
             lv_obj_t *edit_btn = lv_btn_create(file_item);
             lv_obj_set_size(edit_btn, 60, 25);
             lv_obj_align(edit_btn, LV_ALIGN_BOTTOM_LEFT, 0, 0);
-            lv_obj_set_style_bg_color(edit_btn, lv_color_hex(0x3498DB), LV_PART_MAIN);
-            lv_obj_set_style_radius(edit_btn, 3, LV_PART_MAIN);
+            btn_style_set(edit_btn, 0x3498DB, 3);
             
             lv_obj_t *edit_label = lv_label_create(edit_btn);
             obj_font_set(edit_label, FONT_TYPE_CN, 14);
             lv_label_set_text(edit_label, "编辑");
             lv_obj_center(edit_label);
-            lv_obj_set_style_text_color(edit_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+            obj_text_color_set(edit_label, 0xFFFFFF);
             
             // 复制文件名到动态内存（因为entry->d_name在循环后会失效）
-            char *filename_copy_edit = strdup(entry->d_name);
+            char *filename_copy_edit = mem_track_strdup(MEM_TAG_UI, entry->d_name);
             lv_obj_add_event_cb(edit_btn, edit_file_cb, LV_EVENT_CLICKED, filename_copy_edit);
             
             // 删除按钮
             lv_obj_t *delete_btn = lv_btn_create(file_item);
             lv_obj_set_size(delete_btn, 60, 25);
             lv_obj_align(delete_btn, LV_ALIGN_BOTTOM_LEFT, 70, 0);
-            lv_obj_set_style_bg_color(delete_btn, lv_color_hex(0xE74C3C), LV_PART_MAIN);
-            lv_obj_set_style_radius(delete_btn, 3, LV_PART_MAIN);
+            btn_style_set(delete_btn, 0xE74C3C, 3);
             
             lv_obj_t *delete_label = lv_label_create(delete_btn);
             obj_font_set(delete_label, FONT_TYPE_CN, 14);
             lv_label_set_text(delete_label, "删除");
             lv_obj_center(delete_label);
-            lv_obj_set_style_text_color(delete_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+            obj_text_color_set(delete_label, 0xFFFFFF);
             
             // 复制文件名到动态内存（因为entry->d_name在循环后会失效）
-            char *filename_copy_delete = strdup(entry->d_name);
+            char *filename_copy_delete = mem_track_strdup(MEM_TAG_UI, entry->d_name);
             lv_obj_add_event_cb(delete_btn, delete_file_cb, LV_EVENT_CLICKED, filename_copy_delete);
             
             file_count++;
@@ -656,7 +716,7 @@ static void switch_btn_event_cb(lv_event_t * e)
             obj_font_set(placeholder, FONT_TYPE_CN, 16);
             lv_label_set_text(placeholder, "暂无历史记录");
             lv_obj_center(placeholder);
-            lv_obj_set_style_text_color(placeholder, lv_color_hex(0x999999), LV_PART_MAIN);
+            obj_text_color_set(placeholder, 0x999999);
         } else {
             printf("✅ Loaded %d history files\n", file_count);
         }
@@ -666,14 +726,13 @@ static void switch_btn_event_cb(lv_event_t * e)
     lv_obj_t *close_btn = lv_btn_create(history_msgbox);
     lv_obj_set_size(close_btn, 80, 35);
     lv_obj_align(close_btn, LV_ALIGN_BOTTOM_MID, 0, -10);
-    lv_obj_set_style_bg_color(close_btn, lv_color_hex(0xE74C3C), LV_PART_MAIN);
-    lv_obj_set_style_radius(close_btn, 5, LV_PART_MAIN);
+    btn_style_set(close_btn, 0xE74C3C, 5);
     
     lv_obj_t *close_label = lv_label_create(close_btn);
     obj_font_set(close_label, FONT_TYPE_CN, 16);
     lv_label_set_text(close_label, "关闭");
     lv_obj_center(close_label);
-    lv_obj_set_style_text_color(close_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    obj_text_color_set(close_label, 0xFFFFFF);
     
     lv_obj_add_event_cb(close_btn, close_history_msgbox_cb, LV_EVENT_CLICKED, NULL);
     
@@ -705,9 +764,11 @@ static void save_btn_event_cb(lv_event_t * e)
         // 获取当前文本编辑区内容
         const char *text = lv_textarea_get_text(textarea);
         
-        // 保存到缓存
-        strncpy(notebook_content, text, sizeof(notebook_content) - 1);
-        notebook_content[sizeof(notebook_content) - 1] = '\0';
+        // 保存到缓存（未编辑过时text就是缓存本身，无需复制）
+        if (text != notebook_content) {
+            strncpy(notebook_content, text, sizeof(notebook_content) - 1);
+            notebook_content[sizeof(notebook_content) - 1] = '\0';
+        }
         
         printf("Content to save: %s\n", notebook_content);
         
@@ -733,20 +794,23 @@ static void init_header_view(lv_obj_t *parent)
     lv_obj_t *header = lv_obj_create(parent);
     lv_obj_set_size(header, 1424, 60);
     lv_obj_align(header, LV_ALIGN_TOP_LEFT, 0, 0);
-    lv_obj_add_style(header, &com_style, LV_PART_MAIN);
+    lv_obj_add_style(header, com_style, LV_PART_MAIN);
     lv_obj_clear_flag(header, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_style_bg_color(header, lv_color_hex(0xF5F5F5), LV_PART_MAIN);
+    lv_obj_add_style(header, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BG_COLOR(lv_color_hex(0xF5F5F5)),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
     
     /* ========== 左侧：返回按钮 ========== */
     lv_obj_t *back_btn_cont = lv_obj_create(header);
     lv_obj_set_size(back_btn_cont, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
     lv_obj_align(back_btn_cont, LV_ALIGN_LEFT_MID, 10, 0);
-    lv_obj_add_style(back_btn_cont, &com_style, LV_PART_MAIN);
+    lv_obj_add_style(back_btn_cont, com_style, LV_PART_MAIN);
     lv_obj_add_flag(back_btn_cont, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_clear_flag(back_btn_cont, LV_OBJ_FLAG_SCROLLABLE);
     
     lv_obj_t *back_img = lv_img_create(back_btn_cont);
-    lv_img_set_src(back_img, GET_IMAGE_PATH("main/back.png"));
+    lv_img_set_src(back_img, IMG_BACK);
     lv_obj_align(back_img, LV_ALIGN_CENTER, 0, 0);
     
     lv_obj_add_event_cb(back_btn_cont, back_btn_event_cb, LV_EVENT_CLICKED, NULL);
@@ -754,23 +818,22 @@ static void init_header_view(lv_obj_t *parent)
     /* ========== 中间：标题 ========== */
     lv_obj_t *title_label = lv_label_create(header);
     obj_font_set(title_label, FONT_TYPE_CN, 24);
-    lv_label_set_text(title_label, "记事本");
+    lv_label_set_text(title_label, TEXT_TITLE);
     lv_obj_align(title_label, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_text_color(title_label, lv_color_hex(0x333333), LV_PART_MAIN);
+    obj_text_color_set(title_label, 0x333333);
     
     /* ========== 右侧：切换、取消和保存按钮 ========== */
     // 切换按钮
     lv_obj_t *switch_btn = lv_btn_create(header);
     lv_obj_set_size(switch_btn, 80, 40);
     lv_obj_align(switch_btn, LV_ALIGN_RIGHT_MID, -400, 0);
-    lv_obj_set_style_bg_color(switch_btn, lv_color_hex(0x9B59B6), LV_PART_MAIN);
-    lv_obj_set_style_radius(switch_btn, 5, LV_PART_MAIN);
+    btn_style_set(switch_btn, 0x9B59B6, 5);
     
     lv_obj_t *switch_label = lv_label_create(switch_btn);
     obj_font_set(switch_label, FONT_TYPE_CN, 18);
-    lv_label_set_text(switch_label, "切换");
+    lv_label_set_text(switch_label, TEXT_SWITCH);
     lv_obj_center(switch_label);
-    lv_obj_set_style_text_color(switch_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    obj_text_color_set(switch_label, 0xFFFFFF);
     
     lv_obj_add_event_cb(switch_btn, switch_btn_event_cb, LV_EVENT_CLICKED, NULL);
     
@@ -778,14 +841,13 @@ static void init_header_view(lv_obj_t *parent)
     lv_obj_t *cancel_btn = lv_btn_create(header);
     lv_obj_set_size(cancel_btn, 80, 40);
     lv_obj_align(cancel_btn, LV_ALIGN_RIGHT_MID, -320, 0);
-    lv_obj_set_style_bg_color(cancel_btn, lv_color_hex(0xE74C3C), LV_PART_MAIN);
-    lv_obj_set_style_radius(cancel_btn, 5, LV_PART_MAIN);
+    btn_style_set(cancel_btn, 0xE74C3C, 5);
     
     lv_obj_t *cancel_label = lv_label_create(cancel_btn);
     obj_font_set(cancel_label, FONT_TYPE_CN, 18);
-    lv_label_set_text(cancel_label, "清空");
+    lv_label_set_text(cancel_label, TEXT_CLEAR);
     lv_obj_center(cancel_label);
-    lv_obj_set_style_text_color(cancel_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    obj_text_color_set(cancel_label, 0xFFFFFF);
     
     lv_obj_add_event_cb(cancel_btn, cancel_btn_event_cb, LV_EVENT_CLICKED, NULL);
     
@@ -793,14 +855,13 @@ static void init_header_view(lv_obj_t *parent)
     lv_obj_t *save_btn = lv_btn_create(header);
     lv_obj_set_size(save_btn, 80, 40);
     lv_obj_align(save_btn, LV_ALIGN_RIGHT_MID, -150, 0);
-    lv_obj_set_style_bg_color(save_btn, lv_color_hex(0x4CAF50), LV_PART_MAIN);
-    lv_obj_set_style_radius(save_btn, 5, LV_PART_MAIN);
+    btn_style_set(save_btn, 0x4CAF50, 5);
     
     lv_obj_t *save_label = lv_label_create(save_btn);
     obj_font_set(save_label, FONT_TYPE_CN, 18);
-    lv_label_set_text(save_label, "保存");
+    lv_label_set_text(save_label, TEXT_SAVE);
     lv_obj_center(save_label);
-    lv_obj_set_style_text_color(save_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    obj_text_color_set(save_label, 0xFFFFFF);
     
     lv_obj_add_event_cb(save_btn, save_btn_event_cb, LV_EVENT_CLICKED, NULL);
     
@@ -808,14 +869,13 @@ static void init_header_view(lv_obj_t *parent)
     lv_obj_t *saveas_btn = lv_btn_create(header);
     lv_obj_set_size(saveas_btn, 80, 40);
     lv_obj_align(saveas_btn, LV_ALIGN_RIGHT_MID, -60, 0);
-    lv_obj_set_style_bg_color(saveas_btn, lv_color_hex(0x2ECC71), LV_PART_MAIN);
-    lv_obj_set_style_radius(saveas_btn, 5, LV_PART_MAIN);
+    btn_style_set(saveas_btn, 0x2ECC71, 5);
     
     lv_obj_t *saveas_label = lv_label_create(saveas_btn);
     obj_font_set(saveas_label, FONT_TYPE_CN, 18);
-    lv_label_set_text(saveas_label, "另存");
+    lv_label_set_text(saveas_label, TEXT_SAVEAS);
     lv_obj_center(saveas_label);
-    lv_obj_set_style_text_color(saveas_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    obj_text_color_set(saveas_label, 0xFFFFFF);
     
     lv_obj_add_event_cb(saveas_btn, saveas_btn_event_cb, LV_EVENT_CLICKED, NULL);
 }
@@ -829,7 +889,7 @@ static void init_content_view(lv_obj_t *parent)
     content_cont = lv_obj_create(parent);
     lv_obj_set_size(content_cont, 1424, 220);  // 总高度280 - 顶部60 = 220
     lv_obj_align(content_cont, LV_ALIGN_TOP_LEFT, 0, 60);
-    lv_obj_add_style(content_cont, &com_style, LV_PART_MAIN);
+    lv_obj_add_style(content_cont, com_style, LV_PART_MAIN);
     lv_obj_clear_flag(content_cont, LV_OBJ_FLAG_SCROLLABLE);
     
     // 创建文本编辑区（textarea）
@@ -841,18 +901,14 @@ static void init_content_view(lv_obj_t *parent)
     obj_font_set(textarea, FONT_TYPE_CN, 20);
     
     // 设置占位符文本
-    lv_textarea_set_placeholder_text(textarea, "在这里输入你的记事内容...");
+    lv_textarea_set_placeholder_text(textarea, TEXT_PLACEHOLDER);
     
-    // 设置文本内容（从缓存加载）
-    lv_textarea_set_text(textarea, notebook_content);
+    // 设置文本内容：直接引用缓存不复制，第一次编辑时textarea才复制一份（写时复制）
+    lv_textarea_set_text_static(textarea, notebook_content);
     
     // 设置样式
-    lv_obj_set_style_bg_color(textarea, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
-    lv_obj_set_style_border_color(textarea, lv_color_hex(0xCCCCCC), LV_PART_MAIN);
-    lv_obj_set_style_border_width(textarea, 1, LV_PART_MAIN);
-    lv_obj_set_style_radius(textarea, 5, LV_PART_MAIN);
-    lv_obj_set_style_pad_all(textarea, 10, LV_PART_MAIN);
-    lv_obj_set_style_text_color(textarea, lv_color_hex(0x333333), LV_PART_MAIN);
+    panel_style_set(textarea, 0xFFFFFF, 0xCCCCCC, 10);
+    obj_text_color_set(textarea, 0x333333);
     
     // 设置为单行模式（如果需要多行，注释掉下面这行）
     // lv_textarea_set_one_line(textarea, true);
@@ -882,22 +938,27 @@ static void init_keyboard_view(void)
     lv_keyboard_set_textarea(keyboard, textarea);
     
     // 设置键盘样式 - 浮动效果
-    lv_obj_set_style_bg_color(keyboard, lv_color_hex(0xECECEC), LV_PART_MAIN);
-    lv_obj_set_style_border_width(keyboard, 2, LV_PART_MAIN);
-    lv_obj_set_style_border_color(keyboard, lv_color_hex(0x3498DB), LV_PART_MAIN);
-    lv_obj_set_style_radius(keyboard, 8, LV_PART_MAIN);
-    lv_obj_set_style_shadow_width(keyboard, 15, LV_PART_MAIN);
-    lv_obj_set_style_shadow_color(keyboard, lv_color_hex(0x000000), LV_PART_MAIN);
-    lv_obj_set_style_shadow_opa(keyboard, LV_OPA_40, LV_PART_MAIN);
+    lv_obj_add_style(keyboard, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BG_COLOR(lv_color_hex(0xECECEC)),
+        LV_STYLE_CONST_BORDER_WIDTH(2),
+        LV_STYLE_CONST_BORDER_COLOR(lv_color_hex(0x3498DB)),
+        LV_STYLE_CONST_RADIUS(8),
+        LV_STYLE_CONST_SHADOW_WIDTH(15),
+        LV_STYLE_CONST_SHADOW_COLOR(lv_color_hex(0x000000)),
+        LV_STYLE_CONST_SHADOW_OPA(LV_OPA_40),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_MAIN);
     
     // 设置按键样式
-    lv_obj_set_style_bg_color(keyboard, lv_color_hex(0xFFFFFF), LV_PART_ITEMS);
-    lv_obj_set_style_text_color(keyboard, lv_color_hex(0x212529), LV_PART_ITEMS);
-    lv_obj_set_style_radius(keyboard, 5, LV_PART_ITEMS);
-    
-    // 设置键盘按键字体为Montserrat 14（包含符号图标）
+    // 按键字体为Montserrat 14（包含符号图标）
     // 这是解决退格键、回车键等特殊按键图标显示为矩形X的关键
-    lv_obj_set_style_text_font(keyboard, &lv_font_montserrat_14, LV_PART_ITEMS);
+    lv_obj_add_style(keyboard, lv_style_get_shared((lv_style_const_prop_t []) {
+        LV_STYLE_CONST_BG_COLOR(lv_color_hex(0xFFFFFF)),
+        LV_STYLE_CONST_TEXT_COLOR(lv_color_hex(0x212529)),
+        LV_STYLE_CONST_RADIUS(5),
+        LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_14),
+        {.prop = LV_STYLE_PROP_INV}
+    }), LV_PART_ITEMS);
     
     // 初始时隐藏键盘
     lv_obj_add_flag(keyboard, LV_OBJ_FLAG_HIDDEN);
@@ -911,6 +972,9 @@ static void init_keyboard_view(void)
  */
 void init_pageNotebook(void)
 {
+    page_prefetch_enter(&page_assets_notebook);
+    page_build_begin();
+
     printf("Initializing pageNotebook...\n");
     
     // 初始化样式
@@ -922,7 +986,7 @@ void init_pageNotebook(void)
     // 创建主容器
     lv_obj_t *main_cont = lv_obj_create(lv_scr_act());
     lv_obj_set_size(main_cont, 1424, 280);
-    lv_obj_add_style(main_cont, &com_style, LV_PART_MAIN);
+    lv_obj_add_style(main_cont, com_style, LV_PART_MAIN);
     lv_obj_clear_flag(main_cont, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_clear_flag(main_cont, LV_OBJ_FLAG_GESTURE_BUBBLE);
     
@@ -936,4 +1000,5 @@ void init_pageNotebook(void)
     init_keyboard_view();
     
     printf("pageNotebook initialized successfully\n");
+    page_build_end();
 }
@@ -4,10 +4,12 @@
 #ifdef SIMULATOR_LINUX
     #define FONT_PATH "./res/font/"
     #define IMAGE_PATH "./res/image/"
+    #define IMAGE_PACK_FILE "./res/image.pack"
     #define MUSIC_PATH "./build/app7/res/music/"
 #else
     #define FONT_PATH "/usr/res/font/"
     #define IMAGE_PATH "/usr/res/image/"
+    #define IMAGE_PACK_FILE "/usr/res/image.pack"
     #define MUSIC_PATH "/usr/res/music/"
 #endif
 
@@ -0,0 +1,246 @@
+/**
+ * @file ui_loop.c
+ * @brief UI主循环实现 - epoll + eventfd + timerfd
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include "ui_loop.h"
+
+/* ========== 类型定义 ========== */
+typedef struct {
+    int fd;                     // 文件描述符
+    ui_loop_fd_cb_t cb;         // 可读回调
+    void *user_data;            // 用户数据
+} ui_loop_src_t;
+
+typedef struct {
+    lv_indev_t *indev;          // LVGL输入设备
+    bool active;                // 本轮循环中有新输入
+} ui_loop_indev_t;
+
+/* ========== 全局变量 ========== */
+static int epoll_fd = -1;
+static int wakeup_fd = -1;      // eventfd：其他线程唤醒UI线程
+static int timer_fd = -1;       // timerfd：LVGL下一个定时器到期
+static ui_loop_src_t srcs[UI_LOOP_MAX_FD];
+static int src_cnt = 0;
+static ui_loop_indev_t indevs[UI_LOOP_MAX_FD];
+static int indev_cnt = 0;
+
+/* ========== 内部函数 ========== */
+
+/**
+ * @brief 把文件描述符加入epoll
+ */
+static int epoll_add(int fd, void *ptr)
+{
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.ptr = ptr;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+        perror("epoll_ctl");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 读空 eventfd/timerfd 的计数
+ */
+static void fd_drain(int fd)
+{
+    uint64_t cnt;
+    while (read(fd, &cnt, sizeof(cnt)) > 0) {
+    }
+}
+
+/**
+ * @brief 设置timerfd的超时时间
+ * @param ms 超时时间（毫秒），LV_NO_TIMER_READY 表示不再定时唤醒
+ */
+static void timer_arm(uint32_t ms)
+{
+    struct itimerspec its;
+    memset(&its, 0, sizeof(its));
+
+    if (ms != LV_NO_TIMER_READY) {
+        // 时间为0表示关闭timerfd，因此至少设置1纳秒
+        its.it_value.tv_sec = ms / 1000;
+        its.it_value.tv_nsec = (ms % 1000) * 1000000L;
+        if (ms == 0) its.it_value.tv_nsec = 1;
+    }
+
+    timerfd_settime(timer_fd, 0, &its, NULL);
+}
+
+/**
+ * @brief 输入设备有数据：恢复读取定时器并立即读取
+ */
+static void indev_fd_cb(int fd, void *user_data)
+{
+    (void)fd;
+    ui_loop_indev_t *ind = user_data;
+    lv_timer_t *read_timer = ind->indev->driver->read_timer;
+
+    ind->active = true;
+    lv_timer_resume(read_timer);
+    lv_timer_ready(read_timer);
+}
+
+/**
+ * @brief 松开且惯性滚动结束的输入设备暂停读取定时器，等待下次有输入再恢复
+ */
+static void indev_idle_check(void)
+{
+    for (int i = 0; i < indev_cnt; i++) {
+        ui_loop_indev_t *ind = &indevs[i];
+        if (ind->active) {
+            // 刚有输入的设备本轮已读取过，下一轮再判断
+            ind->active = false;
+            continue;
+        }
+
+        lv_indev_t *indev = ind->indev;
+        if (indev->proc.state != LV_INDEV_STATE_RELEASED) {
+            continue;
+        }
+        if (indev->driver->type == LV_INDEV_TYPE_POINTER &&
+            indev->proc.types.pointer.scroll_obj != NULL) {
+            // 惯性滚动需要读取定时器继续推进
+            continue;
+        }
+        lv_timer_pause(indev->driver->read_timer);
+    }
+}
+
+/* ========== API实现 ========== */
+
+/**
+ * @brief 初始化主循环
+ */
+int ui_loop_init(void)
+{
+    if (epoll_fd >= 0) {
+        return 0;
+    }
+
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (epoll_fd < 0 || wakeup_fd < 0 || timer_fd < 0) {
+        perror("ui_loop_init");
+        return -1;
+    }
+
+    // data.ptr 为 &wakeup_fd/&timer_fd 时表示内部事件，其余为 ui_loop_src_t
+    if (epoll_add(wakeup_fd, &wakeup_fd) != 0 || epoll_add(timer_fd, &timer_fd) != 0) {
+        return -1;
+    }
+
+    printf("✅ UI loop initialized (epoll)\n");
+    return 0;
+}
+
+/**
+ * @brief 注册文件描述符
+ */
+int ui_loop_add_fd(int fd, ui_loop_fd_cb_t cb, void *user_data)
+{
+    if (epoll_fd < 0 || fd < 0 || cb == NULL || src_cnt >= UI_LOOP_MAX_FD) {
+        return -1;
+    }
+
+    ui_loop_src_t *src = &srcs[src_cnt];
+    src->fd = fd;
+    src->cb = cb;
+    src->user_data = user_data;
+    if (epoll_add(fd, src) != 0) {
+        return -1;
+    }
+
+    src_cnt++;
+    return 0;
+}
+
+/**
+ * @brief 注册输入设备的文件描述符
+ */
+int ui_loop_add_indev(lv_indev_t *indev, int fd)
+{
+    if (indev == NULL || indev_cnt >= UI_LOOP_MAX_FD) {
+        return -1;
+    }
+
+    ui_loop_indev_t *ind = &indevs[indev_cnt];
+    ind->indev = indev;
+    ind->active = false;
+    if (ui_loop_add_fd(fd, indev_fd_cb, ind) != 0) {
+        return -1;
+    }
+
+    indev_cnt++;
+    return 0;
+}
+
+/**
+ * @brief 唤醒UI线程
+ */
+void ui_loop_wakeup(void)
+{
+    if (wakeup_fd < 0) {
+        return;
+    }
+
+    uint64_t one = 1;
+    if (write(wakeup_fd, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+        perror("ui_loop_wakeup");
+    }
+}
+
+/**
+ * @brief 运行主循环
+ */
+void ui_loop_run(ui_loop_wakeup_cb_t wakeup_cb)
+{
+    struct epoll_event events[UI_LOOP_MAX_FD + 2];
+
+    // 启动前可能已经有消息
+    if (wakeup_cb) wakeup_cb();
+
+    while (1) {
+        // 1. 处理LVGL定时器（刷屏、动画、输入设备读取等）
+        uint32_t time_till_next = lv_timer_handler();
+
+        // 2. 空闲的输入设备不再周期性读取
+        indev_idle_check();
+
+        // 3. 睡眠到下一个定时器到期，或被事件唤醒
+        timer_arm(time_till_next);
+        int n = epoll_wait(epoll_fd, events, UI_LOOP_MAX_FD + 2, -1);
+        if (n < 0) {
+            if (errno != EINTR) perror("epoll_wait");
+            continue;
+        }
+
+        for (int i = 0; i < n; i++) {
+            void *ptr = events[i].data.ptr;
+            if (ptr == &timer_fd) {
+                fd_drain(timer_fd);
+            } else if (ptr == &wakeup_fd) {
+                fd_drain(wakeup_fd);
+                if (wakeup_cb) wakeup_cb();
+            } else {
+                ui_loop_src_t *src = ptr;
+                src->cb(src->fd, src->user_data);
+            }
+        }
+    }
+}
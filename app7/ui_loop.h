@@ -0,0 +1,68 @@
+/**
+ * @file ui_loop.h
+ * @brief UI主循环 - 基于epoll的事件驱动主循环
+ * @note UI线程阻塞在epoll上，直到以下任一事件发生才被唤醒：
+ *       1. LVGL下一个定时器到期（timerfd，时间由 lv_timer_handler() 返回）
+ *       2. 其他线程调用 ui_loop_wakeup()（eventfd，如UI消息队列有新消息）
+ *       3. 注册的文件描述符可读（如触摸屏evdev有新输入）
+ *       屏幕空闲时不再每毫秒唤醒一次
+ */
+
+#ifndef _UI_LOOP_H_
+#define _UI_LOOP_H_
+
+#include "lvgl.h"
+
+/* 最多可注册的文件描述符数量 */
+#define UI_LOOP_MAX_FD  8
+
+/**
+ * @brief 文件描述符可读时的回调函数类型（在UI线程中调用）
+ * @param fd 可读的文件描述符
+ * @param user_data 注册时传入的用户数据
+ */
+typedef void (*ui_loop_fd_cb_t)(int fd, void *user_data);
+
+/**
+ * @brief 被 ui_loop_wakeup() 唤醒时的回调函数类型（在UI线程中调用）
+ */
+typedef void (*ui_loop_wakeup_cb_t)(void);
+
+/**
+ * @brief 初始化主循环（创建epoll、eventfd和timerfd）
+ * @return 0-成功，-1-失败
+ */
+int ui_loop_init(void);
+
+/**
+ * @brief 注册一个文件描述符，可读时在UI线程中调用回调函数
+ * @param fd 文件描述符
+ * @param cb 回调函数
+ * @param user_data 用户数据
+ * @return 0-成功，-1-失败
+ */
+int ui_loop_add_fd(int fd, ui_loop_fd_cb_t cb, void *user_data);
+
+/**
+ * @brief 注册输入设备的文件描述符（如触摸屏evdev）
+ * @param indev LVGL输入设备
+ * @param fd 输入设备的文件描述符
+ * @return 0-成功，-1-失败
+ * @note 有输入时立即读取输入设备，无需等待LVGL的读取周期；
+ *       松开且滚动结束后暂停读取定时器，空闲时不再周期性唤醒
+ */
+int ui_loop_add_indev(lv_indev_t *indev, int fd);
+
+/**
+ * @brief 唤醒UI线程（线程安全，可在任意线程中调用）
+ * @note 如：发送UI消息后、异步刷屏完成后调用
+ */
+void ui_loop_wakeup(void);
+
+/**
+ * @brief 运行主循环（不返回）
+ * @param wakeup_cb 被 ui_loop_wakeup() 唤醒时调用的函数（可传NULL），如处理UI消息队列
+ */
+void ui_loop_run(ui_loop_wakeup_cb_t wakeup_cb);
+
+#endif /* _UI_LOOP_H_ */
@@ -6,6 +6,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "ui_msg.h"
+#include "ui_loop.h"  // 发送消息后唤醒UI线程
 #include "osal_conf.h"   // OSAL_RESULT_T 等类型定义
 #include "osal_queue.h"  // component/osal 已在include路径中
 
@@ -54,6 +55,8 @@ int ui_msg_send(ui_msg_t *msg)
         return -1;
     }
     
+    // SysV消息队列无法被epoll监听，通过eventfd唤醒UI线程
+    ui_loop_wakeup();
     return 0;
 }
 
@@ -70,3 +73,14 @@ int ui_msg_recv(ui_msg_t *msg)
     OSAL_RESULT_T ret = osal_queue_recv(&g_ui_queue, msg, 0);
     return (ret == OSAL_SUCCESS) ? 0 : -1;
 }
+
+/**
+ * @brief 处理队列中的所有UI消息
+ */
+void ui_msg_process(void)
+{
+    ui_msg_t msg;
+    while (ui_msg_recv(&msg) == 0) {
+        ui_msg_handle(&msg);
+    }
+}
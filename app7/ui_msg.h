@@ -77,4 +77,9 @@ int ui_msg_recv(ui_msg_t *msg);
  */
 void ui_msg_handle(ui_msg_t *msg);
 
+/**
+ * @brief 处理队列中的所有UI消息（在主线程中调用，作为 ui_loop_run() 的唤醒回调）
+ */
+void ui_msg_process(void);
+
 #endif /* _UI_MSG_H_ */
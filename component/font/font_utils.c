@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "font_utils.h"
+#include "mem_track.h"
 
 typedef struct
 {
@@ -44,7 +45,7 @@ static lv_font_t* create_font_obj(int type, uint16_t size)
     if(font_type == NULL){
         return NULL;
     }
-    lv_ft_info_t* ft_info = malloc(sizeof(lv_ft_info_t));
+    lv_ft_info_t* ft_info = mem_track_malloc(MEM_TAG_FONT, sizeof(lv_ft_info_t));
     ft_info->name = font_type->font_url;
     ft_info->weight = size;
     ft_info->style = FT_FONT_STYLE_NORMAL;
@@ -82,5 +83,14 @@ lv_font_t* get_font(int type, uint16_t size)
         }
         font_obj = _lv_ll_get_next(&font_obj_list, font_obj);
     }
-    return create_font_obj(type, size);
+
+    // 字体一直缓存到退出，不能分配在页面的arena中（页面构建时也会创建字体）
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    lv_mem_arena_begin(NULL);
+#endif
+    lv_font_t* font = create_font_obj(type, size);
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    lv_mem_arena_end();
+#endif
+    return font;
 }
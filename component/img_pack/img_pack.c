@@ -0,0 +1,250 @@
+/**
+ * @file img_pack.c
+ * @brief 预解码图片资源包实现
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "img_pack.h"
+#include "mem_track.h"
+
+/* ========== 全局变量 ========== */
+
+static const uint8_t *pack_base = NULL;     // mmap的文件内容
+static size_t pack_size = 0;
+static const img_pack_hdr_t *pack_hdr = NULL;
+static const img_pack_entry_t *pack_entries = NULL;
+static const char *pack_names = NULL;
+static lv_img_dsc_t *pack_dscs = NULL;      // 与 pack_entries 一一对应，供 img_pack_get() 使用
+
+static char pack_prefix[32];
+static size_t pack_prefix_len = 0;
+static lv_img_decoder_t *pack_decoder = NULL;
+
+/* ========== 内部函数 ========== */
+
+/**
+ * @brief 按名字查找索引项
+ * @return 索引项下标，没有返回-1
+ */
+static int entry_find(const char *name)
+{
+    if (pack_hdr == NULL) return -1;
+
+    uint32_t hash = img_pack_hash(name);
+
+    // 二分查找第一个哈希相等的项
+    uint32_t lo = 0;
+    uint32_t hi = pack_hdr->entry_cnt;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if (pack_entries[mid].name_hash < hash) lo = mid + 1;
+        else hi = mid;
+    }
+
+    // 哈希冲突时逐个比较名字
+    for (uint32_t i = lo; i < pack_hdr->entry_cnt && pack_entries[i].name_hash == hash; i++) {
+        if (strcmp(pack_names + pack_entries[i].name_offset, name) == 0) return i;
+    }
+    return -1;
+}
+
+/**
+ * @brief 由图片路径查找索引项，路径不以前缀开头返回-1
+ */
+static int entry_find_src(const void *src)
+{
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_FILE) return -1;
+    if (strncmp(src, pack_prefix, pack_prefix_len) != 0) return -1;
+    return entry_find((const char *)src + pack_prefix_len);
+}
+
+/**
+ * @brief 检查文件头和索引，防止损坏或不完整的包越界访问
+ */
+static bool pack_check(const uint8_t *base, size_t size)
+{
+    if (size < sizeof(img_pack_hdr_t)) return false;
+
+    const img_pack_hdr_t *hdr = (const img_pack_hdr_t *)base;
+    if (hdr->magic != IMG_PACK_MAGIC || hdr->version != IMG_PACK_VERSION) {
+        printf("⚠️  Image pack: bad header\n");
+        return false;
+    }
+    if (hdr->color_depth != LV_COLOR_DEPTH ||
+        (LV_COLOR_DEPTH == 16 && !!(hdr->flags & IMG_PACK_FLAG_16_SWAP) != !!LV_COLOR_16_SWAP)) {
+        printf("⚠️  Image pack: packed for %u bit colors, LVGL uses %d bit\n", hdr->color_depth, LV_COLOR_DEPTH);
+        return false;
+    }
+    if (hdr->file_size != size ||
+        hdr->index_offset > size ||
+        hdr->entry_cnt > (size - hdr->index_offset) / sizeof(img_pack_entry_t) ||
+        hdr->names_offset >= size) {
+        printf("⚠️  Image pack: truncated file\n");
+        return false;
+    }
+
+    const img_pack_entry_t *entries = (const img_pack_entry_t *)(base + hdr->index_offset);
+    uint32_t px_size = LV_COLOR_SIZE / 8;
+    for (uint32_t i = 0; i < hdr->entry_cnt; i++) {
+        const img_pack_entry_t *e = &entries[i];
+        uint32_t px = e->cf == IMG_PACK_CF_TRUE_COLOR ? px_size : LV_IMG_PX_SIZE_ALPHA_BYTE;
+        if ((e->cf != IMG_PACK_CF_TRUE_COLOR && e->cf != IMG_PACK_CF_TRUE_COLOR_ALPHA) ||
+            e->data_size != (uint32_t)e->w * e->h * px ||
+            e->data_offset > size || e->data_size > size - e->data_offset ||
+            e->name_offset >= size - hdr->names_offset ||
+            memchr(base + hdr->names_offset + e->name_offset, '\0', size - hdr->names_offset - e->name_offset) == NULL ||
+            (i > 0 && e->name_hash < entries[i - 1].name_hash)) {
+            printf("⚠️  Image pack: bad entry %u\n", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 解码器：获取图片信息
+ */
+static lv_res_t decoder_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header)
+{
+    (void)decoder;
+
+    int idx = entry_find_src(src);
+    if (idx < 0) return LV_RES_INV;
+
+    const img_pack_entry_t *e = &pack_entries[idx];
+    header->always_zero = 0;
+    header->cf = e->cf;
+    header->w = e->w;
+    header->h = e->h;
+    return LV_RES_OK;
+}
+
+/**
+ * @brief 解码器：打开图片，直接指向mmap中的像素数据
+ */
+static lv_res_t decoder_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    (void)decoder;
+
+    int idx = entry_find_src(dsc->src);
+    if (idx < 0) return LV_RES_INV;
+
+    dsc->img_data = pack_base + pack_entries[idx].data_offset;
+    dsc->img_data_not_owned = 1;    // 像素在mmap中，不计入图片缓存的内存预算
+    return LV_RES_OK;
+}
+
+/**
+ * @brief 解码器：关闭图片，像素数据属于mmap，无需释放
+ */
+static void decoder_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    (void)decoder;
+    dsc->img_data = NULL;
+}
+
+/* ========== API实现 ========== */
+
+int img_pack_open(const char *path, const char *src_prefix)
+{
+    if (path == NULL || src_prefix == NULL || strlen(src_prefix) >= sizeof(pack_prefix)) return -1;
+
+    img_pack_close();
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("ℹ️  No image pack at %s, using PNG files\n", path);
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return -1;
+    }
+
+    // 只读映射：页面按需从文件读入，内存紧张时内核可直接丢弃
+    void *base = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        perror("img_pack_open");
+        return -1;
+    }
+
+    if (!pack_check(base, st.st_size)) {
+        munmap(base, st.st_size);
+        return -1;
+    }
+
+    const img_pack_hdr_t *hdr = base;
+    pack_dscs = mem_track_calloc(MEM_TAG_IMG_CACHE, hdr->entry_cnt ? hdr->entry_cnt : 1, sizeof(lv_img_dsc_t));
+    if (pack_dscs == NULL) {
+        munmap(base, st.st_size);
+        return -1;
+    }
+
+    pack_base = base;
+    pack_size = st.st_size;
+    pack_hdr = hdr;
+    pack_entries = (const img_pack_entry_t *)(pack_base + hdr->index_offset);
+    pack_names = (const char *)(pack_base + hdr->names_offset);
+
+    for (uint32_t i = 0; i < hdr->entry_cnt; i++) {
+        const img_pack_entry_t *e = &pack_entries[i];
+        pack_dscs[i].header.cf = e->cf;
+        pack_dscs[i].header.w = e->w;
+        pack_dscs[i].header.h = e->h;
+        pack_dscs[i].data_size = e->data_size;
+        pack_dscs[i].data = pack_base + e->data_offset;
+    }
+
+    strcpy(pack_prefix, src_prefix);
+    pack_prefix_len = strlen(src_prefix);
+
+    // 新建的解码器排在最前面，先于PNG解码器尝试
+    pack_decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(pack_decoder, decoder_info);
+    lv_img_decoder_set_open_cb(pack_decoder, decoder_open);
+    lv_img_decoder_set_close_cb(pack_decoder, decoder_close);
+
+    // 已缓存的PNG解码结果改由资源包提供
+    lv_img_cache_invalidate_src(NULL);
+
+    printf("✅ Image pack opened: %s (%u images, %u KB)\n", path, hdr->entry_cnt, (unsigned)(pack_size / 1024));
+    return 0;
+}
+
+void img_pack_close(void)
+{
+    if (pack_base == NULL) return;
+
+    // 先清空缓存，缓存中可能有指向mmap的图片
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_decoder_delete(pack_decoder);
+    pack_decoder = NULL;
+
+    munmap((void *)pack_base, pack_size);
+    mem_track_free(pack_dscs);
+    pack_base = NULL;
+    pack_size = 0;
+    pack_hdr = NULL;
+    pack_entries = NULL;
+    pack_names = NULL;
+    pack_dscs = NULL;
+}
+
+const lv_img_dsc_t *img_pack_get(const char *name)
+{
+    int idx = entry_find(name);
+    return idx < 0 ? NULL : &pack_dscs[idx];
+}
+
+bool img_pack_contains(const char *src)
+{
+    return entry_find_src(src) >= 0;
+}
@@ -0,0 +1,45 @@
+/**
+ * @file img_pack.h
+ * @brief 预解码图片资源包 - 把PNG图片离线解码打包，运行时mmap直接显示
+ * @note 用法：用 tools/img_pack.py 把 res/image 打包成 image.pack，
+ *       启动时调用 img_pack_open(包路径, "A:res/image/")。
+ *       之后 lv_img_set_src(img, "A:res/image/menu/menu_music.png") 这类路径
+ *       会直接使用包里的像素数据：不读文件、不解压、不占用LVGL堆。
+ *       包里没有的图片（或包打开失败）仍由PNG解码器照常处理。
+ */
+
+#ifndef _IMG_PACK_H_
+#define _IMG_PACK_H_
+
+#include <stdbool.h>
+#include "lvgl/lvgl.h"
+#include "img_pack_fmt.h"
+
+/**
+ * @brief 打开资源包并注册图片解码器（在UI线程、lv_init之后调用）
+ * @param path 资源包文件路径
+ * @param src_prefix 图片路径前缀，去掉前缀后即包内名字，如 "A:res/image/"
+ * @return 0-成功，-1-失败（文件不存在、格式或颜色深度不匹配）
+ */
+int img_pack_open(const char *path, const char *src_prefix);
+
+/**
+ * @brief 关闭资源包，之后的图片回到PNG解码
+ * @note 会清空LVGL图片缓存；仍在显示包内图片的控件需要重新设置图片
+ */
+void img_pack_close(void);
+
+/**
+ * @brief 获取包内图片的描述符，可直接用于 lv_img_set_src()
+ * @param name 包内名字，如 "menu/menu_music.png"
+ * @return 描述符（像素数据指向mmap内存），没有返回NULL
+ */
+const lv_img_dsc_t *img_pack_get(const char *name);
+
+/**
+ * @brief 判断图片路径是否由资源包提供
+ * @param src 图片路径，如 "A:res/image/menu/menu_music.png"
+ */
+bool img_pack_contains(const char *src);
+
+#endif /* _IMG_PACK_H_ */
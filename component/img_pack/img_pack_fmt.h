@@ -0,0 +1,66 @@
+/**
+ * @file img_pack_fmt.h
+ * @brief 图片资源包文件格式 - 打包工具 tools/img_pack.py 与设备端 img_pack.c 共用
+ * @note 文件布局：
+ *       img_pack_hdr_t
+ *       entry_cnt 个 img_pack_entry_t（按 name_hash 升序，可二分查找）
+ *       名字区：以'\0'结尾的相对路径，如 "menu/menu_music.png"
+ *       像素数据：每张图 IMG_PACK_ALIGN 字节对齐，已是LVGL的本机颜色格式，可直接显示
+ *       所有字段为小端（T113与x86均为小端）
+ */
+
+#ifndef _IMG_PACK_FMT_H_
+#define _IMG_PACK_FMT_H_
+
+#include <stdint.h>
+
+#define IMG_PACK_MAGIC      0x4B504749U     // "IGPK"
+#define IMG_PACK_VERSION    1
+#define IMG_PACK_ALIGN      64              // 像素数据对齐（cache line）
+
+/* img_pack_hdr_t.flags */
+#define IMG_PACK_FLAG_16_SWAP   0x01        // 16位颜色高低字节交换（LV_COLOR_16_SWAP）
+
+/* img_pack_entry_t.cf，与LVGL的 lv_img_cf_t 取值相同 */
+#define IMG_PACK_CF_TRUE_COLOR          4   // 不透明图片，省去alpha混合
+#define IMG_PACK_CF_TRUE_COLOR_ALPHA    5
+
+/* ========== 文件头 ========== */
+typedef struct {
+    uint32_t magic;         // IMG_PACK_MAGIC
+    uint16_t version;       // IMG_PACK_VERSION
+    uint8_t color_depth;    // 像素数据的颜色深度，须与 LV_COLOR_DEPTH 相同
+    uint8_t flags;          // IMG_PACK_FLAG_*
+    uint32_t entry_cnt;     // 图片数量
+    uint32_t index_offset;  // img_pack_entry_t 数组的位置
+    uint32_t names_offset;  // 名字区的位置
+    uint32_t file_size;     // 文件总大小，用于检查文件是否完整
+    uint32_t reserved[2];
+} img_pack_hdr_t;
+
+/* ========== 索引项 ========== */
+typedef struct {
+    uint32_t name_hash;     // 名字的 FNV-1a 哈希，见 img_pack_hash()
+    uint32_t name_offset;   // 名字相对名字区的偏移
+    uint32_t data_offset;   // 像素数据相对文件开头的偏移
+    uint32_t data_size;     // 像素数据字节数
+    uint16_t w;             // 宽
+    uint16_t h;             // 高
+    uint8_t cf;             // IMG_PACK_CF_*
+    uint8_t reserved[3];
+} img_pack_entry_t;
+
+/**
+ * @brief 名字的 FNV-1a 哈希（打包工具中有相同的实现）
+ */
+static inline uint32_t img_pack_hash(const char *name)
+{
+    uint32_t h = 2166136261U;
+    while (*name) {
+        h ^= (uint8_t)*name++;
+        h *= 16777619U;
+    }
+    return h;
+}
+
+#endif /* _IMG_PACK_FMT_H_ */
@@ -0,0 +1,291 @@
+#!/usr/bin/env python3
+"""
+图片资源包打包工具 - 把目录下的PNG离线解码成LVGL本机颜色格式，打包成一个文件
+
+用法：
+    img_pack.py [--depth 32|16] [--swap16] -o image.pack <图片目录>
+
+包内名字为相对图片目录的路径，如 "menu/menu_music.png"，
+设备端 img_pack_open(包路径, "A:res/image/") 后按原路径显示即可。
+文件格式见 ../img_pack_fmt.h。只依赖Python标准库。
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+IMG_PACK_MAGIC = 0x4B504749
+IMG_PACK_VERSION = 1
+IMG_PACK_ALIGN = 64
+IMG_PACK_FLAG_16_SWAP = 0x01
+IMG_PACK_CF_TRUE_COLOR = 4
+IMG_PACK_CF_TRUE_COLOR_ALPHA = 5
+
+HDR_FMT = '<IHBBIIII8x'         # img_pack_hdr_t
+ENTRY_FMT = '<IIIIHHB3x'        # img_pack_entry_t
+
+PNG_SIGNATURE = b'\x89PNG\r\n\x1a\n'
+PNG_CHANNELS = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}
+
+
+def img_pack_hash(name):
+    """FNV-1a，与 img_pack_fmt.h 中的 img_pack_hash() 相同"""
+    h = 2166136261
+    for b in name.encode('utf-8'):
+        h ^= b
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def unfilter(data, w, h, bpp, stride):
+    """还原PNG扫描行滤波，返回去掉滤波字节的原始数据"""
+    out = bytearray(stride * h)
+    prev = bytearray(stride)
+    pos = 0
+    for y in range(h):
+        ftype = data[pos]
+        line = bytearray(data[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        if ftype == 1:      # Sub
+            for i in range(bpp, stride):
+                line[i] = (line[i] + line[i - bpp]) & 0xFF
+        elif ftype == 2:    # Up
+            for i in range(stride):
+                line[i] = (line[i] + prev[i]) & 0xFF
+        elif ftype == 3:    # Average
+            for i in range(stride):
+                left = line[i - bpp] if i >= bpp else 0
+                line[i] = (line[i] + ((left + prev[i]) >> 1)) & 0xFF
+        elif ftype == 4:    # Paeth
+            for i in range(stride):
+                a = line[i - bpp] if i >= bpp else 0
+                b = prev[i]
+                c = prev[i - bpp] if i >= bpp else 0
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                if pa <= pb and pa <= pc:
+                    pr = a
+                elif pb <= pc:
+                    pr = b
+                else:
+                    pr = c
+                line[i] = (line[i] + pr) & 0xFF
+        elif ftype != 0:
+            raise ValueError('bad filter type %d' % ftype)
+        out[y * stride:(y + 1) * stride] = line
+        prev = line
+    return out
+
+
+def png_decode(path):
+    """解码PNG为RGBA8，返回 (w, h, rgba)。与lodepng_decode32结果相同"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != PNG_SIGNATURE:
+        raise ValueError('not a PNG file')
+
+    pos = 8
+    ihdr = None
+    idat = bytearray()
+    palette = None
+    trns = None
+    while pos + 8 <= len(data):
+        length, ctype = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b'IHDR':
+            ihdr = struct.unpack('>IIBBBBB', body)
+        elif ctype == b'PLTE':
+            palette = body
+        elif ctype == b'tRNS':
+            trns = body
+        elif ctype == b'IDAT':
+            idat += body
+        elif ctype == b'IEND':
+            break
+
+    if ihdr is None:
+        raise ValueError('no IHDR chunk')
+    w, h, depth, color, _, _, interlace = ihdr
+    if interlace:
+        raise ValueError('interlaced PNG is not supported')
+    if color not in PNG_CHANNELS:
+        raise ValueError('bad color type %d' % color)
+
+    ch = PNG_CHANNELS[color]
+    bits = ch * depth
+    bpp = max(1, bits // 8)
+    stride = (w * bits + 7) // 8
+    raw = unfilter(zlib.decompress(bytes(idat)), w, h, bpp, stride)
+
+    # 取出每个像素的各通道值（16位只保留高字节，低于8位的灰度扩展到0..255）
+    def samples(y):
+        line = raw[y * stride:(y + 1) * stride]
+        if depth == 8:
+            return line
+        if depth == 16:
+            return line[0::2]
+        out = bytearray(w * ch)
+        mask = (1 << depth) - 1
+        for i in range(w * ch):
+            bit = i * depth
+            out[i] = (line[bit >> 3] >> (8 - depth - (bit & 7))) & mask
+        return out
+
+    key = None
+    if trns is not None and color in (0, 2):
+        key = struct.unpack('>%dH' % (len(trns) // 2), trns)
+
+    rgba = bytearray(w * h * 4)
+    o = 0
+    for y in range(h):
+        s = samples(y)
+        for x in range(w):
+            if color == 6:
+                r, g, b, a = s[x * 4:x * 4 + 4]
+            elif color == 2:
+                r, g, b = s[x * 3:x * 3 + 3]
+                a = 255
+                if key is not None:
+                    k = raw_key_match(raw, y, x, stride, depth, 3)
+                    if k == key:
+                        a = 0
+            elif color == 4:
+                r = g = b = s[x * 2]
+                a = s[x * 2 + 1]
+            elif color == 0:
+                v = s[x]
+                a = 255
+                if key is not None and raw_key_match(raw, y, x, stride, depth, 1) == key:
+                    a = 0
+                if depth < 8:
+                    v = v * 255 // ((1 << depth) - 1)
+                r = g = b = v
+            else:
+                i = s[x]
+                if palette is None or i * 3 + 2 >= len(palette):
+                    raise ValueError('palette index out of range')
+                r, g, b = palette[i * 3:i * 3 + 3]
+                a = trns[i] if trns is not None and i < len(trns) else 255
+            rgba[o:o + 4] = bytes((r, g, b, a))
+            o += 4
+    return w, h, rgba
+
+
+def raw_key_match(raw, y, x, stride, depth, ch):
+    """读取像素的原始通道值（含16位全精度），用于和tRNS颜色键比较"""
+    if depth == 16:
+        p = y * stride + x * ch * 2
+        return struct.unpack('>%dH' % ch, raw[p:p + ch * 2])
+    if depth == 8:
+        p = y * stride + x * ch
+        return tuple(raw[p:p + ch])
+    bit = x * depth
+    v = (raw[y * stride + (bit >> 3)] >> (8 - depth - (bit & 7))) & ((1 << depth) - 1)
+    return (v,)
+
+
+def convert(rgba, depth, swap16):
+    """RGBA8转换为LVGL本机颜色格式，与lv_png.c的convert_color_depth()相同
+    全不透明的图片转为 TRUE_COLOR（无alpha），返回 (cf, data)"""
+    opaque = all(a == 255 for a in rgba[3::4])
+    px_cnt = len(rgba) // 4
+
+    if depth == 32:
+        out = bytearray(rgba)
+        out[0::4] = rgba[2::4]      # B
+        out[2::4] = rgba[0::4]      # R
+        if opaque:
+            return IMG_PACK_CF_TRUE_COLOR, out
+        return IMG_PACK_CF_TRUE_COLOR_ALPHA, out
+
+    # 16位：RGB565，可选高低字节交换，带alpha时每像素后跟1字节alpha
+    px_size = 2 if opaque else 3
+    out = bytearray(px_cnt * px_size)
+    for i in range(px_cnt):
+        r, g, b, a = rgba[i * 4:i * 4 + 4]
+        c = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        if swap16:
+            c = ((c & 0xFF) << 8) | (c >> 8)
+        o = i * px_size
+        out[o] = c & 0xFF
+        out[o + 1] = c >> 8
+        if not opaque:
+            out[o + 2] = a
+    return (IMG_PACK_CF_TRUE_COLOR if opaque else IMG_PACK_CF_TRUE_COLOR_ALPHA), out
+
+
+def align(n):
+    return (n + IMG_PACK_ALIGN - 1) // IMG_PACK_ALIGN * IMG_PACK_ALIGN
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack PNG images into a pre-decoded LVGL image pack')
+    parser.add_argument('dir', help='image directory, names in the pack are relative to it')
+    parser.add_argument('-o', '--output', required=True, help='output pack file')
+    parser.add_argument('--depth', type=int, default=32, choices=(32, 16), help='LV_COLOR_DEPTH of the device')
+    parser.add_argument('--swap16', action='store_true', help='LV_COLOR_16_SWAP of the device')
+    args = parser.parse_args()
+
+    images = []
+    for root, _, files in os.walk(args.dir):
+        for fn in files:
+            if not fn.lower().endswith('.png'):
+                continue
+            path = os.path.join(root, fn)
+            name = os.path.relpath(path, args.dir).replace(os.sep, '/')
+            try:
+                w, h, rgba = png_decode(path)
+            except (ValueError, zlib.error, struct.error) as e:
+                # 跳过的图片在设备上仍由PNG解码器处理
+                print('skip %s: %s' % (name, e), file=sys.stderr)
+                continue
+            if w > 2047 or h > 2047:
+                print('skip %s: larger than 2047 px' % name, file=sys.stderr)
+                continue
+            cf, data = convert(rgba, args.depth, args.swap16)
+            images.append((img_pack_hash(name), name, w, h, cf, data))
+
+    images.sort(key=lambda img: (img[0], img[1]))
+
+    hdr_size = struct.calcsize(HDR_FMT)
+    entry_size = struct.calcsize(ENTRY_FMT)
+    index_offset = hdr_size
+    names_offset = index_offset + entry_size * len(images)
+
+    names = bytearray()
+    name_offsets = []
+    for img in images:
+        name_offsets.append(len(names))
+        names += img[1].encode('utf-8') + b'\0'
+
+    data_offset = align(names_offset + len(names))
+    entries = bytearray()
+    blobs = bytearray()
+    for img, name_offset in zip(images, name_offsets):
+        name_hash, _, w, h, cf, data = img
+        off = data_offset + len(blobs)
+        entries += struct.pack(ENTRY_FMT, name_hash, name_offset, off, len(data), w, h, cf)
+        blobs += data
+        blobs += b'\0' * (align(len(blobs)) - len(blobs))
+
+    file_size = data_offset + len(blobs)
+    flags = IMG_PACK_FLAG_16_SWAP if args.depth == 16 and args.swap16 else 0
+    hdr = struct.pack(HDR_FMT, IMG_PACK_MAGIC, IMG_PACK_VERSION, args.depth, flags,
+                      len(images), index_offset, names_offset, file_size)
+
+    out = hdr + entries + names
+    out += b'\0' * (data_offset - len(out))
+    out += blobs
+
+    tmp = args.output + '.tmp'
+    with open(tmp, 'wb') as f:
+        f.write(out)
+    os.replace(tmp, args.output)
+    print('%s: %d images, %d KB' % (args.output, len(images), file_size // 1024))
+
+
+if __name__ == '__main__':
+    main()
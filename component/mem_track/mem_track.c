@@ -0,0 +1,331 @@
+/**
+ * @file mem_track.c
+ * @brief 带标签的内存分配统计实现
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "lvgl/lvgl.h"
+#include "mem_track.h"
+
+/* ========== 类型定义 ========== */
+
+/* 每块内存前的头，16字节以保持malloc的对齐 */
+typedef struct {
+    uint32_t size;          // 用户申请的大小
+    uint16_t site;          // 分配点下标
+    uint8_t tag;            // mem_tag_t
+    uint8_t magic;          // BLK_MAGIC，释放后清零
+    uint32_t reserved[2];
+} blk_hdr_t;
+
+/* 分配点（文件:行号） */
+typedef struct {
+    const char *file;       // NULL表示空位，写入后不再改变
+    uint32_t line;
+    uint8_t tag;
+    uint32_t cur_bytes;
+    uint32_t cur_cnt;
+    uint32_t alloc_cnt;
+} site_t;
+
+#define BLK_MAGIC       0xA5
+#define SITE_OVERFLOW   "(overflow)"    // 分配点表满后，新分配点记到其标签的这个分配点
+
+/* ========== 全局变量 ========== */
+
+/* 前 MEM_TAG_MAX 个位置是各标签的溢出分配点 */
+static site_t sites[MEM_TRACK_SITE_MAX] = {
+    [MEM_TAG_UI]        = {SITE_OVERFLOW, 0, MEM_TAG_UI},
+    [MEM_TAG_FONT]      = {SITE_OVERFLOW, 0, MEM_TAG_FONT},
+    [MEM_TAG_IMG_CACHE] = {SITE_OVERFLOW, 0, MEM_TAG_IMG_CACHE},
+    [MEM_TAG_NET]       = {SITE_OVERFLOW, 0, MEM_TAG_NET},
+    [MEM_TAG_LOG]       = {SITE_OVERFLOW, 0, MEM_TAG_LOG},
+    [MEM_TAG_OTHER]     = {SITE_OVERFLOW, 0, MEM_TAG_OTHER},
+};
+static mem_track_tag_stat_t tag_stats[MEM_TAG_MAX];    // 由 tag_stats_update() 汇总
+static pthread_mutex_t site_mutex = PTHREAD_MUTEX_INITIALIZER;  // 新增分配点和汇总时使用
+
+static char snap_path[128];
+static uint32_t snap_seq = 0;
+static lv_timer_t *snap_timer = NULL;
+
+/* ========== 内部函数 ========== */
+
+/**
+ * @brief 查找或新增分配点
+ * @return 分配点下标
+ */
+static uint16_t site_get(mem_tag_t tag, const char *file, int line)
+{
+    // 同一个分配点的 __FILE__ 是同一个字符串常量，直接比较指针
+    uint32_t h = ((uint32_t)line * 2654435761U) ^ (uint32_t)((uintptr_t)file >> 3);
+
+    for (uint32_t probe = 0; probe < MEM_TRACK_SITE_MAX; probe++) {
+        uint32_t idx = (h + probe) & (MEM_TRACK_SITE_MAX - 1);
+        site_t *s = &sites[idx];
+        const char *f = __atomic_load_n(&s->file, __ATOMIC_ACQUIRE);
+
+        if (f == NULL) {
+            // 空位：加锁后再确认一次，其他线程可能刚刚占用
+            pthread_mutex_lock(&site_mutex);
+            f = s->file;
+            if (f == NULL) {
+                s->line = line;
+                s->tag = tag;
+                __atomic_store_n(&s->file, file, __ATOMIC_RELEASE);
+                pthread_mutex_unlock(&site_mutex);
+                return idx;
+            }
+            pthread_mutex_unlock(&site_mutex);
+        }
+
+        if (f == file && s->line == (uint32_t)line) {
+            return idx;
+        }
+    }
+
+    return tag;
+}
+
+/**
+ * @brief 记录一次分配
+ */
+static void account_alloc(blk_hdr_t *hdr, mem_tag_t tag, uint16_t site, uint32_t size)
+{
+    hdr->size = size;
+    hdr->site = site;
+    hdr->tag = tag;
+    hdr->magic = BLK_MAGIC;
+
+    site_t *s = &sites[site];
+    __atomic_fetch_add(&s->cur_bytes, size, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&s->cur_cnt, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&s->alloc_cnt, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief 记录一次释放
+ */
+static void account_free(const blk_hdr_t *hdr)
+{
+    site_t *s = &sites[hdr->site];
+    __atomic_fetch_sub(&s->cur_bytes, hdr->size, __ATOMIC_RELAXED);
+    __atomic_fetch_sub(&s->cur_cnt, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief 从用户指针取得块头，不是本模块分配的返回NULL
+ */
+static blk_hdr_t *hdr_get(void *p)
+{
+    blk_hdr_t *hdr = (blk_hdr_t *)p - 1;
+    if (hdr->magic != BLK_MAGIC) {
+        fprintf(stderr, "mem_track: %p is not a tracked block (double free?)\n", p);
+        return NULL;
+    }
+    return hdr;
+}
+
+/**
+ * @brief 把各分配点的计数按标签汇总到 tag_stats
+ * @note 分配时只更新分配点的计数，标签的统计在读取时汇总，少做一半原子操作。
+ *       因此峰值是各次汇总时的最大值
+ */
+static void tag_stats_update(void)
+{
+    mem_track_tag_stat_t sum[MEM_TAG_MAX];
+    memset(sum, 0, sizeof(sum));
+
+    for (int i = 0; i < MEM_TRACK_SITE_MAX; i++) {
+        const site_t *s = &sites[i];
+        if (s->file == NULL) continue;
+        sum[s->tag].cur_bytes += s->cur_bytes;
+        sum[s->tag].cur_cnt += s->cur_cnt;
+        sum[s->tag].alloc_cnt += s->alloc_cnt;
+    }
+
+    pthread_mutex_lock(&site_mutex);
+    for (int t = 0; t < MEM_TAG_MAX; t++) {
+        sum[t].peak_bytes = tag_stats[t].peak_bytes;
+        if (sum[t].cur_bytes > sum[t].peak_bytes) sum[t].peak_bytes = sum[t].cur_bytes;
+        tag_stats[t] = sum[t];
+    }
+    pthread_mutex_unlock(&site_mutex);
+}
+
+/**
+ * @brief 快照定时器回调
+ */
+static void snap_timer_cb(lv_timer_t *timer)
+{
+    (void)timer;
+    mem_track_snapshot();
+}
+
+/* ========== API实现 ========== */
+
+void *mem_track_alloc_at(mem_tag_t tag, size_t size, const char *file, int line)
+{
+    if (tag >= MEM_TAG_MAX) tag = MEM_TAG_OTHER;
+
+    blk_hdr_t *hdr = malloc(sizeof(blk_hdr_t) + size);
+    if (hdr == NULL) return NULL;
+
+    account_alloc(hdr, tag, site_get(tag, file, line), size);
+    return hdr + 1;
+}
+
+void *mem_track_calloc_at(mem_tag_t tag, size_t n, size_t size, const char *file, int line)
+{
+    if (size != 0 && n > SIZE_MAX / size) return NULL;
+
+    void *p = mem_track_alloc_at(tag, n * size, file, line);
+    if (p) memset(p, 0, n * size);
+    return p;
+}
+
+void *mem_track_realloc_at(mem_tag_t tag, void *p, size_t size, const char *file, int line)
+{
+    if (p == NULL) return mem_track_alloc_at(tag, size, file, line);
+    if (tag >= MEM_TAG_MAX) tag = MEM_TAG_OTHER;
+
+    blk_hdr_t *hdr = hdr_get(p);
+    if (hdr == NULL) return NULL;
+
+    // 失败时原内存保持不变，所以先分配成功再修改统计
+    blk_hdr_t old = *hdr;
+    blk_hdr_t *new_hdr = realloc(hdr, sizeof(blk_hdr_t) + size);
+    if (new_hdr == NULL) return NULL;
+
+    account_free(&old);
+    account_alloc(new_hdr, tag, site_get(tag, file, line), size);
+    return new_hdr + 1;
+}
+
+char *mem_track_strdup_at(mem_tag_t tag, const char *s, const char *file, int line)
+{
+    size_t len = strlen(s) + 1;
+    char *p = mem_track_alloc_at(tag, len, file, line);
+    if (p) memcpy(p, s, len);
+    return p;
+}
+
+void mem_track_free_at(void *p)
+{
+    if (p == NULL) return;
+
+    blk_hdr_t *hdr = hdr_get(p);
+    if (hdr == NULL) return;
+
+    account_free(hdr);
+    hdr->magic = 0;
+    free(hdr);
+}
+
+void mem_track_get_tag_stat(mem_tag_t tag, mem_track_tag_stat_t *stat)
+{
+    if (tag >= MEM_TAG_MAX) {
+        memset(stat, 0, sizeof(*stat));
+        return;
+    }
+    tag_stats_update();
+    *stat = tag_stats[tag];
+}
+
+int mem_track_snapshot(void)
+{
+    if (snap_path[0] == '\0') return -1;
+
+    FILE *fp = fopen(snap_path, "ab");
+    if (fp == NULL) {
+        perror("mem_track_snapshot");
+        return -1;
+    }
+
+    // 文件过大：保留上一份为 .old，重新开始
+    fseek(fp, 0, SEEK_END);
+    if (ftell(fp) > MEM_TRACK_FILE_MAX) {
+        char old_path[sizeof(snap_path) + 4];
+        fclose(fp);
+        snprintf(old_path, sizeof(old_path), "%s.old", snap_path);
+        rename(snap_path, old_path);
+        fp = fopen(snap_path, "wb");
+        if (fp == NULL) {
+            perror("mem_track_snapshot");
+            return -1;
+        }
+    }
+
+    mem_track_snap_hdr_t hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = MEM_TRACK_MAGIC;
+    hdr.version = MEM_TRACK_VERSION;
+    hdr.seq = snap_seq++;
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    hdr.uptime_s = ts.tv_sec;
+    hdr.time = time(NULL);
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    hdr.lv_total = mon.total_size;
+    hdr.lv_free = mon.free_size;
+    hdr.lv_biggest = mon.free_biggest_size;
+    hdr.lv_max_used = mon.max_used;
+    hdr.lv_frag_pct = mon.frag_pct;
+
+    tag_stats_update();
+    memcpy(hdr.tags, tag_stats, sizeof(hdr.tags));
+
+    for (int i = 0; i < MEM_TRACK_SITE_MAX; i++) {
+        if (sites[i].file && sites[i].alloc_cnt) hdr.site_cnt++;
+    }
+    fwrite(&hdr, sizeof(hdr), 1, fp);
+
+    for (int i = 0; i < MEM_TRACK_SITE_MAX; i++) {
+        site_t *s = &sites[i];
+        if (s->file == NULL || s->alloc_cnt == 0) continue;
+
+        // 只保存文件名，不含路径
+        const char *name = strrchr(s->file, '/');
+        name = name ? name + 1 : s->file;
+        size_t name_len = strlen(name);
+        if (name_len > 255) name_len = 255;
+
+        mem_track_site_rec_t rec;
+        memset(&rec, 0, sizeof(rec));
+        rec.line = s->line;
+        rec.tag = s->tag;
+        rec.name_len = name_len;
+        rec.cur_bytes = s->cur_bytes;
+        rec.cur_cnt = s->cur_cnt;
+        rec.alloc_cnt = s->alloc_cnt;
+        fwrite(&rec, sizeof(rec), 1, fp);
+        fwrite(name, 1, name_len, fp);
+    }
+
+    fclose(fp);
+    return 0;
+}
+
+int mem_track_start(const char *path, uint32_t period_ms)
+{
+    if (path == NULL || strlen(path) >= sizeof(snap_path)) return -1;
+    strcpy(snap_path, path);
+
+    if (snap_timer == NULL) {
+        snap_timer = lv_timer_create(snap_timer_cb, period_ms, NULL);
+        if (snap_timer == NULL) return -1;
+    } else {
+        lv_timer_set_period(snap_timer, period_ms);
+    }
+
+    printf("✅ Memory tracking started: %s every %us\n", snap_path, period_ms / 1000);
+    // 启动时先写一次，作为对比的基准
+    return mem_track_snapshot();
+}
@@ -0,0 +1,97 @@
+/**
+ * @file mem_track.h
+ * @brief 带标签的内存分配统计 - 用于长时间运行时排查内存泄漏和增长
+ * @note 用法：把 malloc/realloc/free 换成 mem_track_malloc(tag, size) 等宏，
+ *       每次分配都按 标签 和 分配点（文件:行号）计数。
+ *       mem_track_start() 定期把统计写入快照文件，用 tools/mem_track_diff 对比两次快照
+ *       即可看出哪个模块、哪一行的内存在增长。
+ *       每次分配只多16字节头和几次原子加减，不加锁。
+ */
+
+#ifndef _MEM_TRACK_H_
+#define _MEM_TRACK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "mem_track_fmt.h"
+
+/* 0-关闭统计，宏直接调用 malloc/free */
+#ifndef MEM_TRACK_ENABLE
+#define MEM_TRACK_ENABLE    1
+#endif
+
+/* 最多统计的分配点数量（2的幂），超出后记到标签的公共分配点 */
+#define MEM_TRACK_SITE_MAX  256
+
+/* 快照文件超过此大小后改名为 .old 并重新开始 */
+#define MEM_TRACK_FILE_MAX  (256 * 1024)
+
+#if MEM_TRACK_ENABLE
+
+#define mem_track_malloc(tag, size)     mem_track_alloc_at((tag), (size), __FILE__, __LINE__)
+#define mem_track_calloc(tag, n, size)  mem_track_calloc_at((tag), (n), (size), __FILE__, __LINE__)
+#define mem_track_realloc(tag, p, size) mem_track_realloc_at((tag), (p), (size), __FILE__, __LINE__)
+#define mem_track_strdup(tag, s)        mem_track_strdup_at((tag), (s), __FILE__, __LINE__)
+#define mem_track_free(p)               mem_track_free_at(p)
+
+#else
+
+#include <stdlib.h>
+#include <string.h>
+#define mem_track_malloc(tag, size)     malloc(size)
+#define mem_track_calloc(tag, n, size)  calloc((n), (size))
+#define mem_track_realloc(tag, p, size) realloc((p), (size))
+#define mem_track_strdup(tag, s)        strdup(s)
+#define mem_track_free(p)               free(p)
+
+#endif
+
+/**
+ * @brief 分配内存并记到 tag 和 file:line 下（通过 mem_track_malloc 宏调用）
+ * @return 内存指针，失败返回NULL
+ */
+void *mem_track_alloc_at(mem_tag_t tag, size_t size, const char *file, int line);
+
+/**
+ * @brief 分配并清零（通过 mem_track_calloc 宏调用）
+ */
+void *mem_track_calloc_at(mem_tag_t tag, size_t n, size_t size, const char *file, int line);
+
+/**
+ * @brief 重新分配，内存改记到本次调用的分配点（通过 mem_track_realloc 宏调用）
+ * @note p 必须来自 mem_track_* 分配，可为NULL
+ */
+void *mem_track_realloc_at(mem_tag_t tag, void *p, size_t size, const char *file, int line);
+
+/**
+ * @brief 复制字符串（通过 mem_track_strdup 宏调用）
+ */
+char *mem_track_strdup_at(mem_tag_t tag, const char *s, const char *file, int line);
+
+/**
+ * @brief 释放 mem_track_* 分配的内存，可为NULL
+ */
+void mem_track_free_at(void *p);
+
+/**
+ * @brief 获取某个标签的当前统计
+ * @param tag 标签
+ * @param stat 输出统计
+ */
+void mem_track_get_tag_stat(mem_tag_t tag, mem_track_tag_stat_t *stat);
+
+/**
+ * @brief 立即写一次快照（在UI线程调用，会读取LVGL堆状态）
+ * @return 0-成功，-1-失败
+ */
+int mem_track_snapshot(void);
+
+/**
+ * @brief 开始定期写快照（在UI线程调用，使用LVGL定时器）
+ * @param path 快照文件路径，快照追加到文件末尾
+ * @param period_ms 快照周期（毫秒）
+ * @return 0-成功，-1-失败
+ */
+int mem_track_start(const char *path, uint32_t period_ms);
+
+#endif /* _MEM_TRACK_H_ */
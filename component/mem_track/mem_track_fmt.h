@@ -0,0 +1,66 @@
+/**
+ * @file mem_track_fmt.h
+ * @brief 内存快照文件格式 - 设备端 mem_track.c 与分析工具 mem_track_diff.c 共用
+ * @note 文件由若干快照依次追加组成，每个快照：
+ *       mem_track_snap_hdr_t + site_cnt 个 (mem_track_site_rec_t + name_len 字节的文件名)
+ *       所有字段为设备本机字节序（T113与x86均为小端）
+ */
+
+#ifndef _MEM_TRACK_FMT_H_
+#define _MEM_TRACK_FMT_H_
+
+#include <stdint.h>
+
+#define MEM_TRACK_MAGIC     0x4B544D4DU     // "MMTK"
+#define MEM_TRACK_VERSION   1
+
+/* ========== 内存标签 ========== */
+typedef enum {
+    MEM_TAG_UI = 0,         // 界面（页面、控件附带的数据）
+    MEM_TAG_FONT,           // 字体
+    MEM_TAG_IMG_CACHE,      // 图片缓存
+    MEM_TAG_NET,            // 网络请求
+    MEM_TAG_LOG,            // 日志
+    MEM_TAG_OTHER,          // 其他
+    MEM_TAG_MAX
+} mem_tag_t;
+
+/* ========== 单个标签的统计 ========== */
+typedef struct {
+    uint32_t cur_bytes;     // 当前占用字节数
+    uint32_t cur_cnt;       // 当前未释放的块数
+    uint32_t peak_bytes;    // 占用峰值
+    uint32_t alloc_cnt;     // 累计分配次数
+} mem_track_tag_stat_t;
+
+/* ========== 快照头 ========== */
+typedef struct {
+    uint32_t magic;         // MEM_TRACK_MAGIC
+    uint16_t version;       // MEM_TRACK_VERSION
+    uint16_t site_cnt;      // 后面跟随的分配点记录数
+    uint32_t seq;           // 快照序号（本次运行内递增）
+    uint32_t uptime_s;      // 开机以来的秒数
+    uint32_t time;          // 时间戳（秒）
+
+    /* LVGL堆（lv_mem）的状态 */
+    uint32_t lv_total;      // 总大小
+    uint32_t lv_free;       // 空闲字节数
+    uint32_t lv_biggest;    // 最大空闲块
+    uint32_t lv_max_used;   // 使用峰值
+    uint32_t lv_frag_pct;   // 碎片率（%）
+
+    mem_track_tag_stat_t tags[MEM_TAG_MAX];
+} mem_track_snap_hdr_t;
+
+/* ========== 分配点记录（后跟 name_len 字节的文件名，无结束符） ========== */
+typedef struct {
+    uint32_t line;          // 行号
+    uint8_t tag;            // mem_tag_t
+    uint8_t name_len;       // 文件名长度
+    uint16_t reserved;
+    uint32_t cur_bytes;     // 当前占用字节数
+    uint32_t cur_cnt;       // 当前未释放的块数
+    uint32_t alloc_cnt;     // 累计分配次数
+} mem_track_site_rec_t;
+
+#endif /* _MEM_TRACK_FMT_H_ */
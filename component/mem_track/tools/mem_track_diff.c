@@ -0,0 +1,221 @@
+/**
+ * @file mem_track_diff.c
+ * @brief 内存快照对比工具 - 找出两次快照之间增长的模块和分配点
+ * @note 可在PC上或设备上运行：
+ *       mem_track_diff <快照文件> [起始序号] [结束序号]
+ *       序号为文件中第几个快照（从0开始），负数表示倒数第几个；
+ *       默认对比第一个和最后一个快照
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../mem_track_fmt.h"
+
+/* 最多显示的增长分配点数量 */
+#define TOP_SITE_CNT    20
+
+/* ========== 类型定义 ========== */
+typedef struct {
+    mem_track_site_rec_t rec;
+    char name[256];
+} site_t;
+
+typedef struct {
+    mem_track_snap_hdr_t hdr;
+    site_t *sites;
+} snap_t;
+
+typedef struct {
+    const site_t *from;     // 起始快照中的记录，没有为NULL
+    const site_t *to;       // 结束快照中的记录，没有为NULL
+    long long growth;       // 占用字节数的增长
+} site_diff_t;
+
+static const char *tag_names[MEM_TAG_MAX] = {"UI", "FONT", "IMG_CACHE", "NET", "LOG", "OTHER"};
+
+/* ========== 内部函数 ========== */
+
+/**
+ * @brief 读取文件中的所有快照
+ * @return 快照数量，出错返回-1
+ */
+static int load_snaps(const char *path, snap_t **out)
+{
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) {
+        perror(path);
+        return -1;
+    }
+
+    snap_t *snaps = NULL;
+    int cnt = 0;
+    mem_track_snap_hdr_t hdr;
+    while (fread(&hdr, sizeof(hdr), 1, fp) == 1) {
+        if (hdr.magic != MEM_TRACK_MAGIC || hdr.version != MEM_TRACK_VERSION) {
+            fprintf(stderr, "snapshot %d: bad header, stop reading\n", cnt);
+            break;
+        }
+
+        site_t *sites = calloc(hdr.site_cnt ? hdr.site_cnt : 1, sizeof(site_t));
+        int ok = sites != NULL;
+        for (int i = 0; ok && i < hdr.site_cnt; i++) {
+            ok = fread(&sites[i].rec, sizeof(sites[i].rec), 1, fp) == 1 &&
+                 fread(sites[i].name, 1, sites[i].rec.name_len, fp) == sites[i].rec.name_len;
+        }
+        if (!ok) {
+            fprintf(stderr, "snapshot %d: truncated, stop reading\n", cnt);
+            free(sites);
+            break;
+        }
+
+        snap_t *tmp = realloc(snaps, (cnt + 1) * sizeof(snap_t));
+        if (tmp == NULL) {
+            free(sites);
+            break;
+        }
+        snaps = tmp;
+        snaps[cnt].hdr = hdr;
+        snaps[cnt].sites = sites;
+        cnt++;
+    }
+
+    fclose(fp);
+    *out = snaps;
+    return cnt;
+}
+
+/**
+ * @brief 同一个分配点：文件名、行号和标签都相同
+ */
+static int site_same(const site_t *a, const site_t *b)
+{
+    return a->rec.line == b->rec.line && a->rec.tag == b->rec.tag && strcmp(a->name, b->name) == 0;
+}
+
+/**
+ * @brief 按增长从大到小排序
+ */
+static int diff_cmp(const void *a, const void *b)
+{
+    long long ga = ((const site_diff_t *)a)->growth;
+    long long gb = ((const site_diff_t *)b)->growth;
+    return (ga < gb) - (ga > gb);
+}
+
+/**
+ * @brief 打印一个快照的概况
+ */
+static void print_snap(int idx, const snap_t *s)
+{
+    uint32_t total = 0;
+    for (int t = 0; t < MEM_TAG_MAX; t++) total += s->hdr.tags[t].cur_bytes;
+    printf("#%-3d seq %-5u uptime %8us  lvgl used %8u frag %3u%% biggest %8u  tracked %8u\n",
+           idx, s->hdr.seq, s->hdr.uptime_s, s->hdr.lv_total - s->hdr.lv_free, s->hdr.lv_frag_pct,
+           s->hdr.lv_biggest, total);
+}
+
+/**
+ * @brief 对比两个快照
+ */
+static void diff_snaps(const snap_t *a, const snap_t *b)
+{
+    printf("\n=== %us -> %us (%us) ===\n", a->hdr.uptime_s, b->hdr.uptime_s, b->hdr.uptime_s - a->hdr.uptime_s);
+    if (b->hdr.seq < a->hdr.seq) {
+        printf("⚠️  the device restarted between the snapshots, the counters were reset\n");
+    }
+
+    long long lv_a = (long long)a->hdr.lv_total - a->hdr.lv_free;
+    long long lv_b = (long long)b->hdr.lv_total - b->hdr.lv_free;
+    printf("LVGL heap: used %+lld bytes, frag %u%% -> %u%%, biggest free %u -> %u\n",
+           lv_b - lv_a, a->hdr.lv_frag_pct, b->hdr.lv_frag_pct, a->hdr.lv_biggest, b->hdr.lv_biggest);
+
+    printf("\n%-10s %12s %10s %12s %12s\n", "tag", "bytes", "blocks", "allocs", "peak");
+    for (int t = 0; t < MEM_TAG_MAX; t++) {
+        const mem_track_tag_stat_t *ta = &a->hdr.tags[t];
+        const mem_track_tag_stat_t *tb = &b->hdr.tags[t];
+        printf("%-10s %+12lld %+10lld %12u %12u\n", tag_names[t],
+               (long long)tb->cur_bytes - ta->cur_bytes, (long long)tb->cur_cnt - ta->cur_cnt,
+               tb->alloc_cnt - ta->alloc_cnt, tb->peak_bytes);
+    }
+
+    // 以结束快照为准匹配起始快照中的分配点，再加上只在起始快照中出现的
+    int cnt = 0;
+    site_diff_t *diffs = calloc(b->hdr.site_cnt + a->hdr.site_cnt + 1, sizeof(site_diff_t));
+    if (diffs == NULL) return;
+
+    for (int i = 0; i < b->hdr.site_cnt; i++) {
+        const site_t *sb = &b->sites[i];
+        const site_t *sa = NULL;
+        for (int j = 0; j < a->hdr.site_cnt; j++) {
+            if (site_same(&a->sites[j], sb)) {
+                sa = &a->sites[j];
+                break;
+            }
+        }
+        diffs[cnt].from = sa;
+        diffs[cnt].to = sb;
+        diffs[cnt].growth = (long long)sb->rec.cur_bytes - (sa ? sa->rec.cur_bytes : 0);
+        cnt++;
+    }
+    for (int j = 0; j < a->hdr.site_cnt; j++) {
+        int found = 0;
+        for (int i = 0; i < b->hdr.site_cnt && !found; i++) found = site_same(&a->sites[j], &b->sites[i]);
+        if (found) continue;
+        diffs[cnt].from = &a->sites[j];
+        diffs[cnt].to = NULL;
+        diffs[cnt].growth = -(long long)a->sites[j].rec.cur_bytes;
+        cnt++;
+    }
+
+    qsort(diffs, cnt, sizeof(site_diff_t), diff_cmp);
+
+    printf("\nGrowing allocation sites:\n");
+    printf("%-32s %-10s %12s %10s %10s\n", "site", "tag", "bytes", "blocks", "now");
+    int shown = 0;
+    for (int i = 0; i < cnt && shown < TOP_SITE_CNT; i++) {
+        if (diffs[i].growth <= 0) break;
+        const site_t *s = diffs[i].to;
+        char site_name[300];
+        snprintf(site_name, sizeof(site_name), "%s:%u", s->name, s->rec.line);
+        long long blocks = (long long)s->rec.cur_cnt - (diffs[i].from ? diffs[i].from->rec.cur_cnt : 0);
+        printf("%-32s %-10s %+12lld %+10lld %10u\n", site_name,
+               s->rec.tag < MEM_TAG_MAX ? tag_names[s->rec.tag] : "?", diffs[i].growth, blocks, s->rec.cur_bytes);
+        shown++;
+    }
+    if (shown == 0) printf("(none)\n");
+
+    free(diffs);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <snapshot file> [from] [to]\n", argv[0]);
+        return 1;
+    }
+
+    snap_t *snaps = NULL;
+    int cnt = load_snaps(argv[1], &snaps);
+    if (cnt <= 0) {
+        fprintf(stderr, "no snapshots in %s\n", argv[1]);
+        return 1;
+    }
+
+    for (int i = 0; i < cnt; i++) print_snap(i, &snaps[i]);
+
+    int from = argc > 2 ? atoi(argv[2]) : 0;
+    int to = argc > 3 ? atoi(argv[3]) : cnt - 1;
+    if (from < 0) from += cnt;
+    if (to < 0) to += cnt;
+    if (from < 0 || from >= cnt || to < 0 || to >= cnt) {
+        fprintf(stderr, "snapshot index out of range (0..%d)\n", cnt - 1);
+        return 1;
+    }
+
+    diff_snaps(&snaps[from], &snaps[to]);
+
+    for (int i = 0; i < cnt; i++) free(snaps[i].sites);
+    free(snaps);
+    return 0;
+}
@@ -14,6 +14,9 @@
  *********************/
 #define MY_CLASS &lv_obj_class
 
+/*Bit of an event code in `event_mask`. Codes not fitting into the mask share the last bit*/
+#define EVENT_MASK_BIT(code)    ((uint64_t)1 << LV_MIN((code) & ~LV_EVENT_PREPROCESS, 63))
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -29,6 +32,8 @@ typedef struct _lv_event_dsc_t {
 static lv_event_dsc_t * lv_obj_get_event_dsc(const lv_obj_t * obj, uint32_t id);
 static lv_res_t event_send_core(lv_event_t * e);
 static bool event_is_bubbled(lv_event_t * e);
+static void refresh_event_mask(lv_obj_t * obj);
+static inline bool has_event_cb(const lv_obj_t * obj, lv_event_code_t code);
 
 /**********************
  *  STATIC VARIABLES
@@ -169,6 +174,9 @@ struct _lv_event_dsc_t * lv_obj_add_event_cb(lv_obj_t * obj, lv_event_cb_t event
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].filter = filter;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].user_data = user_data;
 
+    if((filter & ~LV_EVENT_PREPROCESS) == LV_EVENT_ALL) obj->spec_attr->event_mask = UINT64_MAX;
+    else obj->spec_attr->event_mask |= EVENT_MASK_BIT(filter);
+
     return &obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1];
 }
 
@@ -188,6 +196,7 @@ bool lv_obj_remove_event_cb(lv_obj_t * obj, lv_event_cb_t event_cb)
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            refresh_event_mask(obj);
             return true;
         }
     }
@@ -213,6 +222,7 @@ bool lv_obj_remove_event_cb_with_user_data(lv_obj_t * obj, lv_event_cb_t event_c
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            refresh_event_mask(obj);
             return true;
         }
     }
@@ -237,6 +247,7 @@ bool lv_obj_remove_event_dsc(lv_obj_t * obj, struct _lv_event_dsc_t * event_dsc)
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            refresh_event_mask(obj);
             return true;
         }
     }
@@ -257,6 +268,20 @@ void * lv_obj_get_event_user_data(struct _lv_obj_t * obj, lv_event_cb_t event_cb
     return NULL;
 }
 
+bool _lv_obj_has_event_cb_in_range(const struct _lv_obj_t * obj, lv_event_code_t first, lv_event_code_t last)
+{
+    if(obj->spec_attr == NULL) return false;
+    if(obj->spec_attr->event_mask == 0) return false;
+
+    int32_t i = 0;
+    for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
+        lv_event_code_t filter = obj->spec_attr->event_dsc[i].filter & ~LV_EVENT_PREPROCESS;
+        if(filter == LV_EVENT_ALL) return true;
+        if(filter >= first && filter <= last) return true;
+    }
+    return false;
+}
+
 lv_indev_t * lv_event_get_indev(lv_event_t * e)
 {
 
@@ -430,7 +455,11 @@ static lv_res_t event_send_core(lv_event_t * e)
     }
 
     lv_res_t res = LV_RES_OK;
-    lv_event_dsc_t * event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
+
+    /*Most of the events (e.g. the drawing related ones) have no user callbacks at all.
+     *Don't look for them in the callback array.*/
+    lv_event_dsc_t * event_dsc = NULL;
+    if(has_event_cb(e->current_target, e->code)) event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
 
     uint32_t i = 0;
     while(event_dsc && res == LV_RES_OK) {
@@ -451,7 +480,10 @@ static lv_res_t event_send_core(lv_event_t * e)
 
     res = lv_obj_event_base(NULL, e);
 
-    event_dsc = res == LV_RES_INV ? NULL : lv_obj_get_event_dsc(e->current_target, 0);
+    event_dsc = NULL;
+    if(res == LV_RES_OK && has_event_cb(e->current_target, e->code)) {
+        event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
+    }
 
     i = 0;
     while(event_dsc && res == LV_RES_OK) {
@@ -478,6 +510,38 @@ static lv_res_t event_send_core(lv_event_t * e)
     return res;
 }
 
+/**
+ * Recalculate the mask of the event codes having callbacks after removing a callback
+ * @param obj       pointer to an object
+ */
+static void refresh_event_mask(lv_obj_t * obj)
+{
+    uint64_t mask = 0;
+    uint32_t i;
+    for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
+        lv_event_code_t filter = obj->spec_attr->event_dsc[i].filter;
+        if((filter & ~LV_EVENT_PREPROCESS) == LV_EVENT_ALL) {
+            mask = UINT64_MAX;
+            break;
+        }
+        mask |= EVENT_MASK_BIT(filter);
+    }
+
+    obj->spec_attr->event_mask = mask;
+}
+
+/**
+ * Check if an object might have a callback for an event code
+ * @param obj       pointer to an object
+ * @param code      an event code, `LV_EVENT_PREPROCESS` is ignored
+ * @return          false: surely no callback; true: there might be callback(s)
+ */
+static inline bool has_event_cb(const lv_obj_t * obj, lv_event_code_t code)
+{
+    if(obj->spec_attr == NULL) return false;
+    return (obj->spec_attr->event_mask & EVENT_MASK_BIT(code)) != 0;
+}
+
 static bool event_is_bubbled(lv_event_t * e)
 {
     if(e->stop_bubbling) return false;
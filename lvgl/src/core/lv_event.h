@@ -270,6 +270,16 @@ bool lv_obj_remove_event_dsc(struct _lv_obj_t * obj, struct _lv_event_dsc_t * ev
  */
 void * lv_obj_get_event_user_data(struct _lv_obj_t * obj, lv_event_cb_t event_cb);
 
+/**
+ * Check if an object has an event callback for any of the given event codes.
+ * Callbacks added with `LV_EVENT_ALL` match every code.
+ * @param obj               pointer to an object
+ * @param first             the first event code to check
+ * @param last              the last event code to check (inclusive)
+ * @return                  true: there is such a callback
+ */
+bool _lv_obj_has_event_cb_in_range(const struct _lv_obj_t * obj, lv_event_code_t first, lv_event_code_t last);
+
 /**
  * Get the input device passed as parameter to indev related events.
  * @param e     pointer to an event
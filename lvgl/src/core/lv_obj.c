@@ -65,6 +65,7 @@ static void draw_scrollbar(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static lv_res_t scrollbar_init_draw_dsc(lv_obj_t * obj, lv_draw_rect_dsc_t * dsc);
 static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_find);
 static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state);
+static bool state_diff_only_on_scrollbar(lv_obj_t * obj, lv_state_t state1, lv_state_t state2);
 
 /**********************
  *  STATIC VARIABLES
@@ -78,6 +79,7 @@ const lv_obj_class_t lv_obj_class = {
     .height_def = LV_DPI_DEF,
     .editable = LV_OBJ_CLASS_EDITABLE_FALSE,
     .group_def = LV_OBJ_CLASS_GROUP_DEF_FALSE,
+    .scroll_copy = 1,
     .instance_size = (sizeof(lv_obj_t)),
     .base_class = NULL,
 };
@@ -137,7 +139,12 @@ void lv_init(void)
     PXP_COND_STOP(!lv_gpu_nxp_pxp_init(), "PXP init failed.");
 #endif
 
+    _lv_style_shared_init();
     _lv_obj_style_init();
+#if LV_USE_ANIM_BATCH
+    /*Refresh the style of the animated objects once per animation step*/
+    _lv_anim_set_frame_cb(_lv_obj_style_refr_batch_begin, _lv_obj_style_refr_batch_end);
+#endif
     _lv_ll_init(&LV_GC_ROOT(_lv_disp_ll), sizeof(lv_disp_t));
     _lv_ll_init(&LV_GC_ROOT(_lv_indev_ll), sizeof(lv_indev_t));
 
@@ -251,8 +258,8 @@ void lv_obj_add_flag(lv_obj_t * obj, lv_obj_flag_t f)
     }
 
     if((was_on_layout != lv_obj_is_layout_positioned(obj)) || (f & (LV_OBJ_FLAG_LAYOUT_1 |  LV_OBJ_FLAG_LAYOUT_2))) {
-        lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
-        lv_obj_mark_layout_as_dirty(obj);
+        _lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
+        _lv_obj_mark_layout_as_dirty(obj);
     }
 
     if(f & LV_OBJ_FLAG_SCROLLABLE) {
@@ -280,13 +287,13 @@ void lv_obj_clear_flag(lv_obj_t * obj, lv_obj_flag_t f)
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
         if(lv_obj_is_layout_positioned(obj)) {
-            lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
-            lv_obj_mark_layout_as_dirty(obj);
+            _lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
+            _lv_obj_mark_layout_as_dirty(obj);
         }
     }
 
     if((was_on_layout != lv_obj_is_layout_positioned(obj)) || (f & (LV_OBJ_FLAG_LAYOUT_1 |  LV_OBJ_FLAG_LAYOUT_2))) {
-        lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
+        _lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
     }
 
 }
@@ -458,6 +465,17 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_remove_style_all(obj);
     lv_obj_enable_style_refresh(true);
 
+    /*A new object might be allocated on the same address*/
+    _lv_obj_style_cache_invalidate_obj(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
+#if LV_USE_ANIM_BATCH
+    _lv_obj_style_refr_batch_remove(obj);
+#endif
+
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    /*Close the arena owned by the object. Its chunks are freed with their last block.*/
+    lv_mem_arena_release(obj);
+#endif
+
     /*Remove the animations from this object*/
     lv_anim_del(obj, NULL);
 
@@ -474,6 +492,12 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
             lv_mem_free(obj->spec_attr->event_dsc);
             obj->spec_attr->event_dsc = NULL;
         }
+#if LV_USE_LAYOUT_CACHE
+        if(obj->spec_attr->layout_cache) {
+            lv_mem_free(obj->spec_attr->layout_cache);
+            obj->spec_attr->layout_cache = NULL;
+        }
+#endif
 
         lv_mem_free(obj->spec_attr);
         obj->spec_attr = NULL;
@@ -749,7 +773,7 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e)
         uint32_t child_cnt = lv_obj_get_child_cnt(obj);
         for(uint32_t i = 0; i < child_cnt; i++) {
             lv_obj_t * child = obj->spec_attr->children[i];
-            lv_obj_mark_layout_as_dirty(child);
+            _lv_obj_mark_layout_as_dirty(child);
         }
     }
     else if(code == LV_EVENT_KEY) {
@@ -842,14 +866,14 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e)
         lv_coord_t align = lv_obj_get_style_align(obj, LV_PART_MAIN);
         uint16_t layout = lv_obj_get_style_layout(obj, LV_PART_MAIN);
         if(layout || align) {
-            lv_obj_mark_layout_as_dirty(obj);
+            _lv_obj_mark_layout_as_dirty(obj);
         }
 
         uint32_t i;
         uint32_t child_cnt = lv_obj_get_child_cnt(obj);
         for(i = 0; i < child_cnt; i++) {
             lv_obj_t * child = obj->spec_attr->children[i];
-            lv_obj_mark_layout_as_dirty(child);
+            _lv_obj_mark_layout_as_dirty(child);
         }
     }
     else if(code == LV_EVENT_CHILD_CHANGED) {
@@ -858,12 +882,14 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e)
         lv_coord_t align = lv_obj_get_style_align(obj, LV_PART_MAIN);
         uint16_t layout = lv_obj_get_style_layout(obj, LV_PART_MAIN);
         if(layout || align || w == LV_SIZE_CONTENT || h == LV_SIZE_CONTENT) {
-            lv_obj_mark_layout_as_dirty(obj);
+            _lv_obj_mark_layout_as_dirty(obj);
         }
     }
     else if(code == LV_EVENT_CHILD_DELETED) {
         obj->readjust_scroll_after_layout = 1;
-        lv_obj_mark_layout_as_dirty(obj);
+        /*A new child might be allocated at the address of the deleted one*/
+        _lv_obj_layout_cache_invalidate(obj);
+        _lv_obj_mark_layout_as_dirty(obj);
     }
     else if(code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
         lv_coord_t d = lv_obj_calculate_ext_draw_size(obj, LV_PART_MAIN);
@@ -889,6 +915,9 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
     lv_state_t prev_state = obj->state;
     obj->state = new_state;
 
+    /*The state is part of the cache key, but the children might inherit properties set for a state*/
+    if(lv_obj_get_child_cnt(obj) > 0) _lv_obj_style_cache_invalidate();
+
     _lv_style_state_cmp_t cmp_res = _lv_obj_style_state_compare(obj, prev_state, new_state);
     /*If there is no difference in styles there is nothing else to do*/
     if(cmp_res == _LV_STYLE_STATE_CMP_SAME) return;
@@ -942,7 +971,9 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
     lv_mem_buf_release(ts);
 
     if(cmp_res == _LV_STYLE_STATE_CMP_DIFF_REDRAW) {
-        lv_obj_invalidate(obj);
+        /*E.g. on scroll begin/end usually only the scrollbars change*/
+        if(state_diff_only_on_scrollbar(obj, prev_state, new_state)) lv_obj_scrollbar_invalidate(obj);
+        else lv_obj_invalidate(obj);
     }
     else if(cmp_res == _LV_STYLE_STATE_CMP_DIFF_LAYOUT) {
         lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
@@ -953,6 +984,28 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
     }
 }
 
+/**
+ * Check if the styles which differ in two states are all on the scrollbar part
+ * @param obj       pointer to an object
+ * @param state1    a state
+ * @param state2    an other state
+ * @return          true: only the scrollbars look different in the two states
+ */
+static bool state_diff_only_on_scrollbar(lv_obj_t * obj, lv_state_t state1, lv_state_t state2)
+{
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt; i++) {
+        if(obj->styles[i].is_trans) continue;
+
+        lv_state_t state_act = lv_obj_style_get_selector_state(obj->styles[i].selector);
+        bool valid1 = state_act & (~state1) ? false : true;
+        bool valid2 = state_act & (~state2) ? false : true;
+        if(valid1 != valid2 && lv_obj_style_get_selector_part(obj->styles[i].selector) != LV_PART_SCROLLBAR) return false;
+    }
+
+    return true;
+}
+
 static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_find)
 {
     /*Check all children of `parent`*/
@@ -103,7 +103,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
 
 void lv_obj_class_init_obj(lv_obj_t * obj)
 {
-    lv_obj_mark_layout_as_dirty(obj);
+    _lv_obj_mark_layout_as_dirty(obj);
     lv_obj_enable_style_refresh(false);
 
     lv_theme_apply(obj);
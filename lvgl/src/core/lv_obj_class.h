@@ -58,6 +58,8 @@ typedef struct _lv_obj_class_t {
     lv_coord_t height_def;
     uint32_t editable : 2;             /**< Value from ::lv_obj_class_editable_t*/
     uint32_t group_def : 2;            /**< Value from ::lv_obj_class_group_def_t*/
+    uint32_t scroll_copy : 1;          /**< 1: everything the class draws moves with the scrolled content,
+                                            so the rendered pixels can be moved on scroll (see `copy_cb`)*/
     uint32_t instance_size : 16;
 } lv_obj_class_t;
 
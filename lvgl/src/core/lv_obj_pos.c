@@ -19,6 +19,27 @@
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_USE_LAYOUT_CACHE
+typedef struct {
+    lv_obj_t * obj;
+    lv_obj_flag_t flags;
+    lv_coord_t x;           /*Relative to the container*/
+    lv_coord_t y;
+    lv_coord_t w;
+    lv_coord_t h;
+} layout_cache_child_t;
+
+/*Everything a layout depends on, except the styles, after its last run*/
+struct _lv_obj_layout_cache_t {
+    lv_coord_t w;
+    lv_coord_t h;
+    lv_point_t scroll;
+    uint32_t child_cnt;
+    uint32_t child_cap;     /*Number of allocated `children`*/
+    uint8_t valid : 1;      /*0: the next layout run can't be skipped*/
+    layout_cache_child_t children[];
+};
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -26,12 +47,21 @@
 static lv_coord_t calc_content_width(lv_obj_t * obj);
 static lv_coord_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
+static void layout_run(lv_obj_t * obj, uint32_t layout_id);
+static void mark_layout_path(lv_obj_t * obj);
+#if LV_USE_LAYOUT_CACHE
+    static bool layout_cache_matches(lv_obj_t * obj);
+    static void layout_cache_save(lv_obj_t * obj);
+#endif
 static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static uint32_t layout_cnt;
+static uint32_t layout_update_lock;     /*Nesting level of `lv_obj_layout_begin_update`*/
+static uint32_t frame_pass_cnt;         /*Layout passes since the last `_lv_obj_layout_frame_end`*/
+static lv_obj_layout_info_t layout_info;
 
 /**********************
  *      MACROS
@@ -201,6 +231,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     lv_obj_invalidate(obj);
 
     obj->readjust_scroll_after_layout = 1;
+    mark_layout_path(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -286,9 +317,19 @@ bool lv_obj_is_layout_positioned(const lv_obj_t * obj)
 }
 
 void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
+{
+    /*Explicitly requested so run the layout even if nothing seems to be changed*/
+    _lv_obj_layout_cache_invalidate(obj);
+    _lv_obj_mark_layout_as_dirty(obj);
+}
+
+void _lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
 
+    /*Mark the parents too to find the dirty objects without visiting the whole screen*/
+    mark_layout_path(obj);
+
     /*Mark the screen as dirty too to mark that there is something to do on this screen*/
     lv_obj_t * scr = lv_obj_get_screen(obj);
     scr->scr_layout_inv = 1;
@@ -305,6 +346,13 @@ void lv_obj_update_layout(const lv_obj_t * obj)
         LV_LOG_TRACE("Already running, returning");
         return;
     }
+
+    /*In a batch only collect the changes*/
+    if(layout_update_lock) {
+        layout_info.defer_cnt++;
+        return;
+    }
+
     mutex = true;
 
     lv_obj_t * scr = lv_obj_get_screen(obj);
@@ -313,6 +361,8 @@ void lv_obj_update_layout(const lv_obj_t * obj)
     while(scr->scr_layout_inv) {
         LV_LOG_INFO("Layout update begin");
         scr->scr_layout_inv = 0;
+        layout_info.pass_cnt++;
+        frame_pass_cnt++;
         layout_update_core(scr);
         LV_LOG_TRACE("Layout update end");
     }
@@ -331,6 +381,41 @@ uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data)
     return layout_cnt;  /*No -1 to skip 0th index*/
 }
 
+void lv_obj_layout_begin_update(void)
+{
+    layout_update_lock++;
+}
+
+void lv_obj_layout_end_update(void)
+{
+    if(layout_update_lock == 0) {
+        LV_LOG_WARN("called without lv_obj_layout_begin_update");
+        return;
+    }
+
+    layout_update_lock--;
+}
+
+void lv_obj_get_layout_info(lv_obj_layout_info_t * info)
+{
+    *info = layout_info;
+}
+
+void _lv_obj_layout_cache_invalidate(lv_obj_t * obj)
+{
+#if LV_USE_LAYOUT_CACHE
+    if(obj->spec_attr && obj->spec_attr->layout_cache) obj->spec_attr->layout_cache->valid = 0;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+void _lv_obj_layout_frame_end(void)
+{
+    layout_info.frame_pass_cnt = frame_pass_cnt;
+    frame_pass_cnt = 0;
+}
+
 void lv_obj_set_align(lv_obj_t * obj, lv_align_t align)
 {
     lv_obj_set_style_align(obj, align, 0);
@@ -621,7 +706,7 @@ bool lv_obj_refresh_self_size(lv_obj_t * obj)
     lv_coord_t h_set = lv_obj_get_style_height(obj, LV_PART_MAIN);
     if(w_set != LV_SIZE_CONTENT && h_set != LV_SIZE_CONTENT) return false;
 
-    lv_obj_mark_layout_as_dirty(obj);
+    _lv_obj_mark_layout_as_dirty(obj);
     return true;
 }
 
@@ -1123,6 +1208,10 @@ static lv_coord_t calc_content_height(lv_obj_t * obj)
 
 static void layout_update_core(lv_obj_t * obj)
 {
+    /*Nothing is dirty in this subtree*/
+    if(obj->layout_path_inv == 0) return;
+    obj->layout_path_inv = 0;
+
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_cnt(obj);
     for(i = 0; i < child_cnt; i++) {
@@ -1137,10 +1226,7 @@ static void layout_update_core(lv_obj_t * obj)
 
         if(child_cnt > 0) {
             uint32_t layout_id = lv_obj_get_style_layout(obj, LV_PART_MAIN);
-            if(layout_id > 0 && layout_id <= layout_cnt) {
-                void  * user_data = LV_GC_ROOT(_lv_layout_list)[layout_id - 1].user_data;
-                LV_GC_ROOT(_lv_layout_list)[layout_id - 1].cb(obj, user_data);
-            }
+            if(layout_id > 0 && layout_id <= layout_cnt) layout_run(obj, layout_id);
         }
     }
 
@@ -1150,6 +1236,119 @@ static void layout_update_core(lv_obj_t * obj)
     }
 }
 
+static void layout_run(lv_obj_t * obj, uint32_t layout_id)
+{
+#if LV_USE_LAYOUT_CACHE
+    /*The same children in the same state would be placed to the same positions again*/
+    if(layout_cache_matches(obj)) {
+        layout_info.skip_cnt++;
+        return;
+    }
+    lv_coord_t w_ori = lv_obj_get_width(obj);
+    lv_coord_t h_ori = lv_obj_get_height(obj);
+#endif
+
+    void  * user_data = LV_GC_ROOT(_lv_layout_list)[layout_id - 1].user_data;
+    LV_GC_ROOT(_lv_layout_list)[layout_id - 1].cb(obj, user_data);
+    layout_info.update_cnt++;
+
+#if LV_USE_LAYOUT_CACHE
+    /*If the layout resized the container (e.g. to `LV_SIZE_CONTENT`) the children were placed
+     *according to the old size so let the next pass run it again*/
+    if(obj->spec_attr == NULL) return;
+    if(w_ori == lv_obj_get_width(obj) && h_ori == lv_obj_get_height(obj)) {
+        layout_cache_save(obj);
+    }
+    else {
+        _lv_obj_layout_cache_invalidate(obj);
+    }
+#endif
+}
+
+/**
+ * Mark an object and its parents to show that there is something to update in their subtree
+ * @param obj       pointer to an object
+ */
+static void mark_layout_path(lv_obj_t * obj)
+{
+    /*Go up to the screen even if a parent is already marked: a running layout update
+     *might have cleared the grandparents of it*/
+    while(obj) {
+        obj->layout_path_inv = 1;
+        obj = obj->parent;
+    }
+}
+
+#if LV_USE_LAYOUT_CACHE
+/**
+ * Compare the state saved after the last layout run with the current one.
+ * The styles are not compared: their changes invalidate the saved state with `_lv_obj_layout_cache_invalidate`.
+ * @param obj       pointer to a container
+ * @return          true: the layout would place the children to the same positions again
+ */
+static bool layout_cache_matches(lv_obj_t * obj)
+{
+    struct _lv_obj_layout_cache_t * cache = obj->spec_attr->layout_cache;
+    if(cache == NULL || !cache->valid) return false;
+
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    if(cache->child_cnt != child_cnt) return false;
+    if(cache->w != lv_obj_get_width(obj) || cache->h != lv_obj_get_height(obj)) return false;
+    if(cache->scroll.x != lv_obj_get_scroll_x(obj) || cache->scroll.y != lv_obj_get_scroll_y(obj)) return false;
+
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        layout_cache_child_t * c = &cache->children[i];
+        if(c->obj != child || c->flags != child->flags) return false;
+        if(c->x != child->coords.x1 - obj->coords.x1 || c->y != child->coords.y1 - obj->coords.y1) return false;
+        if(c->w != lv_obj_get_width(child) || c->h != lv_obj_get_height(child)) return false;
+    }
+
+    return true;
+}
+
+/**
+ * Save the state of a container and its children after a layout run
+ * @param obj       pointer to a container
+ */
+static void layout_cache_save(lv_obj_t * obj)
+{
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    struct _lv_obj_layout_cache_t * cache = obj->spec_attr->layout_cache;
+    if(cache == NULL || cache->child_cap < child_cnt) {
+        cache = lv_mem_realloc(cache, sizeof(struct _lv_obj_layout_cache_t) + child_cnt * sizeof(layout_cache_child_t));
+        LV_ASSERT_MALLOC(cache);
+        if(cache == NULL) {
+            _lv_obj_layout_cache_invalidate(obj);
+            return;
+        }
+        cache->child_cap = child_cnt;
+        obj->spec_attr->layout_cache = cache;
+    }
+
+    cache->w = lv_obj_get_width(obj);
+    cache->h = lv_obj_get_height(obj);
+    cache->scroll.x = lv_obj_get_scroll_x(obj);
+    cache->scroll.y = lv_obj_get_scroll_y(obj);
+    cache->child_cnt = child_cnt;
+
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        layout_cache_child_t * c = &cache->children[i];
+        c->obj = child;
+        c->flags = child->flags;
+        c->x = child->coords.x1 - obj->coords.x1;
+        c->y = child->coords.y1 - obj->coords.y1;
+        c->w = lv_obj_get_width(child);
+        c->h = lv_obj_get_height(child);
+    }
+
+    cache->valid = 1;
+}
+#endif
+
 static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv)
 {
     int16_t angle = lv_obj_get_style_transform_angle(obj, 0);
@@ -30,6 +30,14 @@ typedef struct {
     void * user_data;
 } lv_layout_dsc_t;
 
+typedef struct {
+    uint32_t pass_cnt;          /**< Number of passes over a screen to update the dirty layouts*/
+    uint32_t frame_pass_cnt;    /**< Number of passes between the layout updates of the last two display refreshes*/
+    uint32_t update_cnt;        /**< Number of times a layout (e.g. flex or grid) was recalculated*/
+    uint32_t skip_cnt;          /**< Number of recalculations skipped because nothing changed (`LV_USE_LAYOUT_CACHE`)*/
+    uint32_t defer_cnt;         /**< Number of `lv_obj_update_layout` calls postponed by `lv_obj_layout_begin_update`*/
+} lv_obj_layout_info_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -141,7 +149,7 @@ void lv_obj_set_layout(struct _lv_obj_t * obj, uint32_t layout);
 bool lv_obj_is_layout_positioned(const struct _lv_obj_t * obj);
 
 /**
- * Mark the object for layout update.
+ * Mark the object for layout update. The layout runs even if `LV_USE_LAYOUT_CACHE` finds nothing changed.
  * @param obj      pointer to an object whose children needs to be updated
  */
 void lv_obj_mark_layout_as_dirty(struct _lv_obj_t * obj);
@@ -160,6 +168,45 @@ void lv_obj_update_layout(const struct _lv_obj_t * obj);
  */
 uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data);
 
+/**
+ * Start a batch of changes. Until the matching `lv_obj_layout_end_update` `lv_obj_update_layout`
+ * does nothing, so e.g. creating many children runs the layout of their parent only once.
+ * Calls can be nested.
+ * @note            the coordinates of the objects are not updated in the batch,
+ *                  `lv_obj_get_x()`, `lv_obj_align_to()`, etc. might work with outdated values.
+ */
+void lv_obj_layout_begin_update(void);
+
+/**
+ * Finish a batch of changes started by `lv_obj_layout_begin_update`.
+ * The collected changes are applied in the next refresh or by `lv_obj_update_layout`.
+ */
+void lv_obj_layout_end_update(void);
+
+/**
+ * Get the counters of the layout updates
+ * @param info      store the counters here
+ */
+void lv_obj_get_layout_info(lv_obj_layout_info_t * info);
+
+/**
+ * Mark the object for layout update, but let `LV_USE_LAYOUT_CACHE` skip the layout if nothing changed.
+ * Used internally when something which might affect the layout changes.
+ * @param obj      pointer to an object whose children needs to be updated
+ */
+void _lv_obj_mark_layout_as_dirty(struct _lv_obj_t * obj);
+
+/**
+ * Drop the remembered layout result of an object. Called internally when a layout related style changes.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_layout_cache_invalidate(struct _lv_obj_t * obj);
+
+/**
+ * Close the layout pass counting of a frame. Called by the display refresh after updating the layouts.
+ */
+void _lv_obj_layout_frame_end(void);
+
 /**
  * Change the alignment of an object.
  * @param obj       pointer to an object to align
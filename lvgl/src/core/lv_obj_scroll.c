@@ -11,6 +11,7 @@
 #include "lv_indev.h"
 #include "lv_disp.h"
 #include "lv_indev_scroll.h"
+#include "lv_refr.h"
 
 /*********************
  *      DEFINES
@@ -36,6 +37,9 @@ static void scroll_y_anim(void * obj, int32_t v);
 static void scroll_anim_ready_cb(lv_anim_t * a);
 static void scroll_area_into_view(const lv_area_t * area, lv_obj_t * child, lv_point_t * scroll_value,
                                   lv_anim_enable_t anim_en);
+static bool scroll_by_copy(lv_obj_t * obj, lv_coord_t dx, lv_coord_t dy);
+static bool get_copy_area(lv_obj_t * obj, lv_coord_t dx, lv_area_t * copy_area);
+static bool is_covered_by_children(lv_obj_t * parent, uint32_t start, const lv_area_t * area);
 
 /**********************
  *  STATIC VARIABLES
@@ -414,14 +418,20 @@ lv_res_t _lv_obj_scroll_by_raw(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
 
     lv_obj_allocate_spec_attr(obj);
 
+    /*The scrollbars don't move with the content so their current position needs to be redrawn*/
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    if(disp->driver->copy_cb) lv_obj_scrollbar_invalidate(obj);
+
     obj->spec_attr->scroll.x += x;
     obj->spec_attr->scroll.y += y;
 
     lv_obj_move_children_by(obj, x, y, true);
-    lv_res_t res = lv_event_send(obj, LV_EVENT_SCROLL, NULL);
-    if(res != LV_RES_OK) return res;
-    lv_obj_invalidate(obj);
-    return LV_RES_OK;
+
+    /*Invalidate before the scroll event: the areas invalidated by its handlers are already
+     *at the new position so they must not be moved with the copied pixels*/
+    if(disp->driver->copy_cb == NULL || !scroll_by_copy(obj, x, y)) lv_obj_invalidate(obj);
+
+    return lv_event_send(obj, LV_EVENT_SCROLL, NULL);
 }
 
 bool lv_obj_is_scrolling(const lv_obj_t * obj)
@@ -665,6 +675,148 @@ void lv_obj_readjust_scroll(lv_obj_t * obj, lv_anim_enable_t anim_en)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Move the already rendered content of a scrolled object on the display instead of redrawing all of it.
+ * @param obj   pointer to an object which was just scrolled
+ * @param dx    the horizontal scroll
+ * @param dy    the vertical scroll
+ * @return      true: only the uncovered parts were invalidated; false: the object needs to be invalidated
+ */
+static bool scroll_by_copy(lv_obj_t * obj, lv_coord_t dx, lv_coord_t dy)
+{
+    lv_area_t copy_area;
+    if(!get_copy_area(obj, dx, &copy_area)) return false;
+
+    if(!_lv_inv_area_copy(lv_obj_get_disp(obj), &copy_area, dx, dy)) return false;
+
+    /*Redraw the parts of the object outside of the moved area (e.g. the border) and the scrollbars*/
+    const lv_area_t * c = &copy_area;
+    lv_area_t rest[4];
+    lv_area_set(&rest[0], obj->coords.x1, obj->coords.y1, obj->coords.x2, c->y1 - 1);
+    lv_area_set(&rest[1], obj->coords.x1, c->y2 + 1, obj->coords.x2, obj->coords.y2);
+    lv_area_set(&rest[2], obj->coords.x1, c->y1, c->x1 - 1, c->y2);
+    lv_area_set(&rest[3], c->x2 + 1, c->y1, obj->coords.x2, c->y2);
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        if(rest[i].x1 <= rest[i].x2 && rest[i].y1 <= rest[i].y2) lv_obj_invalidate_area(obj, &rest[i]);
+    }
+
+    lv_obj_scrollbar_invalidate(obj);
+
+    return true;
+}
+
+/**
+ * Get the area of an object whose content can be moved on the display when the object is scrolled.
+ * @param obj           pointer to an object
+ * @param dx            the horizontal scroll step
+ * @param copy_area     store the visible part of the scrolled content area here
+ * @return              true: the content can be moved; false: something else is drawn there too
+ *                      (e.g. a not scrolled background or an other object on it)
+ */
+static bool get_copy_area(lv_obj_t * obj, lv_coord_t dx, lv_area_t * copy_area)
+{
+    /*Only widgets whose drawing is scrolled with the children. Not inherited: a derived class might draw more.*/
+    if(!obj->class_p->scroll_copy) return false;
+    if(_lv_obj_has_event_cb_in_range(obj, LV_EVENT_DRAW_MAIN_BEGIN, LV_EVENT_DRAW_PART_END)) return false;
+
+    /*The background needs to look the same everywhere*/
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return false;
+    if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_bg_img_src(obj, LV_PART_MAIN) != NULL) return false;
+
+    /*Floating children are not scrolled*/
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_FLOATING) && !lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) return false;
+    }
+
+    /*Leave out the border and the rounded corners. Keep the full length in the scroll direction
+     *but skip the whole rows/columns of the corners.*/
+    lv_coord_t border_w = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    lv_coord_t radius = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    lv_coord_t short_side = LV_MIN(lv_obj_get_width(obj), lv_obj_get_height(obj));
+    if(radius > short_side / 2) radius = short_side / 2;
+    *copy_area = obj->coords;
+    if(dx == 0) lv_area_increase(copy_area, -border_w, -LV_MAX(border_w, radius));
+    else lv_area_increase(copy_area, -LV_MAX(border_w, radius), -border_w);
+    if(copy_area->x1 > copy_area->x2 || copy_area->y1 > copy_area->y2) return false;
+
+    /*Clip to the parents and check if an other object is drawn on the area*/
+    lv_obj_t * cur = obj;
+    while(cur) {
+        if(lv_obj_has_flag(cur, LV_OBJ_FLAG_HIDDEN)) return false;
+        if(_lv_obj_get_layer_type(cur) != LV_LAYER_TYPE_NONE) return false;
+
+        lv_obj_t * parent = lv_obj_get_parent(cur);
+        if(parent == NULL) break;
+
+        /*The parents draw their scrollbars and post draw content on their children*/
+        if(lv_obj_get_style_clip_corner(parent, LV_PART_MAIN)) return false;
+        if(_lv_obj_has_event_cb_in_range(parent, LV_EVENT_DRAW_POST_BEGIN, LV_EVENT_DRAW_POST_END)) return false;
+        if(lv_obj_get_style_border_post(parent, LV_PART_MAIN)) {
+            lv_coord_t parent_border_w = lv_obj_get_style_border_width(parent, LV_PART_MAIN);
+            if(parent_border_w > 0 && lv_obj_get_style_border_opa(parent, LV_PART_MAIN) > LV_OPA_MIN) {
+                lv_area_t parent_inner = parent->coords;
+                lv_area_increase(&parent_inner, -parent_border_w, -parent_border_w);
+                if(!_lv_area_is_in(copy_area, &parent_inner, lv_obj_get_style_radius(parent, LV_PART_MAIN))) return false;
+            }
+        }
+        lv_area_t sb_hor;
+        lv_area_t sb_ver;
+        lv_obj_get_scrollbar_area(parent, &sb_hor, &sb_ver);
+        if(lv_area_get_size(&sb_hor) > 0 && _lv_area_is_on(&sb_hor, copy_area)) return false;
+        if(lv_area_get_size(&sb_ver) > 0 && _lv_area_is_on(&sb_ver, copy_area)) return false;
+
+        if(!lv_obj_has_flag(parent, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+            if(!_lv_area_intersect(copy_area, copy_area, &parent->coords)) return false;
+        }
+
+        if(is_covered_by_children(parent, lv_obj_get_index(cur) + 1, copy_area)) return false;
+        cur = parent;
+    }
+
+    /*`cur` is the screen now. Moving the pixels of the active screen only is safe*/
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    if(cur != disp->act_scr || disp->prev_scr) return false;
+
+    lv_area_t disp_area;
+    lv_area_set(&disp_area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    if(!_lv_area_intersect(copy_area, copy_area, &disp_area)) return false;
+
+    if(is_covered_by_children(disp->top_layer, 0, copy_area)) return false;
+    if(is_covered_by_children(disp->sys_layer, 0, copy_area)) return false;
+
+    return true;
+}
+
+/**
+ * Check if any visible children of an object is drawn on an area
+ * @param parent    pointer to an object
+ * @param start     index of the first child to check
+ * @param area      the area to check
+ * @return          true: a child is drawn on the area
+ */
+static bool is_covered_by_children(lv_obj_t * parent, uint32_t start, const lv_area_t * area)
+{
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(parent);
+    for(i = start; i < child_cnt; i++) {
+        lv_obj_t * child = parent->spec_attr->children[i];
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) continue;
+
+        lv_area_t child_area;
+        lv_obj_get_coords(child, &child_area);
+        lv_coord_t ext_draw_size = _lv_obj_get_ext_draw_size(child);
+        lv_area_increase(&child_area, ext_draw_size, ext_draw_size);
+        if(_lv_area_is_on(&child_area, area)) return true;
+    }
+
+    return false;
+}
+
 static void scroll_x_anim(void * obj, int32_t v)
 {
     _lv_obj_scroll_by_raw(obj, v + lv_obj_get_scroll_x(obj), 0);
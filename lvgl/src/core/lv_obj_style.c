@@ -15,6 +15,15 @@
  *********************/
 #define MY_CLASS &lv_obj_class
 
+#if LV_USE_STYLE_CACHE
+#if LV_STYLE_CACHE_SIZE & (LV_STYLE_CACHE_SIZE - 1)
+    #error "LV_STYLE_CACHE_SIZE must be a power of 2"
+#endif
+
+#define STYLE_CACHE_HASH(obj, part, prop) \
+    ((((uint32_t)(uintptr_t)(obj) >> 3) * 31 + (prop) * 7 + ((part) >> 16)) & (LV_STYLE_CACHE_SIZE - 1))
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -27,6 +36,17 @@ typedef struct {
     lv_style_value_t end_value;
 } trans_t;
 
+#if LV_USE_STYLE_CACHE
+typedef struct {
+    const lv_obj_t * obj;
+    uint32_t gen;
+    lv_part_t part;
+    lv_state_t state;
+    lv_style_prop_t prop;
+    lv_style_value_t value;
+} style_cache_entry_t;
+#endif
+
 typedef enum {
     CACHE_ZERO = 0,
     CACHE_TRUE = 1,
@@ -35,6 +55,24 @@ typedef enum {
     CACHE_NEED_CHECK = 4,
 } cache_t;
 
+/*What has to be done to refresh an object after a style change*/
+enum {
+    REFR_STYLE_CHANGED  = 0x01,     /*Send LV_EVENT_STYLE_CHANGED and refresh the layout of the object*/
+    REFR_PARENT_LAYOUT  = 0x02,     /*Refresh the layout of the parent*/
+    REFR_LAYER_TYPE     = 0x04,     /*Recalculate the layer type*/
+    REFR_EXT_DRAW       = 0x08,     /*Refresh the ext. draw size*/
+    REFR_CHILDREN       = 0x10,     /*Refresh the style of the children*/
+};
+
+typedef uint8_t refr_flags_t;
+
+#if LV_USE_ANIM_BATCH
+typedef struct {
+    lv_obj_t * obj;
+    refr_flags_t flags;
+} style_refr_pending_t;
+#endif
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -44,9 +82,16 @@ typedef enum {
  **********************/
 static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
 static _lv_obj_style_t * get_trans_style(lv_obj_t * obj, uint32_t part);
+static lv_style_value_t get_prop_resolved(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
 static void report_style_change_core(void * style, lv_obj_t * obj);
+static void refresh_style_core(lv_obj_t * obj, refr_flags_t flags);
+#if LV_USE_ANIM_BATCH
+    static bool style_refr_batch_add(lv_obj_t * obj, refr_flags_t flags);
+#endif
 static void refresh_children_style(lv_obj_t * obj);
+static bool own_style_change_begin(void);
+static void own_style_change_end(bool synced);
 static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
 static void trans_anim_cb(void * _tr, int32_t v);
 static void trans_anim_start_cb(lv_anim_t * a);
@@ -60,6 +105,19 @@ static void fade_in_anim_ready(lv_anim_t * a);
  **********************/
 static bool style_refr = true;
 
+#if LV_USE_STYLE_CACHE
+static style_cache_entry_t style_cache[LV_STYLE_CACHE_SIZE];
+static uint32_t style_cache_gen = 1;
+static uint32_t style_change_cnt;   /*The last seen `_lv_style_get_change_cnt()`*/
+static lv_obj_style_cache_info_t style_cache_info;
+#endif
+
+#if LV_USE_ANIM_BATCH
+static uint32_t style_refr_batch;   /*Nesting level of `_lv_obj_style_refr_batch_begin`*/
+static style_refr_pending_t style_refr_pending[LV_ANIM_BATCH_OBJ_MAX];
+static uint32_t style_refr_pending_cnt;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -140,6 +198,7 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
 
         obj->style_cnt--;
         obj->styles = lv_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
+        _lv_obj_style_cache_invalidate_obj(obj, part_act, LV_STYLE_PROP_ANY);
 
         deleted = true;
         /*The style from the current `i` index is removed, so `i` points to the next style.
@@ -168,51 +227,49 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
-    if(!style_refr) return;
-
-    lv_obj_invalidate(obj);
-
     lv_part_t part = lv_obj_style_get_selector_part(selector);
+    _lv_obj_style_cache_invalidate_obj(obj, part, prop);
+    if(!style_refr) return;
 
     bool is_layout_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_LAYOUT_REFR);
     bool is_ext_draw = lv_style_prop_has_flag(prop, LV_STYLE_PROP_EXT_DRAW);
     bool is_inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
     bool is_layer_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_LAYER_REFR);
 
+    /*A simple drawing property of the scrollbars (e.g. its opacity in a transition) changes only the scrollbars*/
+    if(part == LV_PART_SCROLLBAR && prop != LV_STYLE_PROP_ANY && !is_layout_refr && !is_ext_draw) {
+        lv_obj_scrollbar_invalidate(obj);
+        return;
+    }
+
+    refr_flags_t flags = 0;
     if(is_layout_refr) {
         if(part == LV_PART_ANY ||
            part == LV_PART_MAIN ||
            lv_obj_get_style_height(obj, 0) == LV_SIZE_CONTENT ||
            lv_obj_get_style_width(obj, 0) == LV_SIZE_CONTENT) {
-            lv_event_send(obj, LV_EVENT_STYLE_CHANGED, NULL);
-            lv_obj_mark_layout_as_dirty(obj);
+            flags |= REFR_STYLE_CHANGED;
         }
     }
     if((part == LV_PART_ANY || part == LV_PART_MAIN) && (prop == LV_STYLE_PROP_ANY || is_layout_refr)) {
-        lv_obj_t * parent = lv_obj_get_parent(obj);
-        if(parent) lv_obj_mark_layout_as_dirty(parent);
+        flags |= REFR_PARENT_LAYOUT;
     }
-
-    /*Cache the layer type*/
     if((part == LV_PART_ANY || part == LV_PART_MAIN) && is_layer_refr) {
-        lv_layer_type_t layer_type = calculate_layer_type(obj);
-        if(obj->spec_attr) obj->spec_attr->layer_type = layer_type;
-        else if(layer_type != LV_LAYER_TYPE_NONE) {
-            lv_obj_allocate_spec_attr(obj);
-            obj->spec_attr->layer_type = layer_type;
-        }
+        flags |= REFR_LAYER_TYPE;
     }
-
     if(prop == LV_STYLE_PROP_ANY || is_ext_draw) {
-        lv_obj_refresh_ext_draw_size(obj);
+        flags |= REFR_EXT_DRAW;
     }
-    lv_obj_invalidate(obj);
-
     if(prop == LV_STYLE_PROP_ANY || (is_inheritable && (is_ext_draw || is_layout_refr))) {
-        if(part != LV_PART_SCROLLBAR) {
-            refresh_children_style(obj);
-        }
+        if(part != LV_PART_SCROLLBAR) flags |= REFR_CHILDREN;
     }
+
+#if LV_USE_ANIM_BATCH
+    if(style_refr_batch && style_refr_batch_add(obj, flags)) return;
+#endif
+
+    lv_obj_invalidate(obj);
+    refresh_style_core(obj, flags);
 }
 
 void lv_obj_enable_style_refresh(bool en)
@@ -220,58 +277,136 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
-lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+#if LV_USE_ANIM_BATCH
+void _lv_obj_style_refr_batch_begin(void)
 {
-    lv_style_value_t value_act;
-    bool inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
-    lv_style_res_t found = LV_STYLE_RES_NOT_FOUND;
-    while(obj) {
-        found = get_prop_core(obj, part, prop, &value_act);
-        if(found == LV_STYLE_RES_FOUND) break;
-        if(!inheritable) break;
+    style_refr_batch++;
+}
 
-        /*If not found, check the `MAIN` style first*/
-        if(found != LV_STYLE_RES_INHERIT && part != LV_PART_MAIN) {
-            part = LV_PART_MAIN;
-            continue;
+void _lv_obj_style_refr_batch_end(void)
+{
+    if(style_refr_batch == 0) {
+        LV_LOG_WARN("called without _lv_obj_style_refr_batch_begin");
+        return;
+    }
+
+    style_refr_batch--;
+    if(style_refr_batch) return;
+
+    /*The refresh might send events which change the styles again. These are refreshed immediately.
+     *If an object is deleted meanwhile `_lv_obj_style_refr_batch_remove` clears its entry.*/
+    uint32_t i;
+    for(i = 0; i < style_refr_pending_cnt; i++) {
+        lv_obj_t * obj = style_refr_pending[i].obj;
+        if(obj == NULL) continue;
+        style_refr_pending[i].obj = NULL;
+        refresh_style_core(obj, style_refr_pending[i].flags);
+    }
+    style_refr_pending_cnt = 0;
+}
+
+void _lv_obj_style_refr_batch_remove(lv_obj_t * obj)
+{
+    uint32_t i;
+    for(i = 0; i < style_refr_pending_cnt; i++) {
+        if(style_refr_pending[i].obj == obj) {
+            style_refr_pending[i].obj = NULL;
+            return;
         }
+    }
+}
+#endif
 
-        /*Check the parent too.*/
-        obj = lv_obj_get_parent(obj);
+void _lv_obj_style_cache_invalidate(void)
+{
+#if LV_USE_STYLE_CACHE
+    style_cache_gen++;
+    /*Don't let the very old entries match again after an overflow*/
+    if(style_cache_gen == 0) {
+        lv_memset_00(style_cache, sizeof(style_cache));
+        style_cache_gen = 1;
     }
+    style_cache_info.invalidate_cnt++;
+#endif
+}
 
-    if(found != LV_STYLE_RES_FOUND) {
-        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
-            const lv_obj_class_t * cls = obj->class_p;
-            while(cls) {
-                if(prop == LV_STYLE_WIDTH) {
-                    if(cls->width_def != 0) break;
-                }
-                else {
-                    if(cls->height_def != 0) break;
-                }
-                cls = cls->base_class;
-            }
+void _lv_obj_style_cache_invalidate_obj(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+#if LV_USE_STYLE_CACHE
+    bool inheritable = prop == LV_STYLE_PROP_ANY || lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
+    /*Finding the values inherited by the descendants would cost more than dropping everything*/
+    if(inheritable && lv_obj_get_child_cnt(obj) > 0) {
+        _lv_obj_style_cache_invalidate();
+        return;
+    }
 
-            if(cls) {
-                value_act.num = prop == LV_STYLE_WIDTH ? cls->width_def : cls->height_def;
-            }
-            else {
-                value_act.num = 0;
-            }
-        }
-        else {
-            value_act = lv_style_prop_get_default(prop);
-        }
+    /*The other parts inherit the main part's values too*/
+    if(inheritable) part = LV_PART_ANY;
+
+    uint8_t group = _lv_style_get_prop_group(prop);
+    uint32_t i;
+    for(i = 0; i < LV_STYLE_CACHE_SIZE; i++) {
+        style_cache_entry_t * entry = &style_cache[i];
+        if(entry->obj != obj) continue;
+        if(part != LV_PART_ANY && entry->part != part) continue;
+        if(prop != LV_STYLE_PROP_ANY && _lv_style_get_prop_group(entry->prop) != group) continue;
+        entry->obj = NULL;
     }
-    return value_act;
+    style_cache_info.invalidate_obj_cnt++;
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(part);
+    LV_UNUSED(prop);
+#endif
+}
+
+#if LV_USE_STYLE_CACHE
+void lv_obj_get_style_cache_info(lv_obj_style_cache_info_t * info)
+{
+    *info = style_cache_info;
+}
+#endif
+
+lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+#if LV_USE_STYLE_CACHE
+    /*The transitions are skipped only temporarily so don't cache these values*/
+    if(obj->skip_trans) return get_prop_resolved(obj, part, prop);
+
+    /*Changing a style's property doesn't go through the objects so check it here*/
+    uint32_t change_cnt = _lv_style_get_change_cnt();
+    if(style_change_cnt != change_cnt) {
+        style_change_cnt = change_cnt;
+        _lv_obj_style_cache_invalidate();
+    }
+
+    style_cache_entry_t * entry = &style_cache[STYLE_CACHE_HASH(obj, part, prop)];
+    if(entry->gen == style_cache_gen && entry->obj == obj && entry->prop == prop &&
+       entry->part == part && entry->state == obj->state) {
+        style_cache_info.hit_cnt++;
+        return entry->value;
+    }
+
+    style_cache_info.miss_cnt++;
+    entry->value = get_prop_resolved(obj, part, prop);
+    entry->obj = obj;
+    entry->gen = style_cache_gen;
+    entry->part = part;
+    entry->state = obj->state;
+    entry->prop = prop;
+    return entry->value;
+#else
+    return get_prop_resolved(obj, part, prop);
+#endif
 }
 
 void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_value_t value,
                                  lv_style_selector_t selector)
 {
     lv_style_t * style = get_local_style(obj, selector);
+    bool synced = own_style_change_begin();
     lv_style_set_prop(style, prop, value);
+    own_style_change_end(synced);
     lv_obj_refresh_style(obj, selector, prop);
 }
 
@@ -279,7 +414,9 @@ void lv_obj_set_local_style_prop_meta(lv_obj_t * obj, lv_style_prop_t prop, uint
                                       lv_style_selector_t selector)
 {
     lv_style_t * style = get_local_style(obj, selector);
+    bool synced = own_style_change_begin();
     lv_style_set_prop_meta(style, prop, meta);
+    own_style_change_end(synced);
     lv_obj_refresh_style(obj, selector, prop);
 }
 
@@ -313,7 +450,9 @@ bool lv_obj_remove_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_sty
     /*The style is not found*/
     if(i == obj->style_cnt) return false;
 
+    bool synced = own_style_change_begin();
     lv_res_t res = lv_style_remove_prop(obj->styles[i].style, prop);
+    own_style_change_end(synced);
     if(res == LV_RES_OK) {
         lv_obj_refresh_style(obj, selector, prop);
     }
@@ -598,6 +737,61 @@ static _lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t se
     return &obj->styles[0];
 }
 
+/**
+ * Get the value of a style property of an object in its current state, considering the inheritance
+ * and the default values too.
+ * @param obj       pointer to an object
+ * @param part      a part of the object
+ * @param prop      the property to get
+ * @return          the value of the property
+ */
+static lv_style_value_t get_prop_resolved(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    lv_style_value_t value_act;
+    bool inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
+    lv_style_res_t found = LV_STYLE_RES_NOT_FOUND;
+    while(obj) {
+        found = get_prop_core(obj, part, prop, &value_act);
+        if(found == LV_STYLE_RES_FOUND) break;
+        if(!inheritable) break;
+
+        /*If not found, check the `MAIN` style first*/
+        if(found != LV_STYLE_RES_INHERIT && part != LV_PART_MAIN) {
+            part = LV_PART_MAIN;
+            continue;
+        }
+
+        /*Check the parent too.*/
+        obj = lv_obj_get_parent(obj);
+    }
+
+    if(found != LV_STYLE_RES_FOUND) {
+        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
+            const lv_obj_class_t * cls = obj->class_p;
+            while(cls) {
+                if(prop == LV_STYLE_WIDTH) {
+                    if(cls->width_def != 0) break;
+                }
+                else {
+                    if(cls->height_def != 0) break;
+                }
+                cls = cls->base_class;
+            }
+
+            if(cls) {
+                value_act.num = prop == LV_STYLE_WIDTH ? cls->width_def : cls->height_def;
+            }
+            else {
+                value_act.num = 0;
+            }
+        }
+        else {
+            value_act = lv_style_prop_get_default(prop);
+        }
+    }
+    return value_act;
+}
+
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v)
 {
     uint8_t group = 1 << _lv_style_get_prop_group(prop);
@@ -686,6 +880,75 @@ static void report_style_change_core(void * style, lv_obj_t * obj)
     }
 }
 
+/**
+ * Do the work of `lv_obj_refresh_style` after the object was invalidated with its old style
+ * @param obj       pointer to an object
+ * @param flags     OR-ed `REFR_...` values
+ */
+static void refresh_style_core(lv_obj_t * obj, refr_flags_t flags)
+{
+    if(flags & REFR_STYLE_CHANGED) {
+        lv_event_send(obj, LV_EVENT_STYLE_CHANGED, NULL);
+        _lv_obj_mark_layout_as_dirty(obj);
+    }
+    if(flags & REFR_PARENT_LAYOUT) {
+        /*The layout of the object and of its parent might read the changed property*/
+        _lv_obj_layout_cache_invalidate(obj);
+        lv_obj_t * parent = lv_obj_get_parent(obj);
+        if(parent) {
+            _lv_obj_layout_cache_invalidate(parent);
+            _lv_obj_mark_layout_as_dirty(parent);
+        }
+    }
+
+    /*Cache the layer type*/
+    if(flags & REFR_LAYER_TYPE) {
+        lv_layer_type_t layer_type = calculate_layer_type(obj);
+        if(obj->spec_attr) obj->spec_attr->layer_type = layer_type;
+        else if(layer_type != LV_LAYER_TYPE_NONE) {
+            lv_obj_allocate_spec_attr(obj);
+            obj->spec_attr->layer_type = layer_type;
+        }
+    }
+
+    if(flags & REFR_EXT_DRAW) {
+        lv_obj_refresh_ext_draw_size(obj);
+    }
+    lv_obj_invalidate(obj);
+
+    if(flags & REFR_CHILDREN) {
+        refresh_children_style(obj);
+    }
+}
+
+#if LV_USE_ANIM_BATCH
+/**
+ * Add an object to the pending style refreshes or merge the flags if it's already there.
+ * The object is invalidated when it's added to have its area with the old style redrawn.
+ * @param obj       pointer to an object
+ * @param flags     OR-ed `REFR_...` values
+ * @return          true: the refresh is postponed; false: no more space, refresh it now
+ */
+static bool style_refr_batch_add(lv_obj_t * obj, refr_flags_t flags)
+{
+    uint32_t i;
+    for(i = 0; i < style_refr_pending_cnt; i++) {
+        if(style_refr_pending[i].obj == obj) {
+            style_refr_pending[i].flags |= flags;
+            return true;
+        }
+    }
+
+    if(style_refr_pending_cnt >= LV_ANIM_BATCH_OBJ_MAX) return false;
+
+    lv_obj_invalidate(obj);
+    style_refr_pending[style_refr_pending_cnt].obj = obj;
+    style_refr_pending[style_refr_pending_cnt].flags = flags;
+    style_refr_pending_cnt++;
+    return true;
+}
+#endif
+
 /**
  * Recursively refresh the style of the children. Go deeper until a not NULL style is found
  * because the NULL styles are inherited from the parent
@@ -698,6 +961,7 @@ static void refresh_children_style(lv_obj_t * obj)
     for(i = 0; i < child_cnt; i++) {
         lv_obj_t * child = obj->spec_attr->children[i];
         lv_obj_invalidate(child);
+        _lv_obj_layout_cache_invalidate(child);    /*E.g. the inherited base direction might have changed*/
         lv_event_send(child, LV_EVENT_STYLE_CHANGED, NULL);
         lv_obj_invalidate(child);
 
@@ -748,6 +1012,33 @@ static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, tran
     return removed;
 }
 
+/**
+ * Call before changing a local or transition style of an object if `lv_obj_refresh_style()` follows the change.
+ * @return      true: the style cache has seen all the style changes so far
+ */
+static bool own_style_change_begin(void)
+{
+#if LV_USE_STYLE_CACHE
+    return style_change_cnt == _lv_style_get_change_cnt();
+#else
+    return false;
+#endif
+}
+
+/**
+ * Don't let the change of an object's own style drop the whole style cache.
+ * The following `lv_obj_refresh_style()` drops the cached values of the object.
+ * @param synced    the return value of `own_style_change_begin()`
+ */
+static void own_style_change_end(bool synced)
+{
+#if LV_USE_STYLE_CACHE
+    if(synced) style_change_cnt = _lv_style_get_change_cnt();
+#else
+    LV_UNUSED(synced);
+#endif
+}
+
 static void trans_anim_cb(void * _tr, int32_t v)
 {
     trans_t * tr = _tr;
@@ -804,7 +1095,9 @@ static void trans_anim_cb(void * _tr, int32_t v)
                 refr = false;
             }
         }
+        bool synced = own_style_change_begin();
         lv_style_set_prop(obj->styles[i].style, tr->prop, value_final);
+        own_style_change_end(synced);
         if(refr) lv_obj_refresh_style(tr->obj, tr->selector, tr->prop);
         break;
 
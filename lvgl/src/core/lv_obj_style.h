@@ -54,6 +54,15 @@ typedef struct {
 #endif
 } _lv_obj_style_transition_dsc_t;
 
+#if LV_USE_STYLE_CACHE
+typedef struct {
+    uint32_t hit_cnt;           /**< Number of property reads served from the cache*/
+    uint32_t miss_cnt;          /**< Number of property reads resolved from the styles*/
+    uint32_t invalidate_cnt;    /**< Number of times the whole cache was dropped*/
+    uint32_t invalidate_obj_cnt;    /**< Number of times only the values of an object were dropped*/
+} lv_obj_style_cache_info_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -118,6 +127,50 @@ void lv_obj_refresh_style(struct _lv_obj_t * obj, lv_part_t part, lv_style_prop_
  */
 void lv_obj_enable_style_refresh(bool en);
 
+/**
+ * Drop all the property values cached by `lv_obj_get_style_prop`.
+ * Called internally when a shared style or the state of a parent changes.
+ */
+void _lv_obj_style_cache_invalidate(void);
+
+/**
+ * Drop the cached property values of an object after its styles changed.
+ * If its descendants might inherit the changed values the whole cache is dropped.
+ * @param obj       pointer to an object
+ * @param part      the changed part or `LV_PART_ANY`
+ * @param prop      the changed property or `LV_STYLE_PROP_ANY`. The values of its whole group are dropped.
+ */
+void _lv_obj_style_cache_invalidate_obj(struct _lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
+
+#if LV_USE_ANIM_BATCH
+/**
+ * Start collecting the style refreshes. Until `_lv_obj_style_refr_batch_end` an object is
+ * invalidated when its style changes first, and the rest of the refresh (events, layout, ext. draw size)
+ * is done only once in `_lv_obj_style_refr_batch_end`. Used by the animations to coalesce
+ * the writes of all the animations of an object in a frame.
+ */
+void _lv_obj_style_refr_batch_begin(void);
+
+/**
+ * Refresh the objects collected since `_lv_obj_style_refr_batch_begin`
+ */
+void _lv_obj_style_refr_batch_end(void);
+
+/**
+ * Forget the pending style refresh of an object. Called when the object is deleted.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_style_refr_batch_remove(struct _lv_obj_t * obj);
+#endif
+
+#if LV_USE_STYLE_CACHE
+/**
+ * Get the hit/miss counters of the style property cache
+ * @param info      store the counters here
+ */
+void lv_obj_get_style_cache_info(lv_obj_style_cache_info_t * info);
+#endif
+
 /**
  * Get the value of a style property. The current state of the object will be considered.
  * Inherited properties will be inherited.
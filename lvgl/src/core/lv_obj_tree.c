@@ -166,6 +166,7 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
     parent->spec_attr->children[lv_obj_get_child_cnt(parent) - 1] = obj;
 
     obj->parent = parent;
+    _lv_obj_style_cache_invalidate_obj(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);    /*The inherited properties might change*/
 
     /*Notify the original parent because one of its children is lost*/
     lv_obj_scrollbar_invalidate(old_parent);
@@ -176,7 +177,7 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
     lv_event_send(parent, LV_EVENT_CHILD_CHANGED, obj);
     lv_event_send(parent, LV_EVENT_CHILD_CREATED, NULL);
 
-    lv_obj_mark_layout_as_dirty(obj);
+    _lv_obj_mark_layout_as_dirty(obj);
 
     lv_obj_invalidate(obj);
 }
@@ -52,6 +52,8 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static void refr_copy_area(void);
+static int32_t get_join_cost(const lv_area_t * a1, const lv_area_t * a2);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p);
@@ -59,9 +61,16 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
+static void refr_obj_main(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, const lv_area_t * clip, const lv_area_t * parts,
+                          uint32_t part_cnt);
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h);
 static void draw_buf_flush(lv_disp_t * disp);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+#if LV_USE_REFR_OCCLUSION
+    static void refr_obj_occluded(lv_draw_ctx_t * draw_ctx, lv_obj_t * parent, uint32_t idx);
+    static bool cut_occluded(lv_area_t * area, lv_obj_t * parent, uint32_t start, const lv_area_t * bound,
+                             lv_area_t * hole);
+#endif
 
 #if LV_USE_PERF_MONITOR
     static void perf_monitor_init(perf_monitor_t * perf_monitor);
@@ -69,6 +78,9 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
 #if LV_USE_MEM_MONITOR
     static void mem_monitor_init(mem_monitor_t * mem_monitor);
 #endif
+#if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
+    static bool monitor_is_shown(void);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -76,6 +88,11 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
 static uint32_t px_num;
 static lv_disp_t * disp_refr; /*Display being refreshed*/
 
+#if LV_USE_REFR_OCCLUSION
+    static lv_refr_overdraw_t overdraw;
+    static lv_refr_overdraw_t overdraw_last;
+#endif
+
 #if LV_USE_PERF_MONITOR
     static perf_monitor_t   perf_monitor;
 #endif
@@ -127,6 +144,30 @@ void lv_refr_now(lv_disp_t * disp)
     }
 }
 
+/**
+ * Send the main draw events of an object
+ * @param draw_ctx  pointer to the current draw context
+ * @param obj       the object to draw
+ * @param clip      clip area of the object, `LV_EVENT_DRAW_MAIN_BEGIN/END` are sent once with it
+ * @param parts     `LV_EVENT_DRAW_MAIN` is sent once for each of these areas (parts of `clip`)
+ * @param part_cnt  number of areas in `parts`, can be 0 if the object is fully covered
+ */
+static void refr_obj_main(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, const lv_area_t * clip, const lv_area_t * parts,
+                          uint32_t part_cnt)
+{
+    draw_ctx->clip_area = clip;
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, draw_ctx);
+
+    uint32_t i;
+    for(i = 0; i < part_cnt; i++) {
+        draw_ctx->clip_area = &parts[i];
+        lv_event_send(obj, LV_EVENT_DRAW_MAIN, draw_ctx);
+    }
+
+    draw_ctx->clip_area = clip;
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, draw_ctx);
+}
+
 void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 {
     const lv_area_t * clip_area_ori = draw_ctx->clip_area;
@@ -141,24 +182,6 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     /*If the object is visible on the current clip area OR has overflow visible draw it.
      *With overflow visible drawing should happen to apply the masks which might affect children */
     bool should_draw = com_clip_res || lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
-    if(should_draw) {
-        draw_ctx->clip_area = &clip_coords_for_obj;
-
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, draw_ctx);
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN, draw_ctx);
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, draw_ctx);
-#if LV_USE_REFR_DEBUG
-        lv_color_t debug_color = lv_color_make(lv_rand(0, 0xFF), lv_rand(0, 0xFF), lv_rand(0, 0xFF));
-        lv_draw_rect_dsc_t draw_dsc;
-        lv_draw_rect_dsc_init(&draw_dsc);
-        draw_dsc.bg_color.full = debug_color.full;
-        draw_dsc.bg_opa = LV_OPA_20;
-        draw_dsc.border_width = 1;
-        draw_dsc.border_opa = LV_OPA_30;
-        draw_dsc.border_color = debug_color;
-        lv_draw_rect(draw_ctx, &draw_dsc, &obj_coords_ext);
-#endif
-    }
 
     /*With overflow visible keep the previous clip area to let the children visible out of this object too
      *With not overflow visible limit the clip are to the object's coordinates to clip the children*/
@@ -173,13 +196,81 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
         }
     }
 
+#if LV_USE_REFR_OCCLUSION
+    /*Don't draw the parts of the object which will be covered by its opaque children anyway.
+     *A clip corner masks the children too so they can't cover anything in this case.
+     *Draw event callbacks might expect to draw on the whole area so draw such objects normally.*/
+    if(com_clip_res && refr_children && !lv_obj_get_style_clip_corner(obj, LV_PART_MAIN) &&
+       !_lv_obj_has_event_cb_in_range(obj, LV_EVENT_DRAW_MAIN_BEGIN, LV_EVENT_DRAW_PART_END)) {
+        lv_area_t clip_coords_for_main = clip_coords_for_obj;
+        lv_area_t hole;
+        uint32_t area_ori = lv_area_get_size(&clip_coords_for_main);
+        if(cut_occluded(&clip_coords_for_main, obj, 0, &clip_coords_for_children, &hole) == false) {
+            /*Only the main drawing is left out, the begin and end events are still sent*/
+            refr_obj_main(draw_ctx, obj, &clip_coords_for_obj, NULL, 0);
+            overdraw.culled_px += area_ori;
+        }
+        else {
+            uint32_t area_main = lv_area_get_size(&clip_coords_for_main);
+            uint32_t area_hole = lv_area_get_size(&hole);
+            /*Splitting the area has some overhead so do it only if the covered part is large enough*/
+            if(area_hole < area_main / 4) {
+                refr_obj_main(draw_ctx, obj, &clip_coords_for_obj, &clip_coords_for_main, 1);
+                area_hole = 0;
+            }
+            else {
+                /*Draw the strips around the covered area*/
+                const lv_area_t * m = &clip_coords_for_main;
+                lv_area_t strips[4];
+                uint32_t strip_cnt = 0;
+                lv_area_set(&strips[strip_cnt], m->x1, m->y1, m->x2, hole.y1 - 1);
+                if(hole.y1 > m->y1) strip_cnt++;
+                lv_area_set(&strips[strip_cnt], m->x1, hole.y2 + 1, m->x2, m->y2);
+                if(hole.y2 < m->y2) strip_cnt++;
+                lv_area_set(&strips[strip_cnt], m->x1, hole.y1, hole.x1 - 1, hole.y2);
+                if(hole.x1 > m->x1) strip_cnt++;
+                lv_area_set(&strips[strip_cnt], hole.x2 + 1, hole.y1, m->x2, hole.y2);
+                if(hole.x2 < m->x2) strip_cnt++;
+                refr_obj_main(draw_ctx, obj, &clip_coords_for_obj, strips, strip_cnt);
+            }
+            overdraw.drawn_px += area_main - area_hole;
+            overdraw.culled_px += area_ori - area_main + area_hole;
+        }
+    }
+    else if(should_draw) {
+        if(com_clip_res) overdraw.drawn_px += lv_area_get_size(&clip_coords_for_obj);
+        refr_obj_main(draw_ctx, obj, &clip_coords_for_obj, &clip_coords_for_obj, 1);
+    }
+#else
+    if(should_draw) refr_obj_main(draw_ctx, obj, &clip_coords_for_obj, &clip_coords_for_obj, 1);
+#endif
+
+#if LV_USE_REFR_DEBUG
+    if(should_draw) {
+        draw_ctx->clip_area = &clip_coords_for_obj;
+        lv_color_t debug_color = lv_color_make(lv_rand(0, 0xFF), lv_rand(0, 0xFF), lv_rand(0, 0xFF));
+        lv_draw_rect_dsc_t draw_dsc;
+        lv_draw_rect_dsc_init(&draw_dsc);
+        draw_dsc.bg_color.full = debug_color.full;
+        draw_dsc.bg_opa = LV_OPA_20;
+        draw_dsc.border_width = 1;
+        draw_dsc.border_opa = LV_OPA_30;
+        draw_dsc.border_color = debug_color;
+        lv_draw_rect(draw_ctx, &draw_dsc, &obj_coords_ext);
+    }
+#endif
+
     if(refr_children) {
         draw_ctx->clip_area = &clip_coords_for_children;
         uint32_t i;
         uint32_t child_cnt = lv_obj_get_child_cnt(obj);
         for(i = 0; i < child_cnt; i++) {
+#if LV_USE_REFR_OCCLUSION
+            refr_obj_occluded(draw_ctx, obj, i);
+#else
             lv_obj_t * child = obj->spec_attr->children[i];
             refr_obj(draw_ctx, child);
+#endif
         }
     }
 
@@ -216,6 +307,7 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+        disp->copy_pending = 0;
         return;
     }
 
@@ -250,15 +342,116 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     /*Save the area*/
     if(disp->inv_p < LV_INV_BUF_SIZE) {
         lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_p++;
     }
-    else {   /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        lv_area_copy(&disp->inv_areas[disp->inv_p], &scr_area);
+    else {
+        /*If no place for the area do the join which costs the least.
+         *Either join the new area into a saved one or join two saved areas and save the new area in the freed slot*/
+        uint16_t best_in = 0;
+        uint16_t best_from = LV_INV_BUF_SIZE;   /*LV_INV_BUF_SIZE means the new area*/
+        int32_t best_cost = INT32_MAX;
+        uint16_t j;
+        for(i = 0; i < disp->inv_p; i++) {
+            int32_t cost = get_join_cost(&disp->inv_areas[i], &com_area);
+            if(cost < best_cost) {
+                best_cost = cost;
+                best_in = i;
+                best_from = LV_INV_BUF_SIZE;
+            }
+
+            for(j = i + 1; j < disp->inv_p; j++) {
+                cost = get_join_cost(&disp->inv_areas[i], &disp->inv_areas[j]);
+                if(cost < best_cost) {
+                    best_cost = cost;
+                    best_in = i;
+                    best_from = j;
+                }
+            }
+        }
+
+        if(best_from == LV_INV_BUF_SIZE) {
+            _lv_area_join(&disp->inv_areas[best_in], &disp->inv_areas[best_in], &com_area);
+        }
+        else {
+            _lv_area_join(&disp->inv_areas[best_in], &disp->inv_areas[best_in], &disp->inv_areas[best_from]);
+            lv_area_copy(&disp->inv_areas[best_from], &com_area);
+        }
     }
-    disp->inv_p++;
     if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
 }
 
+/**
+ * Move the already rendered content of an area on the display instead of redrawing it.
+ * The pixels are moved by the display driver's `copy_cb` before the next refresh
+ * and only the uncovered parts are invalidated.
+ * @param disp  pointer to a display (NULL to use the default display)
+ * @param area  the area whose content should be moved
+ * @param dx    move the content horizontally by this value
+ * @param dy    move the content vertically by this value
+ * @return      true: the copy will be done; false: the copy is not possible, `area` should be invalidated
+ */
+bool _lv_inv_area_copy(lv_disp_t * disp, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy)
+{
+    if(!disp) disp = lv_disp_get_default();
+    if(!disp) return false;
+
+    lv_disp_drv_t * drv = disp->driver;
+    if(drv->copy_cb == NULL) return false;
+    if(!lv_disp_is_invalidation_enabled(disp)) return false;
+    if(disp->rendering_in_progress) return false;
+
+    /*The copy works only if the previous frame is kept on the display as it is*/
+    if(drv->full_refresh || drv->direct_mode || drv->screen_transp) return false;
+    if(drv->sw_rotate && drv->rotated != LV_DISP_ROT_NONE) return false;
+
+    /*Only one area can be moved per refresh. A further scroll of the same area is added to its offset*/
+    lv_point_t ofs = {dx, dy};
+    if(disp->copy_pending) {
+        if(!_lv_area_is_equal(&disp->copy_area, area)) return false;
+        ofs.x += disp->copy_ofs.x;
+        ofs.y += disp->copy_ofs.y;
+    }
+
+    if(LV_ABS(ofs.x) >= lv_area_get_width(area) || LV_ABS(ofs.y) >= lv_area_get_height(area)) {
+        /*Nothing remains visible from the original content*/
+        disp->copy_pending = 0;
+        _lv_inv_area(disp, area);
+        return true;
+    }
+
+    /*The not yet rendered parts are moved too. Invalidate them on their new position as well.*/
+    uint16_t inv_p = disp->inv_p;
+    uint16_t i;
+    for(i = 0; i < inv_p; i++) {
+        lv_area_t moved;
+        if(!_lv_area_intersect(&moved, &disp->inv_areas[i], area)) continue;
+        lv_area_move(&moved, dx, dy);
+        if(_lv_area_intersect(&moved, &moved, area)) _lv_inv_area(disp, &moved);
+    }
+
+    disp->copy_area = *area;
+    disp->copy_ofs = ofs;
+    disp->copy_pending = 1;
+
+    /*Invalidate the uncovered strips*/
+    lv_area_t strip;
+    if(ofs.y != 0) {
+        strip = *area;
+        if(ofs.y > 0) strip.y2 = area->y1 + ofs.y - 1;
+        else strip.y1 = area->y2 + ofs.y + 1;
+        _lv_inv_area(disp, &strip);
+    }
+    if(ofs.x != 0) {
+        strip = *area;
+        if(ofs.x > 0) strip.x2 = area->x1 + ofs.x - 1;
+        else strip.x1 = area->x2 + ofs.x + 1;
+        _lv_inv_area(disp, &strip);
+    }
+
+    if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
+    return true;
+}
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -290,15 +483,14 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     uint32_t start = lv_tick_get();
     volatile uint32_t elaps = 0;
 
+#if LV_USE_ANIM_BATCH
+    /*Step the animations now if they are due, so this frame shows their new values
+     *and their invalidations are drawn now instead of in the next refresh period*/
+    _lv_anim_refr_frame();
+#endif
+
     if(tmr) {
         disp_refr = tmr->user_data;
-#if LV_USE_PERF_MONITOR == 0 && LV_USE_MEM_MONITOR == 0
-        /**
-         * Ensure the timer does not run again automatically.
-         * This is done before refreshing in case refreshing invalidates something else.
-         */
-        lv_timer_pause(tmr);
-#endif
     }
     else {
         disp_refr = lv_disp_get_default();
@@ -310,15 +502,18 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
 
     lv_obj_update_layout(disp_refr->top_layer);
     lv_obj_update_layout(disp_refr->sys_layer);
+    _lv_obj_layout_frame_end();
 
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
+        if(tmr) lv_timer_pause(tmr);
         LV_LOG_WARN("there is no active screen");
         REFR_TRACE("finished");
         return;
     }
 
+    refr_copy_area();
     lv_refr_join_area();
     refr_sync_areas();
     refr_invalid_areas();
@@ -447,6 +642,15 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     }
 #endif
 
+    /*Ensure the timer does not run again until something is invalidated.
+     *Checked at the end because the layout update above invalidates areas which are already drawn now.
+     *A shown monitor is an exception: it's updated by this timer, so keep it running.*/
+    bool idle = disp_refr->inv_p == 0;
+#if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
+    if(monitor_is_shown()) idle = false;
+#endif
+    if(tmr && idle) lv_timer_pause(tmr);
+
     REFR_TRACE("finished");
 }
 
@@ -466,6 +670,14 @@ uint32_t lv_refr_get_fps_avg(void)
 }
 #endif
 
+#if LV_USE_REFR_OCCLUSION
+void lv_refr_get_overdraw(lv_refr_overdraw_t * info)
+{
+    LV_ASSERT_NULL(info);
+    *info = overdraw_last;
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -477,7 +689,6 @@ static void lv_refr_join_area(void)
 {
     uint32_t join_from;
     uint32_t join_in;
-    lv_area_t joined_area;
     for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
         if(disp_refr->inv_area_joined[join_in] != 0) continue;
 
@@ -493,12 +704,10 @@ static void lv_refr_join_area(void)
                 continue;
             }
 
-            _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
-
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+            /*Join two area only if it's cheaper than refreshing them separately*/
+            if(get_join_cost(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) < 0) {
+                _lv_area_join(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_in],
+                              &disp_refr->inv_areas[join_from]);
 
                 /*Mark 'join_form' is joined into 'join_in'*/
                 disp_refr->inv_area_joined[join_from] = 1;
@@ -507,6 +716,45 @@ static void lv_refr_join_area(void)
     }
 }
 
+/**
+ * Move the content of the area scrolled since the last refresh with the driver's `copy_cb`
+ */
+static void refr_copy_area(void)
+{
+    if(!disp_refr->copy_pending) return;
+    disp_refr->copy_pending = 0;
+
+    if(disp_refr->copy_ofs.x == 0 && disp_refr->copy_ofs.y == 0) return;
+
+    /*The previous frame needs to be on the display to move it*/
+    lv_disp_drv_t * drv = disp_refr->driver;
+    while(drv->draw_buf->flushing) {
+        if(drv->wait_cb) drv->wait_cb(drv);
+    }
+
+    lv_area_t offset_area = disp_refr->copy_area;
+    lv_area_move(&offset_area, drv->offset_x, drv->offset_y);
+    if(!drv->copy_cb(drv, &offset_area, disp_refr->copy_ofs.x, disp_refr->copy_ofs.y)) {
+        _lv_inv_area(disp_refr, &disp_refr->copy_area);
+    }
+}
+
+/**
+ * Tell how much more expensive it is to refresh two areas joined than separately.
+ * @param a1    pointer to an area
+ * @param a2    pointer to an other area
+ * @return      the extra pixels of the joined area minus the cost of refreshing an extra area.
+ *              Negative if joining is cheaper.
+ */
+static int32_t get_join_cost(const lv_area_t * a1, const lv_area_t * a2)
+{
+    lv_area_t joined_area;
+    _lv_area_join(&joined_area, a1, a2);
+
+    return (int32_t)lv_area_get_size(&joined_area) - (int32_t)lv_area_get_size(a1) - (int32_t)lv_area_get_size(a2) -
+           LV_DISP_INV_AREA_COST;
+}
+
 /**
  * Refresh the sync areas
  */
@@ -585,6 +833,9 @@ static void refr_sync_areas(void)
 static void refr_invalid_areas(void)
 {
     px_num = 0;
+#if LV_USE_REFR_OCCLUSION
+    lv_memset_00(&overdraw, sizeof(overdraw));
+#endif
 
     if(disp_refr->inv_p == 0) return;
 
@@ -619,6 +870,11 @@ static void refr_invalid_areas(void)
         }
     }
 
+#if LV_USE_REFR_OCCLUSION
+    overdraw.px_num = px_num;
+    overdraw_last = overdraw;
+#endif
+
     disp_refr->rendering_in_progress = false;
 }
 
@@ -871,7 +1127,11 @@ static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj)
             }
             else {
                 /*Refresh the objects*/
+#if LV_USE_REFR_OCCLUSION
+                refr_obj_occluded(draw_ctx, parent, i);
+#else
                 refr_obj(draw_ctx, child);
+#endif
             }
         }
 
@@ -1046,6 +1306,116 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     }
 }
 
+#if LV_USE_REFR_OCCLUSION
+/**
+ * Refresh a child of `parent` but leave out the parts of it which are covered by its younger siblings.
+ * @param draw_ctx  pointer to the current draw context. Its clip area is the clip area of the children of `parent`
+ * @param parent    the parent of the child to refresh
+ * @param idx       index of the child to refresh
+ */
+static void refr_obj_occluded(lv_draw_ctx_t * draw_ctx, lv_obj_t * parent, uint32_t idx)
+{
+    lv_obj_t * obj = parent->spec_attr->children[idx];
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+    /*With overflow visible the children can be drawn anywhere so the covered area can't be limited.
+     *Draw event callbacks might draw anywhere too or expect all the draw events.*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE) ||
+       _lv_obj_has_event_cb_in_range(obj, LV_EVENT_DRAW_MAIN_BEGIN, LV_EVENT_DRAW_PART_END)) {
+        refr_obj(draw_ctx, obj);
+        return;
+    }
+
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+    lv_area_t obj_coords_ext;
+    lv_obj_get_coords(obj, &obj_coords_ext);
+    lv_coord_t ext_draw_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&obj_coords_ext, ext_draw_size, ext_draw_size);
+
+    lv_area_t clip_coords_for_obj;
+    if(!_lv_area_intersect(&clip_coords_for_obj, clip_area_ori, &obj_coords_ext)) return;
+
+    uint32_t area_ori = lv_area_get_size(&clip_coords_for_obj);
+    if(cut_occluded(&clip_coords_for_obj, parent, idx + 1, clip_area_ori, NULL) == false) {
+        overdraw.culled_px += area_ori;
+        overdraw.culled_obj_cnt++;
+        return;
+    }
+    overdraw.culled_px += area_ori - lv_area_get_size(&clip_coords_for_obj);
+
+    draw_ctx->clip_area = &clip_coords_for_obj;
+    refr_obj(draw_ctx, obj);
+    draw_ctx->clip_area = clip_area_ori;
+}
+
+/**
+ * Remove the parts of an area which are covered by the children of `parent`.
+ * Only the strips of full width or full height on the edges of the area are removed
+ * to keep the remaining area a rectangle.
+ * @param area      the area to reduce
+ * @param parent    the children of this object are the covering candidates
+ * @param start     index of the first child to check
+ * @param bound     the children are clipped to this area when drawn
+ * @param hole      if not NULL the largest covered area inside the remaining `area` is stored here
+ *                  (its size is 0 if there is no such area)
+ * @return          false: the whole area is covered; true: some parts of `area` remained
+ */
+static bool cut_occluded(lv_area_t * area, lv_obj_t * parent, uint32_t start, const lv_area_t * bound,
+                         lv_area_t * hole)
+{
+    if(hole) lv_area_set(hole, 0, 0, -1, -1);
+
+    /*The masks would be applied on the covering objects too*/
+    if(lv_draw_mask_is_any(area)) return true;
+
+    uint32_t child_cnt = lv_obj_get_child_cnt(parent);
+    uint32_t i;
+    for(i = start; i < child_cnt; i++) {
+        lv_obj_t * child = parent->spec_attr->children[i];
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) continue;
+        if(_lv_obj_get_layer_type(child) != LV_LAYER_TYPE_NONE) continue;
+
+        lv_area_t cover;
+        if(!_lv_area_intersect(&cover, area, &child->coords)) continue;
+        if(!_lv_area_intersect(&cover, &cover, bound)) continue;
+
+        /*Only a strip on the top/bottom or left/right can be removed*/
+        bool full_w = cover.x1 == area->x1 && cover.x2 == area->x2;
+        bool full_h = cover.y1 == area->y1 && cover.y2 == area->y2;
+        bool hor_strip = full_w && (cover.y1 == area->y1 || cover.y2 == area->y2);
+        bool ver_strip = full_h && (cover.x1 == area->x1 || cover.x2 == area->x2);
+        if(!hor_strip && !ver_strip && hole == NULL) continue;
+
+        lv_cover_check_info_t info;
+        info.res = LV_COVER_RES_COVER;
+        info.area = &cover;
+        lv_event_send(child, LV_EVENT_COVER_CHECK, &info);
+        if(info.res != LV_COVER_RES_COVER) continue;
+
+        if(full_w && full_h) return false;
+
+        if(!hor_strip && !ver_strip) {
+            if(lv_area_get_size(&cover) > lv_area_get_size(hole)) *hole = cover;
+        }
+        else if(hor_strip) {
+            if(cover.y1 == area->y1) area->y1 = cover.y2 + 1;
+            else area->y2 = cover.y1 - 1;
+        }
+        else {
+            if(cover.x1 == area->x1) area->x1 = cover.x2 + 1;
+            else area->x2 = cover.x1 - 1;
+        }
+    }
+
+    /*The hole might be cut by the strips found later*/
+    if(hole && lv_area_get_size(hole) > 0) {
+        if(!_lv_area_intersect(hole, hole, area)) lv_area_set(hole, 0, 0, -1, -1);
+    }
+
+    return true;
+}
+#endif /*LV_USE_REFR_OCCLUSION*/
+
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h)
 {
     int32_t max_row = (uint32_t)disp->driver->draw_buf->size / area_w;
@@ -1322,6 +1692,25 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
     drv->flush_cb(drv, &offset_area, color_p);
 }
 
+#if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
+/**
+ * Tell whether a performance or memory monitor is shown on the refreshed display
+ * @return true: a monitor's label exists and isn't hidden
+ */
+static bool monitor_is_shown(void)
+{
+#if LV_USE_PERF_MONITOR && LV_USE_LABEL
+    if(perf_monitor.perf_label && lv_obj_get_disp(perf_monitor.perf_label) == disp_refr &&
+       !lv_obj_has_flag(perf_monitor.perf_label, LV_OBJ_FLAG_HIDDEN)) return true;
+#endif
+#if LV_USE_MEM_MONITOR && LV_MEM_CUSTOM == 0 && LV_USE_LABEL
+    if(mem_monitor.mem_label && lv_obj_get_disp(mem_monitor.mem_label) == disp_refr &&
+       !lv_obj_has_flag(mem_monitor.mem_label, LV_OBJ_FLAG_HIDDEN)) return true;
+#endif
+    return false;
+}
+#endif
+
 #if LV_USE_PERF_MONITOR
 static void perf_monitor_init(perf_monitor_t * _perf_monitor)
 {
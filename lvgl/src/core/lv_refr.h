@@ -26,6 +26,19 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_REFR_OCCLUSION
+/**
+ * Pixel counters of the last refresh.
+ * `drawn_px / px_num` tells how many times a pixel was drawn on average.
+ */
+typedef struct {
+    uint32_t px_num;            /**< Number of refreshed pixels*/
+    uint32_t drawn_px;          /**< Sum of the areas the widgets were drawn on*/
+    uint32_t culled_px;         /**< Sum of the areas skipped because they were covered*/
+    uint32_t culled_obj_cnt;    /**< Number of widgets skipped with their children*/
+} lv_refr_overdraw_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -71,6 +84,18 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
  */
 void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p);
 
+/**
+ * Move the already rendered content of an area on the display instead of redrawing it.
+ * The pixels are moved by the display driver's `copy_cb` before the next refresh
+ * and only the uncovered parts are invalidated.
+ * @param disp  pointer to a display (NULL to use the default display)
+ * @param area  the area whose content should be moved
+ * @param dx    move the content horizontally by this value
+ * @param dy    move the content vertically by this value
+ * @return      true: the copy will be done; false: the copy is not possible, `area` should be invalidated
+ */
+bool _lv_inv_area_copy(lv_disp_t * disp, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy);
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -98,6 +123,14 @@ void lv_refr_reset_fps_counter(void);
 uint32_t lv_refr_get_fps_avg(void);
 #endif
 
+#if LV_USE_REFR_OCCLUSION
+/**
+ * Get how much drawing was done and saved by the occlusion culling in the last refresh
+ * @param info  store the counters here
+ */
+void lv_refr_get_overdraw(lv_refr_overdraw_t * info);
+#endif
+
 /**
  * Called periodically to handle the refreshing
  * @param timer pointer to the timer itself
@@ -39,7 +39,9 @@
 
 void lv_draw_init(void)
 {
-    /*Nothing to init now*/
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    _lv_draw_transform_cache_init();
+#endif
 }
 
 void lv_draw_wait_for_finish(lv_draw_ctx_t * draw_ctx)
@@ -243,7 +243,15 @@ static lv_res_t LV_ATTRIBUTE_FAST_MEM decode_and_draw(lv_draw_ctx_t * draw_ctx,
 {
     if(draw_dsc->opa <= LV_OPA_MIN) return LV_RES_OK;
 
+#if LV_IMG_CACHE_ASYNC
+    /*Don't wait for slow decoders. Draw nothing now, the area is redrawn when the image is decoded.*/
+    bool pending;
+    _lv_img_cache_entry_t * cdsc = _lv_img_cache_open_async(src, draw_dsc->recolor, draw_dsc->frame_id,
+                                                            draw_ctx->clip_area, &pending);
+    if(pending) return LV_RES_OK;
+#else
     _lv_img_cache_entry_t * cdsc = _lv_img_cache_open(src, draw_dsc->recolor, draw_dsc->frame_id);
+#endif
 
     if(cdsc == NULL) return LV_RES_INV;
 
@@ -314,6 +322,10 @@ static lv_res_t LV_ATTRIBUTE_FAST_MEM decode_and_draw(lv_draw_ctx_t * draw_ctx,
         uint8_t  * buf = lv_mem_buf_get(lv_area_get_width(&mask_com) *
                                         LV_IMG_PX_SIZE_ALPHA_BYTE);  /*+1 because of the possible alpha byte*/
 
+        /*The line buffer is reused for every line so it can't identify a cached transformed image*/
+        lv_draw_img_dsc_t line_dsc = *draw_dsc;
+        line_dsc.transform_cache = 0;
+
         const lv_area_t * clip_area_ori = draw_ctx->clip_area;
         lv_area_t line;
         lv_area_copy(&line, &mask_com);
@@ -338,7 +350,7 @@ static lv_res_t LV_ATTRIBUTE_FAST_MEM decode_and_draw(lv_draw_ctx_t * draw_ctx,
             }
 
             draw_ctx->clip_area = &mask_line;
-            lv_draw_img_decoded(draw_ctx, draw_dsc, &line, buf, cf);
+            lv_draw_img_decoded(draw_ctx, &line_dsc, &line, buf, cf);
             line.y1++;
             line.y2++;
             y++;
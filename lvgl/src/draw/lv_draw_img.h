@@ -43,6 +43,7 @@ typedef struct {
 
     int32_t frame_id;
     uint8_t antialias       : 1;
+    uint8_t transform_cache : 1;    /*Keep the transformed image in the transformation cache*/
 } lv_draw_img_dsc_t;
 
 struct _lv_draw_ctx_t;
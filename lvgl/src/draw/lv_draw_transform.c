@@ -10,22 +10,72 @@
 #include "lv_draw_transform.h"
 #include "../misc/lv_assert.h"
 #include "../misc/lv_area.h"
+#include "../misc/lv_gc.h"
 
 /*********************
  *      DEFINES
  *********************/
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    #define SRC_STAT_CNT    8   /*Number of images whose hit rate is followed*/
+    #define SRC_WINDOW      32  /*Decide about caching an image after this many lookups*/
+    #define SRC_GHOST_CNT   4   /*Transformations remembered without pixels while an image is not cached*/
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+typedef struct {
+    int16_t angle;
+    uint16_t zoom;
+    lv_point_t pivot;
+    uint8_t antialias;
+} transform_key_t;
+
+typedef struct {
+    const void * src_buf;   /*Decoded image data the entry was created from*/
+    lv_coord_t src_w;
+    lv_coord_t src_h;
+    lv_img_cf_t cf;
+    transform_key_t key;
+    lv_area_t area;         /*Transformed area relative to the top left corner of the image*/
+    lv_color_t * cbuf;      /*Colors of the transformed image*/
+    lv_opa_t * abuf;        /*Opacity of the transformed image*/
+    uint32_t size;          /*Size of `cbuf` and `abuf` in bytes*/
+} transform_cache_entry_t;
+
+/*Hit rate of an image. If its transformations are rarely reused (e.g. a clock's second hand
+ *stepping through 60 angles which don't fit into the budget) caching it would only evict the others.*/
+typedef struct {
+    const void * src_buf;
+    uint32_t last_use;
+    uint16_t lookup_cnt;    /*In the current window*/
+    uint16_t hit_cnt;       /*In the current window. Hits of the ghosts while bypassed.*/
+    uint8_t bypass;         /*Don't add new transformations of this image to the cache*/
+    uint8_t ghost_next;
+    transform_key_t ghosts[SRC_GHOST_CNT];
+} transform_src_stat_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    static void transform_cache_drop(transform_cache_entry_t * e);
+    static transform_src_stat_t * src_stat_get(const void * src_buf);
+    static bool src_stat_lookup(transform_src_stat_t * stat, const transform_key_t * key, bool hit);
+    static inline bool key_eq(const transform_key_t * k1, const transform_key_t * k2);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    static uint32_t transform_cache_used;
+    static transform_src_stat_t src_stats[SRC_STAT_CNT];
+    static uint32_t src_stat_use;
+    static lv_draw_transform_cache_stat_t cache_stat;
+#endif
 
 /**********************
  *      MACROS
@@ -48,6 +98,207 @@ void lv_draw_transform(lv_draw_ctx_t * draw_ctx, const lv_area_t * dest_area, co
 
 }
 
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+
+void _lv_draw_transform_cache_init(void)
+{
+    _lv_ll_init(&LV_GC_ROOT(_lv_img_transform_cache_ll), sizeof(transform_cache_entry_t));
+    transform_cache_used = 0;
+    lv_memset_00(src_stats, sizeof(src_stats));
+    src_stat_use = 0;
+    lv_memset_00(&cache_stat, sizeof(cache_stat));
+}
+
+bool _lv_draw_transform_cache_get(lv_draw_ctx_t * draw_ctx, const void * src_buf, lv_coord_t src_w, lv_coord_t src_h,
+                                  const lv_draw_img_dsc_t * draw_dsc, lv_img_cf_t cf,
+                                  const lv_color_t ** cbuf, const lv_opa_t ** abuf, lv_area_t * area)
+{
+    transform_key_t key;
+    key.angle = draw_dsc->angle;
+    key.zoom = draw_dsc->zoom;
+    key.pivot = draw_dsc->pivot;
+    key.antialias = draw_dsc->antialias;
+
+    lv_ll_t * ll = &LV_GC_ROOT(_lv_img_transform_cache_ll);
+    transform_src_stat_t * stat = src_stat_get(src_buf);
+    transform_cache_entry_t * e;
+    _LV_LL_READ(ll, e) {
+        if(e->src_buf == src_buf && e->src_w == src_w && e->src_h == src_h && e->cf == cf && key_eq(&e->key, &key)) {
+            src_stat_lookup(stat, &key, true);
+            cache_stat.hit_cnt++;
+            /*Keep the most recently used entries at the head*/
+            _lv_ll_move_before(ll, e, _lv_ll_get_head(ll));
+            *cbuf = e->cbuf;
+            *abuf = e->abuf;
+            *area = e->area;
+            return true;
+        }
+    }
+
+    /*Transform only the drawn area if the transformations of this image are rarely reused*/
+    if(!src_stat_lookup(stat, &key, false)) {
+        cache_stat.bypass_cnt++;
+        return false;
+    }
+    cache_stat.miss_cnt++;
+
+    lv_area_t tr_area;
+    _lv_img_buf_get_transformed_area(&tr_area, src_w, src_h, draw_dsc->angle, draw_dsc->zoom, &draw_dsc->pivot);
+
+    uint32_t px_cnt = lv_area_get_size(&tr_area);
+    uint32_t size = px_cnt * (sizeof(lv_color_t) + sizeof(lv_opa_t));
+    if(size > LV_IMG_TRANSFORM_CACHE_SIZE) return false;
+
+    /*Free the least recently used entries until the new one fits into the budget*/
+    while(transform_cache_used + size > LV_IMG_TRANSFORM_CACHE_SIZE) {
+        transform_cache_drop(_lv_ll_get_tail(ll));
+    }
+
+    uint8_t * buf = lv_mem_alloc(size);
+    if(buf == NULL) {
+        LV_LOG_WARN("couldn't allocate the transformed image");
+        return false;
+    }
+
+    e = _lv_ll_ins_head(ll);
+    LV_ASSERT_MALLOC(e);
+    if(e == NULL) {
+        lv_mem_free(buf);
+        return false;
+    }
+
+    e->src_buf = src_buf;
+    e->src_w = src_w;
+    e->src_h = src_h;
+    e->cf = cf;
+    e->key = key;
+    e->area = tr_area;
+    e->cbuf = (lv_color_t *)buf;
+    e->abuf = buf + px_cnt * sizeof(lv_color_t);
+    e->size = size;
+    transform_cache_used += size;
+
+    lv_draw_transform(draw_ctx, &tr_area, src_buf, src_w, src_h, src_w, draw_dsc, cf, e->cbuf, e->abuf);
+
+    *cbuf = e->cbuf;
+    *abuf = e->abuf;
+    *area = e->area;
+    return true;
+}
+
+void _lv_draw_transform_cache_invalidate_src(const void * src_buf)
+{
+    lv_ll_t * ll = &LV_GC_ROOT(_lv_img_transform_cache_ll);
+    transform_cache_entry_t * e = _lv_ll_get_head(ll);
+    while(e) {
+        transform_cache_entry_t * e_next = _lv_ll_get_next(ll, e);
+        if(src_buf == NULL || e->src_buf == src_buf) transform_cache_drop(e);
+        e = e_next;
+    }
+
+    uint32_t i;
+    for(i = 0; i < SRC_STAT_CNT; i++) {
+        if(src_buf == NULL || src_stats[i].src_buf == src_buf) lv_memset_00(&src_stats[i], sizeof(transform_src_stat_t));
+    }
+}
+
+void lv_draw_transform_cache_get_stat(lv_draw_transform_cache_stat_t * stat_p)
+{
+    *stat_p = cache_stat;
+    stat_p->used_size = transform_cache_used;
+    stat_p->entry_cnt = _lv_ll_get_len(&LV_GC_ROOT(_lv_img_transform_cache_ll));
+}
+
+#endif /*LV_IMG_TRANSFORM_CACHE_SIZE*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+static void transform_cache_drop(transform_cache_entry_t * e)
+{
+    transform_cache_used -= e->size;
+    lv_mem_free(e->cbuf);
+    _lv_ll_remove(&LV_GC_ROOT(_lv_img_transform_cache_ll), e);
+    lv_mem_free(e);
+}
+
+/**
+ * Get the hit rate statistics of an image. Reuse the least recently used slot for a new image.
+ * @param src_buf   the decoded image data
+ * @return          the statistics of the image
+ */
+static transform_src_stat_t * src_stat_get(const void * src_buf)
+{
+    transform_src_stat_t * stat = &src_stats[0];
+    uint32_t i;
+    for(i = 0; i < SRC_STAT_CNT; i++) {
+        if(src_stats[i].src_buf == src_buf) {
+            stat = &src_stats[i];
+            break;
+        }
+        if(src_stats[i].last_use < stat->last_use) stat = &src_stats[i];
+    }
+
+    if(stat->src_buf != src_buf) {
+        lv_memset_00(stat, sizeof(transform_src_stat_t));
+        stat->src_buf = src_buf;
+    }
+    stat->last_use = ++src_stat_use;
+    return stat;
+}
+
+/**
+ * Count a lookup of an image and decide whether its transformations are worth caching.
+ * At the end of every window the image is bypassed if less than 2/3 of its lookups hit,
+ * i.e. a cached transformation is drawn less than 3 times on average.
+ * While bypassed only the last few transformations are remembered as ghosts
+ * to find out if caching would hit again, e.g. after the image stopped rotating.
+ * @param stat      statistics of the image
+ * @param key       the transformation
+ * @param hit       true: the transformation was found in the cache
+ * @return          true: a missing transformation should be added to the cache
+ */
+static bool src_stat_lookup(transform_src_stat_t * stat, const transform_key_t * key, bool hit)
+{
+    /*Entries cached before the bypass are still used but don't tell if the current pattern fits*/
+    if(hit && stat->bypass) return false;
+
+    if(stat->bypass) {
+        uint32_t i;
+        for(i = 0; i < SRC_GHOST_CNT; i++) {
+            if(key_eq(&stat->ghosts[i], key)) {
+                hit = true;
+                break;
+            }
+        }
+        if(!hit) {
+            stat->ghosts[stat->ghost_next] = *key;
+            stat->ghost_next = (stat->ghost_next + 1) % SRC_GHOST_CNT;
+        }
+    }
+
+    stat->lookup_cnt++;
+    if(hit) stat->hit_cnt++;
+
+    if(stat->lookup_cnt >= SRC_WINDOW) {
+        bool bypass = stat->hit_cnt * 3 < stat->lookup_cnt * 2;
+        if(bypass && !stat->bypass) {
+            lv_memset_00(stat->ghosts, sizeof(stat->ghosts));
+            stat->ghost_next = 0;
+        }
+        stat->bypass = bypass;
+        stat->lookup_cnt = 0;
+        stat->hit_cnt = 0;
+    }
+
+    return !stat->bypass;
+}
+
+static inline bool key_eq(const transform_key_t * k1, const transform_key_t * k2)
+{
+    return k1->angle == k2->angle && k1->zoom == k2->zoom && k1->pivot.x == k2->pivot.x &&
+           k1->pivot.y == k2->pivot.y && k1->antialias == k2->antialias;
+}
+#endif
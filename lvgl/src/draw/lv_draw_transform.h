@@ -25,6 +25,16 @@ extern "C" {
  **********************/
 struct _lv_draw_ctx_t;
 
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of draws served from the cache*/
+    uint32_t miss_cnt;      /**< Number of transformations added to the cache*/
+    uint32_t bypass_cnt;    /**< Number of draws transformed in place as the image's transformations are rarely reused*/
+    uint32_t used_size;     /**< Size of the cached transformations in bytes*/
+    uint32_t entry_cnt;     /**< Number of cached transformations*/
+} lv_draw_transform_cache_stat_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -33,6 +43,45 @@ void lv_draw_transform(struct _lv_draw_ctx_t * draw_ctx, const lv_area_t * dest_
                        lv_coord_t src_w, lv_coord_t src_h,
                        lv_coord_t src_stride, const lv_draw_img_dsc_t * draw_dsc, lv_img_cf_t cf, lv_color_t * cbuf, lv_opa_t * abuf);
 
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+
+/**
+ * Initialize the image transformation cache
+ */
+void _lv_draw_transform_cache_init(void);
+
+/**
+ * Get a transformed image from the cache. If it's not cached yet transform the whole image and add it to the cache.
+ * @param draw_ctx      pointer to a draw context used to transform the image
+ * @param src_buf       the decoded image data
+ * @param src_w         width of the image
+ * @param src_h         height of the image
+ * @param draw_dsc      the angle, zoom, pivot and anti-aliasing are used from here
+ * @param cf            color format of `src_buf`
+ * @param cbuf          store the pointer to the transformed colors here
+ * @param abuf          store the pointer to the transformed opacity here
+ * @param area          store the transformed area relative to the top left corner of the image here
+ * @return              true: the transformed image is available; false: it doesn't fit into the cache
+ */
+bool _lv_draw_transform_cache_get(struct _lv_draw_ctx_t * draw_ctx, const void * src_buf, lv_coord_t src_w,
+                                  lv_coord_t src_h, const lv_draw_img_dsc_t * draw_dsc, lv_img_cf_t cf,
+                                  const lv_color_t ** cbuf, const lv_opa_t ** abuf, lv_area_t * area);
+
+/**
+ * Remove the transformed images of a decoded image data from the cache.
+ * Should be called when the decoded image data is freed or changed.
+ * @param src_buf       the decoded image data or NULL to remove all entries
+ */
+void _lv_draw_transform_cache_invalidate_src(const void * src_buf);
+
+/**
+ * Get the statistics of the image transformation cache
+ * @param stat_p        store the statistics here
+ */
+void lv_draw_transform_cache_get_stat(lv_draw_transform_cache_stat_t * stat_p);
+
+#endif /*LV_IMG_TRANSFORM_CACHE_SIZE*/
+
 /**********************
  *      MACROS
  **********************/
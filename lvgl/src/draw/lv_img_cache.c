@@ -12,29 +12,94 @@
 #include "lv_draw_img.h"
 #include "../hal/lv_hal_tick.h"
 #include "../misc/lv_gc.h"
+#include "../core/lv_refr.h"
+
+#if LV_IMG_CACHE_ASYNC
+    #include <pthread.h>
+#endif
 
 /*********************
  *      DEFINES
  *********************/
-/*Decrement life with this value on every open*/
-#define LV_IMG_CACHE_AGING 1
+/*Increment `ref` of an entry on a hit up to this value. Entries used more often survive more turns of the clock hand*/
+#define LV_IMG_CACHE_REF_MAX 3
+
+/*Marks the end of a hash bucket's chain*/
+#define HASH_END 0xFFFF
 
-/*Boost life by this factor (multiply time_to_open with this value)*/
-#define LV_IMG_CACHE_LIFE_GAIN 1
+#if LV_IMG_CACHE_ASYNC
+    #if LV_IMG_CACHE_DEF_SIZE == 0
+        #error "LV_IMG_CACHE_ASYNC requires LV_IMG_CACHE_DEF_SIZE > 0"
+    #endif
 
-/*Don't let life to be greater than this limit because it would require a lot of time to
- * "die" from very high values*/
-#define LV_IMG_CACHE_LIFE_LIMIT 1000
+    #define JOB_CNT         16  /*Max. number of images queued for decoding. Further images are opened in place.*/
+    #define JOB_POLL_PERIOD 10  /*Check the finished decodings with this period [ms]*/
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_IMG_CACHE_ASYNC
+typedef enum {
+    JOB_FREE,
+    JOB_QUEUED,         /*Waiting for the decoding thread*/
+    JOB_DECODING,
+    JOB_DONE,           /*Opened, it will be added to the cache*/
+    JOB_FAILED,         /*Couldn't be opened, draw the error until the source is invalidated*/
+} job_state_t;
+
+typedef enum {
+    THREAD_NOT_STARTED,
+    THREAD_RUNNING,
+    THREAD_FAILED,
+} thread_state_t;
+
+typedef struct {
+    lv_img_decoder_dsc_t dec_dsc;   /*Prepared with the decoder by LVGL's thread, opened by the decoding thread*/
+    uint32_t src_hash;
+    uint32_t seq;                   /*The images are decoded in the order of the requests*/
+    lv_disp_t * disp;               /*Redraw `inv_area` of this display when the decoding finished. NULL: redrawn*/
+    lv_area_t inv_area;
+    uint8_t state;                  /*`job_state_t`, protected by `job_mutex`*/
+    uint8_t canceled;               /*Close the image when it's decoded. Protected by `job_mutex`*/
+    uint8_t prefetch;               /*Queued by `lv_img_cache_prefetch()` and not drawn since then*/
+    uint32_t prefetch_size;         /*Room reserved in the cache for a prefetched image*/
+} decode_job_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static lv_res_t decoder_open_timed(lv_img_decoder_dsc_t * dsc, const void * src, lv_color_t color, int32_t frame_id);
 #if LV_IMG_CACHE_DEF_SIZE
     static bool lv_img_cache_match(const void * src1, const void * src2);
+    static uint32_t src_hash(const void * src);
+    static uint32_t data_size_get(const lv_img_decoder_dsc_t * dsc);
+    static _lv_img_cache_entry_t * entry_find(const void * src, uint32_t hash, lv_color_t color, int32_t frame_id);
+    static _lv_img_cache_entry_t * entry_open(const void * src, uint32_t hash, lv_color_t color, int32_t frame_id);
+    static _lv_img_cache_entry_t * entry_add(const lv_img_decoder_dsc_t * dec_dsc, uint32_t hash, bool uncached_ok);
+    static bool entry_fits(uint32_t size, uint32_t cnt);
+    static _lv_img_cache_entry_t * entry_get_free(uint32_t size);
+    static _lv_img_cache_entry_t * clock_evict(void);
+    static void entry_drop(_lv_img_cache_entry_t * e);
+    static lv_img_decoder_t * decoder_find(const void * src, lv_img_header_t * header);
+    static lv_res_t dsc_init(lv_img_decoder_dsc_t * dsc, lv_img_decoder_t * decoder, const lv_img_header_t * header,
+                             const void * src, lv_color_t color, int32_t frame_id);
+    static lv_res_t dsc_open(lv_img_decoder_dsc_t * dsc);
+    static void dsc_free(lv_img_decoder_dsc_t * dsc);
+#endif
+#if LV_IMG_CACHE_ASYNC
+    static _lv_img_cache_entry_t * entry_open_with(lv_img_decoder_t * decoder, const lv_img_header_t * header,
+                                                   const void * src, uint32_t hash, lv_color_t color, int32_t frame_id);
+    static decode_job_t * job_find(const void * src, uint32_t hash, lv_color_t color, int32_t frame_id);
+    static decode_job_t * job_add(lv_img_decoder_t * decoder, const lv_img_header_t * header,
+                                  const void * src, uint32_t hash, lv_color_t color, int32_t frame_id);
+    static void job_free(decode_job_t * job, bool close);
+    static void jobs_cancel(const void * src);
+    static void jobs_prefetch_reserved(uint32_t * size, uint32_t * cnt);
+    static bool thread_start(void);
+    static void * decode_thread(void * param);
+    static void job_timer_cb(lv_timer_t * timer);
 #endif
 
 /**********************
@@ -42,6 +107,23 @@
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static uint16_t entry_cnt;
+    static uint16_t bucket_cnt;         /*Power of 2*/
+    static uint16_t * buckets;          /*Index of the first entry of each bucket. Allocated after the entries*/
+    static uint16_t clock_hand;
+    static uint16_t cached_cnt;
+    static uint32_t max_size = LV_IMG_CACHE_MEM_SIZE;
+    static lv_img_cache_stat_t cache_stat;
+#endif
+
+#if LV_IMG_CACHE_ASYNC
+    static decode_job_t jobs[JOB_CNT];
+    static uint32_t job_seq;
+    static lv_timer_t * job_timer;
+    static thread_state_t thread_state;
+    static pthread_t thread;
+    static pthread_mutex_t job_mutex = PTHREAD_MUTEX_INITIALIZER;
+    static pthread_cond_t job_cond = PTHREAD_COND_INITIALIZER;      /*Signaled when a job is queued*/
+    static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;     /*Signaled when a decoding finished*/
 #endif
 
 /**********************
@@ -62,83 +144,120 @@
  */
 _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, int32_t frame_id)
 {
-    /*Is the image cached?*/
-    _lv_img_cache_entry_t * cached_src = NULL;
-
 #if LV_IMG_CACHE_DEF_SIZE
     if(entry_cnt == 0) {
         LV_LOG_WARN("lv_img_cache_open: the cache size is 0");
         return NULL;
     }
 
-    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
-
-    /*Decrement all lifes. Make the entries older*/
-    uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        if(cache[i].life > INT32_MIN + LV_IMG_CACHE_AGING) {
-            cache[i].life -= LV_IMG_CACHE_AGING;
-        }
-    }
-
-    for(i = 0; i < entry_cnt; i++) {
-        if(color.full == cache[i].dec_dsc.color.full &&
-           frame_id == cache[i].dec_dsc.frame_id &&
-           lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            /*If opened increment its life.
-             *Image difficult to open should live longer to keep avoid frequent their recaching.
-             *Therefore increase `life` with `time_to_open`*/
-            cached_src = &cache[i];
-            cached_src->life += cached_src->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN;
-            if(cached_src->life > LV_IMG_CACHE_LIFE_LIMIT) cached_src->life = LV_IMG_CACHE_LIFE_LIMIT;
-            LV_LOG_TRACE("image source found in the cache");
-            break;
-        }
+    /*Is the image cached?*/
+    uint32_t hash = src_hash(src);
+    _lv_img_cache_entry_t * cached_src = entry_find(src, hash, color, frame_id);
+    if(cached_src) {
+        if(cached_src->ref < LV_IMG_CACHE_REF_MAX) cached_src->ref++;
+        cache_stat.hit_cnt++;
+        LV_LOG_TRACE("image source found in the cache");
+        return cached_src;
     }
 
     /*The image is not cached then cache it now*/
-    if(cached_src) return cached_src;
-
-    /*Find an entry to reuse. Select the entry with the least life*/
-    cached_src = &cache[0];
-    for(i = 1; i < entry_cnt; i++) {
-        if(cache[i].life < cached_src->life) {
-            cached_src = &cache[i];
-        }
+    cache_stat.miss_cnt++;
+    return entry_open(src, hash, color, frame_id);
+#else
+    _lv_img_cache_entry_t * cached_src = &LV_GC_ROOT(_lv_img_cache_single);
+    if(decoder_open_timed(&cached_src->dec_dsc, src, color, frame_id) != LV_RES_OK) {
+        lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
+        return NULL;
     }
+    return cached_src;
+#endif
+}
+
+#if LV_IMG_CACHE_ASYNC
+/**
+ * Get an image from the cache or queue it for decoding on the background thread if it's not cached yet.
+ * Only file sources of the decoders marked with `lv_img_decoder_set_async()` are queued, the others are opened in place.
+ * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
+ * @param color The color of the image with `LV_IMG_CF_ALPHA_...`
+ * @param frame_id the index of the frame. Used only with animated images, set 0 for normal images
+ * @param inv_area redraw this area of the refreshing display when the image is decoded
+ * @param pending set to true if the image is being decoded. NULL is returned in this case.
+ * @return pointer to the cache entry or NULL if the image can't be opened or it's pending
+ */
+_lv_img_cache_entry_t * _lv_img_cache_open_async(const void * src, lv_color_t color, int32_t frame_id,
+                                                 const lv_area_t * inv_area, bool * pending)
+{
+    *pending = false;
 
-    /*Close the decoder to reuse if it was opened (has a valid source)*/
-    if(cached_src->dec_dsc.src) {
-        lv_img_decoder_close(&cached_src->dec_dsc);
-        LV_LOG_INFO("image draw: cache miss, close and reuse an entry");
+    /*Draws of a canvas or snapshot use a temporary display, they can't be redrawn later*/
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_disp_t * d;
+    _LV_LL_READ(&LV_GC_ROOT(_lv_disp_ll), d) {
+        if(d == disp) break;
     }
-    else {
-        LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
+
+    if(d == NULL || entry_cnt == 0 || lv_img_src_get_type(src) != LV_IMG_SRC_FILE) {
+        return _lv_img_cache_open(src, color, frame_id);
     }
-#else
-    cached_src = &LV_GC_ROOT(_lv_img_cache_single);
-#endif
-    /*Open the image and measure the time to open*/
-    uint32_t t_start  = lv_tick_get();
-    lv_res_t open_res = lv_img_decoder_open(&cached_src->dec_dsc, src, color, frame_id);
-    if(open_res == LV_RES_INV) {
-        LV_LOG_WARN("Image draw cannot open the image resource");
-        lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
-        cached_src->life = INT32_MIN; /*Make the empty entry very "weak" to force its us*/
-        return NULL;
+
+    uint32_t hash = src_hash(src);
+    _lv_img_cache_entry_t * cached_src = entry_find(src, hash, color, frame_id);
+    if(cached_src) {
+        if(cached_src->ref < LV_IMG_CACHE_REF_MAX) cached_src->ref++;
+        cache_stat.hit_cnt++;
+        return cached_src;
     }
 
-    cached_src->life = 0;
+    decode_job_t * job = job_find(src, hash, color, frame_id);
+    if(job) {
+        pthread_mutex_lock(&job_mutex);
+        job_state_t state = job->state;
+        pthread_mutex_unlock(&job_mutex);
 
-    /*If `time_to_open` was not set in the open function set it here*/
-    if(cached_src->dec_dsc.time_to_open == 0) {
-        cached_src->dec_dsc.time_to_open = lv_tick_elaps(t_start);
+        /*Also wait until the finished jobs redraw the areas where nothing was drawn*/
+        if(state == JOB_QUEUED || state == JOB_DECODING || job->disp) {
+            if(job->disp) _lv_area_join(&job->inv_area, &job->inv_area, inv_area);
+            else job->inv_area = *inv_area;
+            job->disp = disp;
+            job->prefetch = 0;  /*It's visible now, add it to the cache even if others are evicted*/
+            *pending = true;
+            return NULL;
+        }
+
+        /*Keep the failed job to not decode the image again on every draw*/
+        if(state == JOB_FAILED) {
+            LV_LOG_WARN("Image draw cannot open the image resource");
+            return NULL;
+        }
+
+        /*Decoded but it didn't fit into the cache. Use it for this draw.*/
+        cached_src = entry_add(&job->dec_dsc, hash, true);
+        job_free(job, false);
+        return cached_src;
     }
 
-    if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
+    cache_stat.miss_cnt++;
 
-    return cached_src;
+    /*Look for the decoder only once: it's used to open the image here or on the decoding thread*/
+    lv_img_header_t header;
+    lv_img_decoder_t * decoder = decoder_find(src, &header);
+    if(decoder && decoder->async) job = job_add(decoder, &header, src, hash, color, frame_id);
+    if(job == NULL) return entry_open_with(decoder, &header, src, hash, color, frame_id);
+
+    job->disp = disp;
+    job->inv_area = *inv_area;
+    *pending = true;
+    return NULL;
+}
+
+void _lv_img_cache_disp_removed(lv_disp_t * disp)
+{
+    uint32_t i;
+    for(i = 0; i < JOB_CNT; i++) {
+        if(jobs[i].disp == disp) jobs[i].disp = NULL;
+    }
 }
+#endif
 
 /**
  * Set the number of images to be cached.
@@ -158,17 +277,29 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
         lv_mem_free(LV_GC_ROOT(_lv_img_cache_array));
     }
 
-    /*Reallocate the cache*/
-    LV_GC_ROOT(_lv_img_cache_array) = lv_mem_alloc(sizeof(_lv_img_cache_entry_t) * new_entry_cnt);
+    /*`HASH_END` is not a valid index*/
+    if(new_entry_cnt == HASH_END) new_entry_cnt--;
+
+    uint32_t new_bucket_cnt = 1;
+    while(new_bucket_cnt < new_entry_cnt) new_bucket_cnt <<= 1;
+
+    /*Reallocate the cache. The hash buckets are stored after the entries*/
+    LV_GC_ROOT(_lv_img_cache_array) = lv_mem_alloc(sizeof(_lv_img_cache_entry_t) * new_entry_cnt +
+                                                   sizeof(uint16_t) * new_bucket_cnt);
     LV_ASSERT_MALLOC(LV_GC_ROOT(_lv_img_cache_array));
     if(LV_GC_ROOT(_lv_img_cache_array) == NULL) {
         entry_cnt = 0;
         return;
     }
     entry_cnt = new_entry_cnt;
+    bucket_cnt = new_bucket_cnt;
+    buckets = (uint16_t *)&LV_GC_ROOT(_lv_img_cache_array)[entry_cnt];
+    clock_hand = 0;
+    cached_cnt = 0;
 
     /*Clean the cache*/
     lv_memset_00(LV_GC_ROOT(_lv_img_cache_array), entry_cnt * sizeof(_lv_img_cache_entry_t));
+    lv_memset_ff(buckets, bucket_cnt * sizeof(uint16_t));
 #endif
 }
 
@@ -180,19 +311,223 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
 void lv_img_cache_invalidate_src(const void * src)
 {
     LV_UNUSED(src);
+#if LV_IMG_CACHE_ASYNC
+    jobs_cancel(src);
+#endif
 #if LV_IMG_CACHE_DEF_SIZE
     _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
 
-    uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        if(src == NULL || lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            if(cache[i].dec_dsc.src != NULL) {
-                lv_img_decoder_close(&cache[i].dec_dsc);
-            }
+    if(src == NULL) {
+        uint16_t i;
+        for(i = 0; i < entry_cnt; i++) {
+            if(cache[i].dec_dsc.src != NULL) entry_drop(&cache[i]);
+        }
+    }
+    else if(entry_cnt) {
+        uint16_t i = buckets[src_hash(src) & (bucket_cnt - 1)];
+        while(i != HASH_END) {
+            uint16_t i_next = cache[i].hash_next;
+            if(lv_img_cache_match(src, cache[i].dec_dsc.src)) entry_drop(&cache[i]);
+            i = i_next;
+        }
+    }
+
+    _lv_img_cache_entry_t * single = &LV_GC_ROOT(_lv_img_cache_single);
+    if(single->dec_dsc.src != NULL && (src == NULL || lv_img_cache_match(src, single->dec_dsc.src))) {
+        lv_img_decoder_close(&single->dec_dsc);
+        lv_memset_00(single, sizeof(_lv_img_cache_entry_t));
+    }
+#endif
+}
+
+/**
+ * Set the memory budget of the cache. Images are closed (least recently used first) until the cache fits into it.
+ * @param new_max_size  the maximal size of the decoded data of the cached images in bytes, 0: unlimited
+ */
+void lv_img_cache_set_max_size(uint32_t new_max_size)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    max_size = new_max_size;
+    while(max_size && cache_stat.used_size > max_size) {
+        if(clock_evict() == NULL) break;
+    }
+#else
+    LV_UNUSED(new_max_size);
+#endif
+}
+
+/**
+ * Open an image into the cache and keep it there until unpinned. Useful for images which are always visible.
+ * The image is pinned with the default recolor (black) and frame 0, i.e. as `lv_img` draws it by default.
+ * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
+ * @return LV_RES_OK: the image is pinned; LV_RES_INV: the image couldn't be opened or cached
+ */
+lv_res_t lv_img_cache_pin(const void * src)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    _lv_img_cache_entry_t * e = _lv_img_cache_open(src, lv_color_black(), 0);
+    if(e == NULL || e == &LV_GC_ROOT(_lv_img_cache_single)) return LV_RES_INV;
+
+    if(!e->pinned) {
+        e->pinned = 1;
+        cache_stat.pinned_cnt++;
+    }
+    return LV_RES_OK;
+#else
+    LV_UNUSED(src);
+    return LV_RES_INV;
+#endif
+}
+
+/**
+ * Let the cached entries of an image source be evicted again.
+ * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
+ */
+void lv_img_cache_unpin(const void * src)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    if(entry_cnt == 0) return;
 
-            lv_memset_00(&cache[i], sizeof(_lv_img_cache_entry_t));
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t i = buckets[src_hash(src) & (bucket_cnt - 1)];
+    while(i != HASH_END) {
+        if(cache[i].pinned && lv_img_cache_match(src, cache[i].dec_dsc.src)) {
+            cache[i].pinned = 0;
+            cache_stat.pinned_cnt--;
         }
+        i = cache[i].hash_next;
+    }
+#else
+    LV_UNUSED(src);
+#endif
+}
+
+/**
+ * Open an image into the cache before it's drawn, e.g. the images of the next page.
+ * Only the free room of the cache is used: no cached image is evicted for a prefetched one.
+ * With `LV_IMG_CACHE_ASYNC` the images of async decoders are decoded on the background thread.
+ * The image is opened with the default recolor (black) and frame 0, i.e. as `lv_img` draws it by default.
+ * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
+ * @param size store the size of the decoded data which was added or is reserved for it in the cache here.
+ *             0 if it was already cached or queued or it couldn't be prefetched. Can be NULL.
+ * @return LV_RES_OK: the image is cached or queued for decoding;
+ *         LV_RES_INV: the image couldn't be opened or it doesn't fit into the free room
+ */
+lv_res_t lv_img_cache_prefetch(const void * src, uint32_t * size)
+{
+    if(size) *size = 0;
+
+#if LV_IMG_CACHE_DEF_SIZE
+    if(entry_cnt == 0) return LV_RES_INV;
+
+    lv_color_t color = lv_color_black();
+    uint32_t hash = src_hash(src);
+    if(entry_find(src, hash, color, 0)) return LV_RES_OK;
+
+    lv_img_src_t src_type = lv_img_src_get_type(src);
+#if LV_IMG_CACHE_ASYNC
+    if(src_type == LV_IMG_SRC_FILE) {
+        decode_job_t * job = job_find(src, hash, color, 0);
+        if(job) {
+            pthread_mutex_lock(&job_mutex);
+            job_state_t state = job->state;
+            pthread_mutex_unlock(&job_mutex);
+            return state == JOB_FAILED ? LV_RES_INV : LV_RES_OK;
+        }
+    }
+#endif
+
+    /*Check the room with the size in the header to not decode images which won't fit*/
+    lv_img_header_t header;
+    lv_img_decoder_t * decoder = decoder_find(src, &header);
+    if(decoder == NULL) return LV_RES_INV;
+    uint32_t img_size = src_type == LV_IMG_SRC_FILE ? lv_img_buf_get_img_size(header.w, header.h, header.cf) : 0;
+
+#if LV_IMG_CACHE_ASYNC
+    /*The queued prefetched images will need room too*/
+    uint32_t reserved_size;
+    uint32_t reserved_cnt;
+    jobs_prefetch_reserved(&reserved_size, &reserved_cnt);
+    if(!entry_fits(reserved_size + img_size, reserved_cnt + 1)) return LV_RES_INV;
+
+    if(src_type == LV_IMG_SRC_FILE && decoder->async) {
+        decode_job_t * job = job_add(decoder, &header, src, hash, color, 0);
+        if(job) {
+            job->prefetch = 1;
+            job->prefetch_size = img_size;
+            if(size) *size = img_size;
+            return LV_RES_OK;
+        }
+    }
+#else
+    if(!entry_fits(img_size, 1)) return LV_RES_INV;
+#endif
+
+    lv_img_decoder_dsc_t dec_dsc;
+    if(dsc_init(&dec_dsc, decoder, &header, src, color, 0) != LV_RES_OK) return LV_RES_INV;
+    if(dsc_open(&dec_dsc) != LV_RES_OK) {
+        dsc_free(&dec_dsc);
+        return LV_RES_INV;
+    }
+
+    /*The decoded image might be larger than the header says*/
+    img_size = data_size_get(&dec_dsc);
+    if(!entry_fits(img_size, 1) || entry_add(&dec_dsc, hash, false) == NULL) {
+        lv_img_decoder_close(&dec_dsc);
+        return LV_RES_INV;
+    }
+    if(size) *size = img_size;
+    return LV_RES_OK;
+#else
+    LV_UNUSED(src);
+    return LV_RES_INV;
+#endif
+}
+
+/**
+ * Drop the prefetched images which are still waiting for decoding (`LV_IMG_CACHE_ASYNC`).
+ * The image being decoded is still cached if it fits.
+ */
+void lv_img_cache_prefetch_cancel(void)
+{
+#if LV_IMG_CACHE_ASYNC
+    uint32_t i;
+    for(i = 0; i < JOB_CNT; i++) {
+        decode_job_t * job = &jobs[i];
+        if(!job->prefetch) continue;
+
+        pthread_mutex_lock(&job_mutex);
+        bool queued = job->state == JOB_QUEUED;
+        if(queued) job->state = JOB_FAILED;     /*Don't let the decoding thread take it*/
+        pthread_mutex_unlock(&job_mutex);
+
+        if(queued) job_free(job, true);
+    }
+#endif
+}
+
+/**
+ * Get the statistics of the image cache
+ * @param stat_p store the statistics here
+ */
+void lv_img_cache_get_stat(lv_img_cache_stat_t * stat_p)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    *stat_p = cache_stat;
+    stat_p->max_size = max_size;
+    stat_p->entry_cnt = cached_cnt;
+#if LV_IMG_CACHE_ASYNC
+    pthread_mutex_lock(&job_mutex);
+    uint32_t i;
+    for(i = 0; i < JOB_CNT; i++) {
+        /*Also count the decoded images which are not redrawn yet*/
+        if(jobs[i].state == JOB_QUEUED || jobs[i].state == JOB_DECODING ||
+           (jobs[i].state != JOB_FREE && jobs[i].disp != NULL)) stat_p->pending_cnt++;
     }
+    pthread_mutex_unlock(&job_mutex);
+#endif
+#else
+    lv_memset_00(stat_p, sizeof(lv_img_cache_stat_t));
 #endif
 }
 
@@ -200,6 +535,28 @@ void lv_img_cache_invalidate_src(const void * src)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Open an image with the image decoders and set `time_to_open` if the decoder didn't set it
+ */
+static lv_res_t decoder_open_timed(lv_img_decoder_dsc_t * dsc, const void * src, lv_color_t color, int32_t frame_id)
+{
+    uint32_t t_start  = lv_tick_get();
+    lv_res_t open_res = lv_img_decoder_open(dsc, src, color, frame_id);
+    if(open_res == LV_RES_INV) {
+        LV_LOG_WARN("Image draw cannot open the image resource");
+        return LV_RES_INV;
+    }
+
+    /*If `time_to_open` was not set in the open function set it here*/
+    if(dsc->time_to_open == 0) {
+        dsc->time_to_open = lv_tick_elaps(t_start);
+    }
+
+    if(dsc->time_to_open == 0) dsc->time_to_open = 1;
+
+    return LV_RES_OK;
+}
+
 #if LV_IMG_CACHE_DEF_SIZE
 static bool lv_img_cache_match(const void * src1, const void * src2)
 {
@@ -212,4 +569,553 @@ static bool lv_img_cache_match(const void * src1, const void * src2)
         return false;
     return strcmp(src1, src2) == 0;
 }
+
+/**
+ * Hash an image source: the address of variables and the path of files (FNV-1a)
+ */
+static uint32_t src_hash(const void * src)
+{
+    uint32_t h;
+    if(lv_img_src_get_type(src) == LV_IMG_SRC_FILE) {
+        const uint8_t * s = src;
+        h = 2166136261U;
+        while(*s) {
+            h ^= *s;
+            h *= 16777619U;
+            s++;
+        }
+    }
+    else {
+        h = (uint32_t)(uintptr_t)src * 2654435761U;
+    }
+
+    /*The low bits select the bucket*/
+    return h ^ (h >> 16);
+}
+
+/**
+ * Size of the decoded data kept open by an image. Data of `lv_img_dsc_t` variables
+ * and data not allocated by the decoder (`img_data_not_owned`) isn't counted.
+ */
+static uint32_t data_size_get(const lv_img_decoder_dsc_t * dsc)
+{
+    if(dsc->img_data == NULL || dsc->img_data_not_owned) return 0;
+    if(dsc->src_type == LV_IMG_SRC_VARIABLE && dsc->img_data == ((const lv_img_dsc_t *)dsc->src)->data) return 0;
+
+    return lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, dsc->header.cf);
+}
+
+static _lv_img_cache_entry_t * entry_find(const void * src, uint32_t hash, lv_color_t color, int32_t frame_id)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t i = buckets[hash & (bucket_cnt - 1)];
+    while(i != HASH_END) {
+        _lv_img_cache_entry_t * e = &cache[i];
+        if(e->src_hash == hash &&
+           color.full == e->dec_dsc.color.full &&
+           frame_id == e->dec_dsc.frame_id &&
+           lv_img_cache_match(src, e->dec_dsc.src)) {
+            return e;
+        }
+        i = e->hash_next;
+    }
+
+    return NULL;
+}
+
+/**
+ * Open an image and add it to the cache
+ * @return          the entry of the image or NULL if it couldn't be opened
+ */
+static _lv_img_cache_entry_t * entry_open(const void * src, uint32_t hash, lv_color_t color, int32_t frame_id)
+{
+    /*Open it first to know the size of the decoded data*/
+    lv_img_decoder_dsc_t dec_dsc;
+    if(decoder_open_timed(&dec_dsc, src, color, frame_id) != LV_RES_OK) return NULL;
+
+    return entry_add(&dec_dsc, hash, true);
+}
+
+/**
+ * Add an opened image to the cache
+ * @param dec_dsc       the opened image. The cache takes it over unless NULL is returned.
+ * @param hash          hash of the image's source
+ * @param uncached_ok   true: if it doesn't fit into the cache keep it open only until the next uncached image
+ * @return              the entry of the image, NULL if it doesn't fit and `uncached_ok` is false
+ */
+static _lv_img_cache_entry_t * entry_add(const lv_img_decoder_dsc_t * dec_dsc, uint32_t hash, bool uncached_ok)
+{
+    uint32_t size = data_size_get(dec_dsc);
+    _lv_img_cache_entry_t * cached_src = NULL;
+    if(max_size == 0 || size <= max_size) cached_src = entry_get_free(size);
+
+    if(cached_src == NULL) {
+        if(!uncached_ok) return NULL;
+
+        /*Too large or only pinned images are cached*/
+        LV_LOG_INFO("image draw: cache miss, no room in the cache, open uncached");
+        cached_src = &LV_GC_ROOT(_lv_img_cache_single);
+        if(cached_src->dec_dsc.src) lv_img_decoder_close(&cached_src->dec_dsc);
+        lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
+        cached_src->dec_dsc = *dec_dsc;
+        return cached_src;
+    }
+
+    LV_LOG_INFO("image draw: cache miss, cached to entry %d", (int)(cached_src - LV_GC_ROOT(_lv_img_cache_array)));
+
+    cached_src->dec_dsc = *dec_dsc;
+    cached_src->src_hash = hash;
+    cached_src->size = size;
+    cached_src->ref = 0;
+    cached_src->pinned = 0;
+
+    uint16_t * bucket = &buckets[hash & (bucket_cnt - 1)];
+    cached_src->hash_next = *bucket;
+    *bucket = cached_src - LV_GC_ROOT(_lv_img_cache_array);
+
+    cached_cnt++;
+    cache_stat.used_size += size;
+    return cached_src;
+}
+
+/**
+ * Check if images can be added to the cache without evicting others
+ * @param size      total size of the images' decoded data
+ * @param cnt       number of images
+ * @return          true: there are enough free entries and the memory budget isn't exceeded
+ */
+static bool entry_fits(uint32_t size, uint32_t cnt)
+{
+    if(cached_cnt + cnt > entry_cnt) return false;
+    return max_size == 0 || cache_stat.used_size + size <= max_size;
+}
+
+/**
+ * Get an empty entry for a new image, evicting images if there is no free entry or
+ * the new image wouldn't fit into the memory budget
+ * @param size      size of the new image's decoded data
+ * @return          an empty entry or NULL if only pinned images remained
+ */
+static _lv_img_cache_entry_t * entry_get_free(uint32_t size)
+{
+    _lv_img_cache_entry_t * e = NULL;
+    while(max_size && cache_stat.used_size + size > max_size) {
+        e = clock_evict();
+        if(e == NULL) return NULL;
+    }
+    if(e) return e;
+
+    if(cached_cnt < entry_cnt) {
+        _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+        uint16_t i;
+        for(i = 0; i < entry_cnt; i++) {
+            if(cache[i].dec_dsc.src == NULL) return &cache[i];
+        }
+    }
+
+    return clock_evict();
+}
+
+/**
+ * Evict an image with the CLOCK policy: move the hand around the entries, decrement `ref` of the used ones
+ * and evict the first one with 0 `ref` which is not pinned.
+ * @return          the evicted (now empty) entry or NULL if only pinned images are cached
+ */
+static _lv_img_cache_entry_t * clock_evict(void)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+
+    /*In `LV_IMG_CACHE_REF_MAX + 1` turns every entry reaches 0 `ref`*/
+    uint32_t step_cnt = (uint32_t)entry_cnt * (LV_IMG_CACHE_REF_MAX + 1);
+    while(step_cnt--) {
+        _lv_img_cache_entry_t * e = &cache[clock_hand];
+        clock_hand++;
+        if(clock_hand == entry_cnt) clock_hand = 0;
+
+        if(e->dec_dsc.src == NULL || e->pinned) continue;
+        if(e->ref) {
+            e->ref--;
+            continue;
+        }
+
+        LV_LOG_INFO("image draw: evict entry %d", (int)(e - cache));
+        entry_drop(e);
+        cache_stat.evict_cnt++;
+        return e;
+    }
+
+    return NULL;
+}
+
+/**
+ * Close the image of an entry and remove it from the cache
+ */
+static void entry_drop(_lv_img_cache_entry_t * e)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t idx = e - cache;
+
+    uint16_t * link = &buckets[e->src_hash & (bucket_cnt - 1)];
+    while(*link != idx) link = &cache[*link].hash_next;
+    *link = e->hash_next;
+
+    cached_cnt--;
+    cache_stat.used_size -= e->size;
+    if(e->pinned) cache_stat.pinned_cnt--;
+
+    lv_img_decoder_close(&e->dec_dsc);
+    lv_memset_00(e, sizeof(_lv_img_cache_entry_t));
+}
+
+/**
+ * Find the decoder which would open an image: the first one which can read its header
+ * @param src       an image source
+ * @param header    store the header of the image here
+ * @return          the decoder or NULL if none of them knows the image
+ */
+static lv_img_decoder_t * decoder_find(const void * src, lv_img_header_t * header)
+{
+    lv_img_decoder_t * decoder;
+    _LV_LL_READ(&LV_GC_ROOT(_lv_img_decoder_ll), decoder) {
+        if(decoder->info_cb == NULL || decoder->open_cb == NULL) continue;
+        if(decoder->info_cb(decoder, src, header) == LV_RES_OK) return decoder;
+    }
+
+    return NULL;
+}
+
+/**
+ * Prepare a decoder descriptor like `lv_img_decoder_open` does but with a known decoder and header
+ * @return          LV_RES_OK: ready to be opened with `dsc_open`; LV_RES_INV: out of memory
+ */
+static lv_res_t dsc_init(lv_img_decoder_dsc_t * dsc, lv_img_decoder_t * decoder, const lv_img_header_t * header,
+                         const void * src, lv_color_t color, int32_t frame_id)
+{
+    lv_memset_00(dsc, sizeof(lv_img_decoder_dsc_t));
+    dsc->color = color;
+    dsc->src_type = lv_img_src_get_type(src);
+    dsc->frame_id = frame_id;
+    dsc->header = *header;
+    dsc->decoder = decoder;
+
+    if(dsc->src_type == LV_IMG_SRC_FILE) {
+        size_t len = strlen(src);
+        char * src_copy = lv_mem_alloc(len + 1);
+        LV_ASSERT_MALLOC(src_copy);
+        if(src_copy == NULL) return LV_RES_INV;
+        lv_memcpy(src_copy, src, len + 1);
+        dsc->src = src_copy;
+    }
+    else {
+        dsc->src = src;
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Open a descriptor prepared by `dsc_init` with its decoder and set `time_to_open`.
+ * Runs on the decoding thread too, so it doesn't log.
+ * @return          LV_RES_OK: opened; LV_RES_INV: the decoder failed, free the descriptor with `dsc_free`
+ */
+static lv_res_t dsc_open(lv_img_decoder_dsc_t * dsc)
+{
+    uint32_t t_start = lv_tick_get();
+    if(dsc->decoder->open_cb(dsc->decoder, dsc) != LV_RES_OK) return LV_RES_INV;
+
+    if(dsc->time_to_open == 0) dsc->time_to_open = lv_tick_elaps(t_start);
+    if(dsc->time_to_open == 0) dsc->time_to_open = 1;
+    return LV_RES_OK;
+}
+
+/**
+ * Free a descriptor prepared by `dsc_init` which is not opened
+ */
+static void dsc_free(lv_img_decoder_dsc_t * dsc)
+{
+    if(dsc->src_type == LV_IMG_SRC_FILE) lv_mem_free((void *)dsc->src);
+    dsc->src = NULL;
+}
+#endif
+
+#if LV_IMG_CACHE_ASYNC
+/**
+ * Open an image with the decoder found for it and add it to the cache
+ * @param decoder   the decoder returned by `decoder_find` for `src` or NULL
+ * @param header    the header returned by `decoder_find`
+ * @return          the entry of the image or NULL if it couldn't be opened
+ */
+static _lv_img_cache_entry_t * entry_open_with(lv_img_decoder_t * decoder, const lv_img_header_t * header,
+                                               const void * src, uint32_t hash, lv_color_t color, int32_t frame_id)
+{
+    if(decoder == NULL) {
+        LV_LOG_WARN("Image draw cannot open the image resource");
+        return NULL;
+    }
+
+    lv_img_decoder_dsc_t dec_dsc;
+    if(dsc_init(&dec_dsc, decoder, header, src, color, frame_id) != LV_RES_OK) return NULL;
+    if(dsc_open(&dec_dsc) != LV_RES_OK) {
+        /*An other decoder might open it*/
+        dsc_free(&dec_dsc);
+        return entry_open(src, hash, color, frame_id);
+    }
+
+    return entry_add(&dec_dsc, hash, true);
+}
+
+static decode_job_t * job_find(const void * src, uint32_t hash, lv_color_t color, int32_t frame_id)
+{
+    decode_job_t * job = NULL;
+    uint32_t i;
+    pthread_mutex_lock(&job_mutex);
+    for(i = 0; i < JOB_CNT; i++) {
+        if(jobs[i].state == JOB_FREE || jobs[i].canceled) continue;
+        if(jobs[i].src_hash == hash && jobs[i].dec_dsc.color.full == color.full &&
+           jobs[i].dec_dsc.frame_id == frame_id && strcmp(jobs[i].dec_dsc.src, src) == 0) {
+            job = &jobs[i];
+            break;
+        }
+    }
+    pthread_mutex_unlock(&job_mutex);
+
+    return job;
+}
+
+/**
+ * Queue an image for decoding. The decoding thread only calls the `open_cb` of the given decoder.
+ * @param decoder   the decoder returned by `decoder_find` for `src`
+ * @param header    the header returned by `decoder_find`
+ * @return          the new job or NULL if all jobs are in use or the decoding thread couldn't be started
+ */
+static decode_job_t * job_add(lv_img_decoder_t * decoder, const lv_img_header_t * header,
+                              const void * src, uint32_t hash, lv_color_t color, int32_t frame_id)
+{
+    if(!thread_start()) return NULL;
+
+    /*Use a free job, one which was decoded but not drawn since then or a queued prefetch*/
+    decode_job_t * job = NULL;
+    decode_job_t * job_finished = NULL;
+    decode_job_t * job_prefetch = NULL;
+    uint32_t i;
+    pthread_mutex_lock(&job_mutex);
+    for(i = 0; i < JOB_CNT; i++) {
+        if(jobs[i].state == JOB_FREE) {
+            job = &jobs[i];
+            break;
+        }
+        if(job_finished == NULL && (jobs[i].state == JOB_DONE || jobs[i].state == JOB_FAILED)) job_finished = &jobs[i];
+        if(job_prefetch == NULL && jobs[i].state == JOB_QUEUED && jobs[i].prefetch) job_prefetch = &jobs[i];
+    }
+    if(job == NULL && job_finished == NULL && job_prefetch) {
+        job_prefetch->state = JOB_FAILED;   /*Don't let the decoding thread take it*/
+        job_finished = job_prefetch;
+    }
+    pthread_mutex_unlock(&job_mutex);
+
+    if(job == NULL && job_finished) {
+        job_free(job_finished, true);
+        job = job_finished;
+    }
+    if(job == NULL) {
+        LV_LOG_INFO("image draw: decoding queue is full, open in place");
+        return NULL;
+    }
+
+    if(dsc_init(&job->dec_dsc, decoder, header, src, color, frame_id) != LV_RES_OK) return NULL;
+    job->src_hash = hash;
+    job->seq = job_seq++;
+    job->canceled = 0;
+
+    if(job_timer == NULL) {
+        job_timer = lv_timer_create(job_timer_cb, JOB_POLL_PERIOD, NULL);
+        LV_ASSERT_MALLOC(job_timer);
+        if(job_timer == NULL) {
+            dsc_free(&job->dec_dsc);
+            return NULL;
+        }
+    }
+    else {
+        lv_timer_resume(job_timer);
+    }
+
+    pthread_mutex_lock(&job_mutex);
+    job->state = JOB_QUEUED;
+    pthread_cond_signal(&job_cond);
+    pthread_mutex_unlock(&job_mutex);
+
+    LV_LOG_INFO("image draw: cache miss, queued for decoding");
+    return job;
+}
+
+/**
+ * Free a job which is not queued or being decoded
+ * @param job       pointer to a job
+ * @param close     true: close the decoded image
+ */
+static void job_free(decode_job_t * job, bool close)
+{
+    /*The cache took over the decoded images which are not closed*/
+    if(job->state != JOB_DONE) dsc_free(&job->dec_dsc);
+    else if(close) lv_img_decoder_close(&job->dec_dsc);
+
+    pthread_mutex_lock(&job_mutex);
+    lv_memset_00(job, sizeof(decode_job_t));
+    job->state = JOB_FREE;
+    pthread_mutex_unlock(&job_mutex);
+}
+
+/**
+ * Drop the queued and decoded images of a source. The images being decoded are closed when they are ready.
+ * @param src       an image source or NULL to drop all. If NULL wait for the image being decoded.
+ */
+static void jobs_cancel(const void * src)
+{
+    if(src && lv_img_src_get_type(src) != LV_IMG_SRC_FILE) return;
+
+    uint32_t i;
+    for(i = 0; i < JOB_CNT; i++) {
+        decode_job_t * job = &jobs[i];
+        pthread_mutex_lock(&job_mutex);
+        if(job->state == JOB_FREE || (src && strcmp(job->dec_dsc.src, src) != 0)) {
+            pthread_mutex_unlock(&job_mutex);
+            continue;
+        }
+
+        /*E.g. the decoders might be changed, they shouldn't be in use*/
+        while(src == NULL && job->state == JOB_DECODING) pthread_cond_wait(&done_cond, &job_mutex);
+
+        job_state_t state = job->state;
+        if(state == JOB_DECODING) job->canceled = 1;
+        else if(state == JOB_QUEUED) job->state = JOB_FAILED;  /*Don't let the decoding thread take it*/
+        pthread_mutex_unlock(&job_mutex);
+
+        if(state != JOB_DECODING) job_free(job, true);
+    }
+}
+
+/**
+ * Get the room in the cache needed by the prefetched images which are not added to the cache yet
+ * @param size      store the total size of their decoded data here
+ * @param cnt       store their number here
+ */
+static void jobs_prefetch_reserved(uint32_t * size, uint32_t * cnt)
+{
+    *size = 0;
+    *cnt = 0;
+
+    /*`prefetch` is used only by LVGL's thread*/
+    uint32_t i;
+    for(i = 0; i < JOB_CNT; i++) {
+        if(!jobs[i].prefetch) continue;
+        *size += jobs[i].prefetch_size;
+        (*cnt)++;
+    }
+}
+
+/**
+ * Start the decoding thread if not started yet
+ * @return          true: the thread is running
+ */
+static bool thread_start(void)
+{
+    if(thread_state == THREAD_NOT_STARTED) {
+        if(pthread_create(&thread, NULL, decode_thread, NULL) == 0) {
+            thread_state = THREAD_RUNNING;
+        }
+        else {
+            LV_LOG_WARN("couldn't start the image decoding thread, decoding in place");
+            thread_state = THREAD_FAILED;
+        }
+    }
+
+    return thread_state == THREAD_RUNNING;
+}
+
+static void * decode_thread(void * param)
+{
+    LV_UNUSED(param);
+
+    pthread_mutex_lock(&job_mutex);
+    while(1) {
+        /*Take the oldest queued job*/
+        decode_job_t * job = NULL;
+        uint32_t i;
+        for(i = 0; i < JOB_CNT; i++) {
+            if(jobs[i].state != JOB_QUEUED) continue;
+            if(job == NULL || (int32_t)(jobs[i].seq - job->seq) < 0) job = &jobs[i];
+        }
+
+        if(job == NULL) {
+            pthread_cond_wait(&job_cond, &job_mutex);
+            continue;
+        }
+
+        job->state = JOB_DECODING;
+        pthread_mutex_unlock(&job_mutex);
+
+        /*The decoder was chosen by LVGL's thread. Only its `open_cb` runs here, no other LVGL function.*/
+        lv_res_t res = dsc_open(&job->dec_dsc);
+
+        pthread_mutex_lock(&job_mutex);
+        job->state = res == LV_RES_OK ? JOB_DONE : JOB_FAILED;
+        pthread_cond_broadcast(&done_cond);
+    }
+
+    return NULL;
+}
+
+/**
+ * Add the decoded images to the cache and redraw their areas
+ */
+static void job_timer_cb(lv_timer_t * timer)
+{
+    bool busy = false;
+    uint32_t i;
+    for(i = 0; i < JOB_CNT; i++) {
+        decode_job_t * job = &jobs[i];
+        pthread_mutex_lock(&job_mutex);
+        job_state_t state = job->state;
+        bool canceled = job->canceled;
+        pthread_mutex_unlock(&job_mutex);
+
+        if(state == JOB_QUEUED || state == JOB_DECODING) {
+            busy = true;
+            continue;
+        }
+
+        if(state == JOB_FREE) continue;
+        if(canceled) {
+            job_free(job, true);
+            continue;
+        }
+
+        /*Nothing to redraw. Keep a prefetched image only if it fits without evicting others.*/
+        if(job->prefetch) {
+            if(state == JOB_DONE && entry_fits(data_size_get(&job->dec_dsc), 1) &&
+               entry_add(&job->dec_dsc, job->src_hash, false)) {
+                job_free(job, false);
+            }
+            else {
+                job_free(job, true);
+            }
+            continue;
+        }
+
+        /*Already redrawn, waiting for the next draw to use it*/
+        if(job->disp == NULL) continue;
+
+        lv_disp_t * disp = job->disp;
+        lv_area_t inv_area = job->inv_area;
+        job->disp = NULL;
+
+        /*If it doesn't fit into the cache the next draw takes it from the job.
+         *Failed jobs are also kept to draw the error.*/
+        if(state == JOB_DONE && entry_add(&job->dec_dsc, job->src_hash, false)) job_free(job, false);
+
+        _lv_inv_area(disp, &inv_area);
+    }
+
+    if(!busy) lv_timer_pause(timer);
+}
 #endif
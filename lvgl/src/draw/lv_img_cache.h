@@ -23,6 +23,8 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+struct _lv_disp_t;
+
 /**
  * When loading images from the network it can take a long time to download and decode the image.
  *
@@ -31,12 +33,30 @@ extern "C" {
 typedef struct {
     lv_img_decoder_dsc_t dec_dsc; /**< Image information*/
 
-    /** Count the cache entries's life. Add `time_to_open` to `life` when the entry is used.
-     * Decrement all lifes by one every in every ::lv_img_cache_open.
-     * If life == 0 the entry can be reused*/
-    int32_t life;
+    uint32_t src_hash;      /**< Hash of the source, selects the hash bucket*/
+    uint32_t size;          /**< Size of the decoded data kept by the entry in bytes*/
+    uint16_t hash_next;     /**< Next entry in the same hash bucket*/
+
+    /** Incremented when the entry is used and decremented when the clock hand passes it.
+     * The entry can be reused when the hand finds it at 0*/
+    uint8_t ref;
+    uint8_t pinned : 1;     /**< Never evict the entry*/
 } _lv_img_cache_entry_t;
 
+/**
+ * Statistics of the image cache
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of opens served from the cache*/
+    uint32_t miss_cnt;      /**< Number of opens which had to open the image*/
+    uint32_t evict_cnt;     /**< Number of images closed to make room for a new one*/
+    uint32_t used_size;     /**< Size of the decoded data of the cached images in bytes*/
+    uint32_t max_size;      /**< Memory budget in bytes, 0: unlimited*/
+    uint16_t entry_cnt;     /**< Number of cached images*/
+    uint16_t pinned_cnt;    /**< Number of pinned images*/
+    uint16_t pending_cnt;   /**< Number of images being decoded in the background or not redrawn yet*/
+} lv_img_cache_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -52,6 +72,28 @@ typedef struct {
  */
 _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, int32_t frame_id);
 
+#if LV_IMG_CACHE_ASYNC
+/**
+ * Get an image from the cache or queue it for decoding on the background thread if it's not cached yet.
+ * Only file sources of the decoders marked with `lv_img_decoder_set_async()` are queued, the others are opened in place.
+ * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
+ * @param color The color of the image with `LV_IMG_CF_ALPHA_...`
+ * @param frame_id the index of the frame. Used only with animated images, set 0 for normal images
+ * @param inv_area redraw this area of the refreshing display when the image is decoded
+ * @param pending set to true if the image is being decoded. NULL is returned in this case.
+ * @return pointer to the cache entry or NULL if the image can't be opened or it's pending
+ */
+_lv_img_cache_entry_t * _lv_img_cache_open_async(const void * src, lv_color_t color, int32_t frame_id,
+                                                 const lv_area_t * inv_area, bool * pending);
+
+/**
+ * Forget a display in the queued decodings. Called when the display is removed.
+ * The images are still decoded and they can be used by the next draw.
+ * @param disp pointer to the removed display
+ */
+void _lv_img_cache_disp_removed(struct _lv_disp_t * disp);
+#endif
+
 /**
  * Set the number of images to be cached.
  * More cached images mean more opened image at same time which might mean more memory usage.
@@ -67,6 +109,51 @@ void lv_img_cache_set_size(uint16_t new_slot_num);
  */
 void lv_img_cache_invalidate_src(const void * src);
 
+/**
+ * Set the memory budget of the cache. Images are closed (least recently used first) until the cache fits into it.
+ * @param new_max_size  the maximal size of the decoded data of the cached images in bytes, 0: unlimited
+ */
+void lv_img_cache_set_max_size(uint32_t new_max_size);
+
+/**
+ * Open an image into the cache and keep it there until unpinned. Useful for images which are always visible.
+ * The image is pinned with the default recolor (black) and frame 0, i.e. as `lv_img` draws it by default.
+ * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
+ * @return LV_RES_OK: the image is pinned; LV_RES_INV: the image couldn't be opened or cached
+ */
+lv_res_t lv_img_cache_pin(const void * src);
+
+/**
+ * Let the cached entries of an image source be evicted again.
+ * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
+ */
+void lv_img_cache_unpin(const void * src);
+
+/**
+ * Open an image into the cache before it's drawn, e.g. the images of the next page.
+ * Only the free room of the cache is used: no cached image is evicted for a prefetched one.
+ * With `LV_IMG_CACHE_ASYNC` the images of async decoders are decoded on the background thread.
+ * The image is opened with the default recolor (black) and frame 0, i.e. as `lv_img` draws it by default.
+ * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
+ * @param size store the size of the decoded data which was added or is reserved for it in the cache here.
+ *             0 if it was already cached or queued or it couldn't be prefetched. Can be NULL.
+ * @return LV_RES_OK: the image is cached or queued for decoding;
+ *         LV_RES_INV: the image couldn't be opened or it doesn't fit into the free room
+ */
+lv_res_t lv_img_cache_prefetch(const void * src, uint32_t * size);
+
+/**
+ * Drop the prefetched images which are still waiting for decoding (`LV_IMG_CACHE_ASYNC`).
+ * The image being decoded is still cached if it fits.
+ */
+void lv_img_cache_prefetch_cancel(void);
+
+/**
+ * Get the statistics of the image cache
+ * @param stat_p store the statistics here
+ */
+void lv_img_cache_get_stat(lv_img_cache_stat_t * stat_p);
+
 /**********************
  *      MACROS
  **********************/
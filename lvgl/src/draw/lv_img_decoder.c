@@ -9,6 +9,7 @@
 #include "lv_img_decoder.h"
 #include "../misc/lv_assert.h"
 #include "../draw/lv_draw_img.h"
+#include "../draw/lv_draw_transform.h"
 #include "../misc/lv_ll.h"
 #include "../misc/lv_gc.h"
 
@@ -154,6 +155,7 @@ lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_co
 
         dsc->error_msg = NULL;
         dsc->img_data  = NULL;
+        dsc->img_data_not_owned = 0;
         dsc->user_data = NULL;
         dsc->time_to_open = 0;
     }
@@ -188,6 +190,10 @@ lv_res_t lv_img_decoder_read_line(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_c
 void lv_img_decoder_close(lv_img_decoder_dsc_t * dsc)
 {
     if(dsc->decoder) {
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+        /*The decoded data is going to be freed, the transformed images can't be identified by it anymore*/
+        if(dsc->img_data) _lv_draw_transform_cache_invalidate_src(dsc->img_data);
+#endif
         if(dsc->decoder->close_cb) dsc->decoder->close_cb(dsc->decoder, dsc);
 
         if(dsc->src_type == LV_IMG_SRC_FILE) {
@@ -263,6 +269,18 @@ void lv_img_decoder_set_close_cb(lv_img_decoder_t * decoder, lv_img_decoder_clos
     decoder->close_cb = close_cb;
 }
 
+/**
+ * Allow the image cache to open the images of a decoder on its background thread (see `LV_IMG_CACHE_ASYNC`).
+ * The `info` and `open` callbacks then must not use anything else from LVGL than `lv_mem`, `lv_fs` and the `dsc`.
+ * The `close` callback is always called from LVGL's thread.
+ * @param decoder pointer to an image decoder
+ * @param en true: the decoder is thread safe
+ */
+void lv_img_decoder_set_async(lv_img_decoder_t * decoder, bool en)
+{
+    decoder->async = en ? 1 : 0;
+}
+
 /**
  * Get info about a built-in image
  * @param decoder the decoder where this function belongs
@@ -88,6 +88,9 @@ typedef struct _lv_img_decoder_t {
     lv_img_decoder_read_line_f_t read_line_cb;
     lv_img_decoder_close_f_t close_cb;
 
+    /**1: `info_cb` and `open_cb` can run on the image cache's decoding thread*/
+    uint8_t async : 1;
+
 #if LV_USE_USER_DATA
     void * user_data;
 #endif
@@ -117,6 +120,10 @@ typedef struct _lv_img_decoder_dsc_t {
      *  MUST be set in `open` function*/
     const uint8_t * img_data;
 
+    /**1: `img_data` isn't allocated by the decoder (e.g. it points into a memory mapped file)
+     * so it doesn't count to the memory budget of the image cache. Can be set in `open` function*/
+    uint8_t img_data_not_owned : 1;
+
     /** How much time did it take to open the image. [ms]
      *  If not set `lv_img_cache` will measure and set the time to open*/
     uint32_t time_to_open;
@@ -223,6 +230,15 @@ void lv_img_decoder_set_read_line_cb(lv_img_decoder_t * decoder, lv_img_decoder_
  */
 void lv_img_decoder_set_close_cb(lv_img_decoder_t * decoder, lv_img_decoder_close_f_t close_cb);
 
+/**
+ * Allow the image cache to open the images of a decoder on its background thread (see `LV_IMG_CACHE_ASYNC`).
+ * The `info` and `open` callbacks then must not use anything else from LVGL than `lv_mem`, `lv_fs` and the `dsc`.
+ * The `close` callback is always called from LVGL's thread.
+ * @param decoder pointer to an image decoder
+ * @param en true: the decoder is thread safe
+ */
+void lv_img_decoder_set_async(lv_img_decoder_t * decoder, bool en);
+
 /**
  * Get info about a built-in image
  * @param decoder the decoder where this function belongs
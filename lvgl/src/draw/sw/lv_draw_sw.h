@@ -55,6 +55,15 @@ void lv_draw_sw_wait_for_finish(lv_draw_ctx_t * draw_ctx);
 void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, const lv_point_t * center, uint16_t radius,
                     uint16_t start_angle, uint16_t end_angle);
 
+#if LV_DRAW_COMPLEX && LV_ARC_RING_CACHE_SIZE
+/**
+ * Enable/disable drawing the arcs from the cached ring coverage (enabled by default).
+ * Useful to compare it with the generic way.
+ * @param en    true: use the ring cache; false: always draw the arcs the generic way
+ */
+void lv_draw_sw_arc_set_ring_cache(bool en);
+#endif
+
 void lv_draw_sw_rect(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
 
 void lv_draw_sw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
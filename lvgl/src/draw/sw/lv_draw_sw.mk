@@ -10,6 +10,7 @@ CSRCS += lv_draw_sw_polygon.c
 CSRCS += lv_draw_sw_rect.c
 CSRCS += lv_draw_sw_transform.c
 CSRCS += lv_draw_sw_layer.c
+CSRCS += lv_draw_sw_parallel.c
 
 DEPPATH += --dep-path $(LVGL_DIR)/$(LVGL_DIR_NAME)/src/draw/sw
 VPATH += :$(LVGL_DIR)/$(LVGL_DIR_NAME)/src/draw/sw
@@ -10,6 +10,8 @@
 #include "../../misc/lv_math.h"
 #include "../../misc/lv_log.h"
 #include "../../misc/lv_mem.h"
+#include "../../misc/lv_gc.h"
+#include "../../core/lv_refr.h"
 #include "../lv_draw.h"
 
 /*********************
@@ -34,6 +36,15 @@ typedef struct {
     lv_draw_ctx_t * draw_ctx;
 } quarter_draw_dsc_t;
 
+#if LV_DRAW_COMPLEX && LV_ARC_RING_CACHE_SIZE
+typedef struct {
+    lv_opa_t * cov;         /*Coverage of the top left quarter of the ring. `radius * radius` bytes*/
+    lv_coord_t radius;      /*0: unused entry*/
+    lv_coord_t width;
+    uint32_t life;
+} ring_cache_entry_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -43,11 +54,26 @@ typedef struct {
     static void draw_quarter_2(quarter_draw_dsc_t * q);
     static void draw_quarter_3(quarter_draw_dsc_t * q);
     static void get_rounded_area(int16_t angle, lv_coord_t radius, uint8_t thickness, lv_area_t * res_area);
+    static void draw_rounded_ends(lv_draw_ctx_t * draw_ctx, lv_draw_rect_dsc_t * cir_dsc, const lv_area_t * area_out,
+                                  const lv_point_t * center, lv_coord_t radius, lv_coord_t width,
+                                  uint16_t start_angle, uint16_t end_angle);
+#if LV_ARC_RING_CACHE_SIZE
+    static lv_res_t draw_arc_cached(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, const lv_area_t * area_out,
+                                    const lv_point_t * center, lv_coord_t radius, uint16_t start_angle, uint16_t end_angle,
+                                    bool full_ring);
+    static ring_cache_entry_t * get_ring(lv_coord_t radius, lv_coord_t width);
+    static void get_arc_area(const lv_point_t * center, lv_coord_t radius, lv_coord_t width,
+                             uint16_t start_angle, uint16_t end_angle, lv_area_t * res_area);
+    static bool is_angle_on_arc(uint16_t angle, uint16_t start_angle, uint16_t end_angle);
+#endif
 #endif /*LV_DRAW_COMPLEX*/
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_DRAW_COMPLEX && LV_ARC_RING_CACHE_SIZE
+    static bool ring_cache_en = true;
+#endif
 
 /**********************
  *      MACROS
@@ -87,6 +113,22 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
     area_out.x2 = center->x + radius - 1;  /*-1 because the center already belongs to the left/bottom part*/
     area_out.y2 = center->y + radius - 1;
 
+#if LV_ARC_RING_CACHE_SIZE
+    /*Image arcs are drawn with the image as background so they need the generic way*/
+    if(dsc->img_src == NULL && ring_cache_en) {
+        bool full_ring = start_angle + 360 == end_angle || start_angle == end_angle + 360;
+        uint16_t start_norm = start_angle % 360;
+        uint16_t end_norm = end_angle % 360;
+
+        if(draw_arc_cached(draw_ctx, dsc, &area_out, center, radius, start_norm, end_norm, full_ring) == LV_RES_OK) {
+            if(dsc->rounded && !full_ring) {
+                draw_rounded_ends(draw_ctx, &cir_dsc, &area_out, center, radius, width, start_norm, end_norm);
+            }
+            return;
+        }
+    }
+#endif
+
     lv_area_t area_in;
     lv_area_copy(&area_in, &area_out);
     area_in.x1 += dsc->width;
@@ -139,8 +181,6 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
         angle_gap = start_angle - end_angle;
     }
 
-    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
-
     if(angle_gap > SPLIT_ANGLE_GAP_LIMIT && radius > SPLIT_RADIUS_LIMIT) {
         /*Handle each quarter individually and skip which is empty*/
         quarter_draw_dsc_t q_dsc;
@@ -175,41 +215,7 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
     if(mask_in_id != LV_MASK_ID_INV) lv_draw_mask_remove_id(mask_in_id);
 
     if(dsc->rounded) {
-
-        lv_draw_mask_radius_param_t mask_end_param;
-
-        lv_area_t round_area;
-        get_rounded_area(start_angle, radius, width, &round_area);
-        round_area.x1 += center->x;
-        round_area.x2 += center->x;
-        round_area.y1 += center->y;
-        round_area.y2 += center->y;
-        lv_area_t clip_area2;
-        if(_lv_area_intersect(&clip_area2, clip_area_ori, &round_area)) {
-            lv_draw_mask_radius_init(&mask_end_param, &round_area, LV_RADIUS_CIRCLE, false);
-            int16_t mask_end_id = lv_draw_mask_add(&mask_end_param, NULL);
-
-            draw_ctx->clip_area = &clip_area2;
-            lv_draw_rect(draw_ctx, &cir_dsc, &area_out);
-            lv_draw_mask_remove_id(mask_end_id);
-            lv_draw_mask_free_param(&mask_end_param);
-        }
-
-        get_rounded_area(end_angle, radius, width, &round_area);
-        round_area.x1 += center->x;
-        round_area.x2 += center->x;
-        round_area.y1 += center->y;
-        round_area.y2 += center->y;
-        if(_lv_area_intersect(&clip_area2, clip_area_ori, &round_area)) {
-            lv_draw_mask_radius_init(&mask_end_param, &round_area, LV_RADIUS_CIRCLE, false);
-            int16_t mask_end_id = lv_draw_mask_add(&mask_end_param, NULL);
-
-            draw_ctx->clip_area = &clip_area2;
-            lv_draw_rect(draw_ctx, &cir_dsc, &area_out);
-            lv_draw_mask_remove_id(mask_end_id);
-            lv_draw_mask_free_param(&mask_end_param);
-        }
-        draw_ctx->clip_area = clip_area_ori;
+        draw_rounded_ends(draw_ctx, &cir_dsc, &area_out, center, radius, width, start_angle, end_angle);
     }
 #else
     LV_LOG_WARN("Can't draw arc with LV_DRAW_COMPLEX == 0");
@@ -222,6 +228,13 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
 #endif /*LV_DRAW_COMPLEX*/
 }
 
+#if LV_DRAW_COMPLEX && LV_ARC_RING_CACHE_SIZE
+void lv_draw_sw_arc_set_ring_cache(bool en)
+{
+    ring_cache_en = en;
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -496,6 +509,47 @@ static void draw_quarter_3(quarter_draw_dsc_t * q)
     q->draw_ctx->clip_area = clip_area_ori;
 }
 
+static void draw_rounded_ends(lv_draw_ctx_t * draw_ctx, lv_draw_rect_dsc_t * cir_dsc, const lv_area_t * area_out,
+                              const lv_point_t * center, lv_coord_t radius, lv_coord_t width,
+                              uint16_t start_angle, uint16_t end_angle)
+{
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+    lv_draw_mask_radius_param_t mask_end_param;
+
+    lv_area_t round_area;
+    get_rounded_area(start_angle, radius, width, &round_area);
+    round_area.x1 += center->x;
+    round_area.x2 += center->x;
+    round_area.y1 += center->y;
+    round_area.y2 += center->y;
+    lv_area_t clip_area2;
+    if(_lv_area_intersect(&clip_area2, clip_area_ori, &round_area)) {
+        lv_draw_mask_radius_init(&mask_end_param, &round_area, LV_RADIUS_CIRCLE, false);
+        int16_t mask_end_id = lv_draw_mask_add(&mask_end_param, NULL);
+
+        draw_ctx->clip_area = &clip_area2;
+        lv_draw_rect(draw_ctx, cir_dsc, area_out);
+        lv_draw_mask_remove_id(mask_end_id);
+        lv_draw_mask_free_param(&mask_end_param);
+    }
+
+    get_rounded_area(end_angle, radius, width, &round_area);
+    round_area.x1 += center->x;
+    round_area.x2 += center->x;
+    round_area.y1 += center->y;
+    round_area.y2 += center->y;
+    if(_lv_area_intersect(&clip_area2, clip_area_ori, &round_area)) {
+        lv_draw_mask_radius_init(&mask_end_param, &round_area, LV_RADIUS_CIRCLE, false);
+        int16_t mask_end_id = lv_draw_mask_add(&mask_end_param, NULL);
+
+        draw_ctx->clip_area = &clip_area2;
+        lv_draw_rect(draw_ctx, cir_dsc, area_out);
+        lv_draw_mask_remove_id(mask_end_id);
+        lv_draw_mask_free_param(&mask_end_param);
+    }
+    draw_ctx->clip_area = clip_area_ori;
+}
+
 static void get_rounded_area(int16_t angle, lv_coord_t radius, uint8_t thickness, lv_area_t * res_area)
 {
     const uint8_t ps = 8;
@@ -534,4 +588,233 @@ static void get_rounded_area(int16_t angle, lv_coord_t radius, uint8_t thickness
     }
 }
 
+#if LV_ARC_RING_CACHE_SIZE
+/**
+ * Draw an arc from the cached ring coverage. Only the angle mask (and the other active masks) are applied.
+ * @param draw_ctx      pointer to a draw context
+ * @param dsc           the arc's draw descriptor
+ * @param area_out      the outer area of the ring
+ * @param center        center of the arc
+ * @param radius        outer radius of the arc
+ * @param start_angle   start angle in [0..359]
+ * @param end_angle     end angle in [0..359]
+ * @param full_ring     true: draw the whole ring, the angles are ignored
+ * @return              LV_RES_OK: the arc is drawn; LV_RES_INV: the ring couldn't be cached
+ */
+static lv_res_t draw_arc_cached(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, const lv_area_t * area_out,
+                                const lv_point_t * center, lv_coord_t radius, uint16_t start_angle, uint16_t end_angle,
+                                bool full_ring)
+{
+    lv_coord_t width = LV_MIN(dsc->width, radius);
+
+    /*Draw only the area really covered by the arc*/
+    lv_area_t draw_area;
+    if(full_ring) lv_area_copy(&draw_area, area_out);
+    else get_arc_area(center, radius, width, start_angle, end_angle, &draw_area);
+    if(!_lv_area_intersect(&draw_area, &draw_area, area_out)) return LV_RES_OK;
+    if(!_lv_area_intersect(&draw_area, &draw_area, draw_ctx->clip_area)) return LV_RES_OK;
+
+    ring_cache_entry_t * ring = get_ring(radius, width);
+    if(ring == NULL) return LV_RES_INV;
+
+    lv_draw_mask_angle_param_t angle_param;
+    if(!full_ring) lv_draw_mask_angle_init(&angle_param, center->x, center->y, start_angle, end_angle);
+    bool mask_any = lv_draw_mask_is_any(&draw_area);
+
+    lv_coord_t draw_w = lv_area_get_width(&draw_area);
+    lv_coord_t draw_h = lv_area_get_height(&draw_area);
+    lv_coord_t buf_h = lv_disp_get_hor_res(_lv_refr_get_disp_refreshing()) / draw_w;
+    if(buf_h < 1) buf_h = 1;
+    if(buf_h > draw_h) buf_h = draw_h;
+    lv_opa_t * mask_buf = lv_mem_buf_get(draw_w * buf_h);
+
+    lv_area_t blend_area;
+    blend_area.x1 = draw_area.x1;
+    blend_area.x2 = draw_area.x2;
+    blend_area.y1 = draw_area.y1;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.blend_mode = dsc->blend_mode;
+    blend_dsc.mask_buf = mask_buf;
+    blend_dsc.mask_area = &blend_area;
+    blend_dsc.blend_area = &blend_area;
+    blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+
+    /*The ring is symmetric so only its top left quarter is cached. Mirror it to the other quarters*/
+    lv_coord_t diameter = radius * 2;
+    lv_coord_t rx_start = draw_area.x1 - area_out->x1;
+    lv_coord_t left_w = rx_start < radius ? LV_MIN(radius - rx_start, draw_w) : 0;
+    lv_opa_t * line = mask_buf;
+    lv_coord_t y;
+    for(y = draw_area.y1; y <= draw_area.y2; y++) {
+        lv_coord_t ry = y - area_out->y1;
+        if(ry >= radius) ry = diameter - 1 - ry;
+        const lv_opa_t * cov_row = ring->cov + ry * radius;
+
+        if(left_w) lv_memcpy(line, cov_row + rx_start, left_w);
+        lv_coord_t i;
+        lv_coord_t rx = diameter - 1 - (rx_start + left_w);
+        for(i = left_w; i < draw_w; i++) {
+            line[i] = cov_row[rx];
+            rx--;
+        }
+
+        lv_draw_mask_res_t res;
+        if(!full_ring) {
+            res = angle_param.dsc.cb(line, draw_area.x1, y, draw_w, &angle_param);
+            if(res == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(line, draw_w);
+        }
+
+        if(mask_any) {
+            res = lv_draw_mask_apply(line, draw_area.x1, y, draw_w);
+            if(res == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(line, draw_w);
+        }
+
+        line += draw_w;
+        if(y - blend_area.y1 + 1 == buf_h || y == draw_area.y2) {
+            blend_area.y2 = y;
+            lv_draw_sw_blend(draw_ctx, &blend_dsc);
+            blend_area.y1 = y + 1;
+            line = mask_buf;
+        }
+    }
+
+    lv_mem_buf_release(mask_buf);
+    if(!full_ring) lv_draw_mask_free_param(&angle_param);
+
+    return LV_RES_OK;
+}
+
+/**
+ * Get the coverage of a ring from the cache or calculate and cache it.
+ * @param radius    outer radius of the ring
+ * @param width     width of the ring, at most `radius`
+ * @return          the cache entry or NULL if it couldn't be allocated
+ */
+static ring_cache_entry_t * get_ring(lv_coord_t radius, lv_coord_t width)
+{
+    ring_cache_entry_t * cache = LV_GC_ROOT(_lv_arc_ring_cache);
+    if(cache == NULL) {
+        cache = lv_mem_alloc(sizeof(ring_cache_entry_t) * LV_ARC_RING_CACHE_SIZE);
+        LV_ASSERT_MALLOC(cache);
+        if(cache == NULL) return NULL;
+        lv_memset_00(cache, sizeof(ring_cache_entry_t) * LV_ARC_RING_CACHE_SIZE);
+        LV_GC_ROOT(_lv_arc_ring_cache) = cache;
+    }
+
+    /*Find the ring or the least used entry to replace*/
+    ring_cache_entry_t * entry = &cache[0];
+    uint32_t i;
+    for(i = 0; i < LV_ARC_RING_CACHE_SIZE; i++) {
+        if(cache[i].radius == radius && cache[i].width == width) {
+            if(cache[i].life < UINT32_MAX) cache[i].life++;
+            return &cache[i];
+        }
+        if(cache[i].life < entry->life) entry = &cache[i];
+    }
+
+    /*Age the entries on every miss so rings that were used a lot a long time ago can be replaced too*/
+    for(i = 0; i < LV_ARC_RING_CACHE_SIZE; i++) cache[i].life >>= 1;
+
+    if(entry->cov) lv_mem_free(entry->cov);
+    entry->radius = 0;
+    lv_coord_t diameter = radius * 2;
+    entry->cov = lv_mem_alloc(radius * radius);
+    if(entry->cov == NULL) {
+        LV_LOG_WARN("couldn't allocate the ring cache");
+        return NULL;
+    }
+
+    /*Calculate the ring's coverage with the same masks the generic arc drawing uses*/
+    lv_area_t area_out;
+    lv_area_set(&area_out, 0, 0, diameter - 1, diameter - 1);
+    lv_area_t area_in;
+    lv_area_set(&area_in, width, width, diameter - 1 - width, diameter - 1 - width);
+    bool has_in = lv_area_get_width(&area_in) > 0 && lv_area_get_height(&area_in) > 0;
+
+    lv_draw_mask_radius_param_t mask_out_param;
+    lv_draw_mask_radius_param_t mask_in_param;
+    lv_draw_mask_radius_init(&mask_out_param, &area_out, LV_RADIUS_CIRCLE, false);
+    if(has_in) lv_draw_mask_radius_init(&mask_in_param, &area_in, LV_RADIUS_CIRCLE, true);
+
+    lv_coord_t y;
+    for(y = 0; y < radius; y++) {
+        lv_opa_t * row = entry->cov + y * radius;
+        lv_memset_ff(row, radius);
+        lv_draw_mask_res_t res = mask_out_param.dsc.cb(row, 0, y, radius, &mask_out_param);
+        if(res == LV_DRAW_MASK_RES_TRANSP) {
+            lv_memset_00(row, radius);
+            continue;
+        }
+        if(has_in) {
+            res = mask_in_param.dsc.cb(row, 0, y, radius, &mask_in_param);
+            if(res == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(row, radius);
+        }
+    }
+
+    lv_draw_mask_free_param(&mask_out_param);
+    if(has_in) lv_draw_mask_free_param(&mask_in_param);
+
+    entry->radius = radius;
+    entry->width = width;
+    entry->life = 1;
+
+    return entry;
+}
+
+/**
+ * Get the bounding box of an arc
+ * @param center        center of the arc
+ * @param radius        outer radius of the arc
+ * @param width         width of the arc
+ * @param start_angle   start angle in [0..359]
+ * @param end_angle     end angle in [0..359]
+ * @param res_area      store the result here
+ */
+static void get_arc_area(const lv_point_t * center, lv_coord_t radius, lv_coord_t width,
+                         uint16_t start_angle, uint16_t end_angle, lv_area_t * res_area)
+{
+    lv_coord_t radius_in = radius - width;
+    uint16_t angles[2] = {start_angle, end_angle};
+    lv_coord_t radiuses[2] = {radius, radius_in};
+
+    res_area->x1 = LV_COORD_MAX;
+    res_area->y1 = LV_COORD_MAX;
+    res_area->x2 = LV_COORD_MIN;
+    res_area->y2 = LV_COORD_MIN;
+
+    /*The end points on the inner and outer circle*/
+    uint32_t a;
+    uint32_t r;
+    for(a = 0; a < 2; a++) {
+        for(r = 0; r < 2; r++) {
+            lv_coord_t x = center->x + ((radiuses[r] * lv_trigo_cos(angles[a])) >> LV_TRIGO_SHIFT);
+            lv_coord_t y = center->y + ((radiuses[r] * lv_trigo_sin(angles[a])) >> LV_TRIGO_SHIFT);
+            res_area->x1 = LV_MIN(res_area->x1, x);
+            res_area->y1 = LV_MIN(res_area->y1, y);
+            res_area->x2 = LV_MAX(res_area->x2, x);
+            res_area->y2 = LV_MAX(res_area->y2, y);
+        }
+    }
+
+    /*The outermost points if the arc goes through them*/
+    if(is_angle_on_arc(0, start_angle, end_angle)) res_area->x2 = center->x + radius;
+    if(is_angle_on_arc(90, start_angle, end_angle)) res_area->y2 = center->y + radius;
+    if(is_angle_on_arc(180, start_angle, end_angle)) res_area->x1 = center->x - radius;
+    if(is_angle_on_arc(270, start_angle, end_angle)) res_area->y1 = center->y - radius;
+
+    /*Add some extra space for the rounding errors and anti-aliasing*/
+    lv_area_increase(res_area, 2, 2);
+}
+
+static bool is_angle_on_arc(uint16_t angle, uint16_t start_angle, uint16_t end_angle)
+{
+    if(start_angle <= end_angle) return angle >= start_angle && angle <= end_angle;
+    else return angle >= start_angle || angle <= end_angle;
+}
+#endif /*LV_ARC_RING_CACHE_SIZE*/
+
 #endif /*LV_DRAW_COMPLEX*/
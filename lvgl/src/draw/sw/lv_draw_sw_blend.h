@@ -59,6 +59,16 @@ void lv_draw_sw_blend(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_d
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_basic(struct _lv_draw_ctx_t * draw_ctx,
                                                         const lv_draw_sw_blend_dsc_t * dsc);
 
+#if LV_USE_PARALLEL_RENDER
+/**
+ * Blend function which splits large areas into horizontal bands and blends them
+ * with `lv_draw_sw_blend_basic` on worker threads in parallel.
+ * @param draw_ctx      pointer to a draw context
+ * @param dsc           pointer to an initialized blend descriptor
+ */
+void lv_draw_sw_blend_parallel(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+#endif
+
 /**********************
  *      MACROS
  **********************/
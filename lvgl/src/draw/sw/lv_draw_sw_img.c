@@ -29,6 +29,11 @@
 static void convert_cb(const lv_area_t * dest_area, const void * src_buf, lv_coord_t src_w, lv_coord_t src_h,
                        lv_coord_t src_stride, const lv_draw_img_dsc_t * draw_dsc, lv_img_cf_t cf, lv_color_t * cbuf, lv_opa_t * abuf);
 
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+static void sprite_copy(const lv_area_t * dest_area, const lv_color_t * sprite_cbuf, const lv_opa_t * sprite_abuf,
+                        const lv_area_t * sprite_area, lv_color_t * cbuf, lv_opa_t * abuf);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -53,6 +58,19 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_img_decoded(struct _lv_draw_ctx_t * draw_c
     bool mask_any = lv_draw_mask_is_any(&draw_area);
     bool transform = draw_dsc->angle != 0 || draw_dsc->zoom != LV_IMG_ZOOM_NONE ? true : false;
 
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    /*Get the whole transformed image from the cache (or transform and add it now)*/
+    const lv_color_t * sprite_cbuf = NULL;
+    const lv_opa_t * sprite_abuf = NULL;
+    lv_area_t sprite_area;
+    if(transform && draw_dsc->transform_cache) {
+        if(!_lv_draw_transform_cache_get(draw_ctx, src_buf, lv_area_get_width(coords), lv_area_get_height(coords),
+                                         draw_dsc, cf, &sprite_cbuf, &sprite_abuf, &sprite_area)) {
+            sprite_cbuf = NULL;
+        }
+    }
+#endif
+
     lv_area_t blend_area;
     lv_draw_sw_blend_dsc_t blend_dsc;
 
@@ -93,6 +111,18 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_img_decoded(struct _lv_draw_ctx_t * draw_c
         blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
         lv_draw_sw_blend(draw_ctx, &blend_dsc);
     }
+#endif
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+    /*The transformed image is cached, just blend it*/
+    else if(sprite_cbuf && !mask_any && draw_dsc->recolor_opa == LV_OPA_TRANSP) {
+        lv_area_move(&sprite_area, coords->x1, coords->y1);
+        blend_dsc.src_buf = sprite_cbuf;
+        blend_dsc.mask_buf = (lv_opa_t *)sprite_abuf;
+        blend_dsc.mask_area = &sprite_area;
+        blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+        blend_dsc.blend_area = &sprite_area;
+        lv_draw_sw_blend(draw_ctx, &blend_dsc);
+    }
 #endif
     /*In the other cases every pixel need to be checked one-by-one*/
     else {
@@ -140,6 +170,12 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_img_decoded(struct _lv_draw_ctx_t * draw_c
             lv_area_t transform_area;
             lv_area_copy(&transform_area, &blend_area);
             lv_area_move(&transform_area, -coords->x1, -coords->y1);
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+            if(sprite_cbuf) {
+                sprite_copy(&transform_area, sprite_cbuf, sprite_abuf, &sprite_area, rgb_buf, mask_buf);
+            }
+            else
+#endif
             if(transform) {
                 lv_draw_transform(draw_ctx, &transform_area, src_buf, src_w, src_h, src_w,
                                   draw_dsc, cf, rgb_buf, mask_buf);
@@ -296,3 +332,26 @@ static void convert_cb(const lv_area_t * dest_area, const void * src_buf, lv_coo
         }
     }
 }
+
+#if LV_IMG_TRANSFORM_CACHE_SIZE
+/*Copy an area of a cached transformed image. The pixels out of the transformed image are transparent*/
+static void sprite_copy(const lv_area_t * dest_area, const lv_color_t * sprite_cbuf, const lv_opa_t * sprite_abuf,
+                        const lv_area_t * sprite_area, lv_color_t * cbuf, lv_opa_t * abuf)
+{
+    if(!_lv_area_is_in(dest_area, sprite_area, 0)) lv_memset_00(abuf, lv_area_get_size(dest_area));
+
+    lv_area_t com;
+    if(!_lv_area_intersect(&com, dest_area, sprite_area)) return;
+
+    lv_coord_t dest_w = lv_area_get_width(dest_area);
+    lv_coord_t sprite_w = lv_area_get_width(sprite_area);
+    lv_coord_t com_w = lv_area_get_width(&com);
+    lv_coord_t y;
+    for(y = com.y1; y <= com.y2; y++) {
+        uint32_t dest_ofs = (y - dest_area->y1) * dest_w + (com.x1 - dest_area->x1);
+        uint32_t sprite_ofs = (y - sprite_area->y1) * sprite_w + (com.x1 - sprite_area->x1);
+        lv_memcpy(&cbuf[dest_ofs], &sprite_cbuf[sprite_ofs], com_w * sizeof(lv_color_t));
+        lv_memcpy(&abuf[dest_ofs], &sprite_abuf[sprite_ofs], com_w);
+    }
+}
+#endif
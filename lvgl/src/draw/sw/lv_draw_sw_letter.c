@@ -30,6 +30,10 @@
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_normal(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
                                                            const lv_point_t * pos, lv_font_glyph_dsc_t * g, const uint8_t * map_p);
 
+static const lv_opa_t * get_expand_table(uint32_t bpp, lv_opa_t opa, const lv_opa_t * bpp_opa_table_p);
+static inline void expand_row(const uint8_t * map_p, uint32_t col_bit, uint32_t px_cnt, uint32_t bpp,
+                              const lv_opa_t * expand_table, lv_opa_t * mask_buf);
+
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
 static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos,
                               lv_font_glyph_dsc_t * g, const uint8_t * map_p);
@@ -166,8 +170,6 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
 {
 
     const uint8_t * bpp_opa_table_p;
-    uint32_t bitmask_init;
-    uint32_t bitmask;
     uint32_t bpp = g->bpp;
     lv_opa_t opa = dsc->opa;
     uint32_t shades;
@@ -194,22 +196,18 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
     switch(bpp) {
         case 1:
             bpp_opa_table_p = _lv_bpp1_opa_table;
-            bitmask_init  = 0x80;
             shades = 2;
             break;
         case 2:
             bpp_opa_table_p = _lv_bpp2_opa_table;
-            bitmask_init  = 0xC0;
             shades = 4;
             break;
         case 4:
             bpp_opa_table_p = _lv_bpp4_opa_table;
-            bitmask_init  = 0xF0;
             shades = 16;
             break;
         case 8:
             bpp_opa_table_p = _lv_bpp8_opa_table;
-            bitmask_init  = 0xFF;
             shades = 256;
             break;       /*No opa table, pixel value will be used directly*/
         default:
@@ -232,7 +230,11 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
         prev_bpp = bpp;
     }
 
-    int32_t col, row;
+    /*With less than 8 bpp expand whole bitmap bytes to opacity values with a table instead of pixel-by-pixel*/
+    const lv_opa_t * expand_table = NULL;
+    if(bpp < 8) expand_table = get_expand_table(bpp, opa < LV_OPA_MAX ? opa : LV_OPA_COVER, bpp_opa_table_p);
+
+    int32_t row;
     int32_t box_w = g->box_w;
     int32_t box_h = g->box_h;
     int32_t width_bit = box_w * bpp; /*Letter width in bits*/
@@ -247,7 +249,6 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
     uint32_t bit_ofs = (row_start * width_bit) + (col_start * bpp);
     map_p += bit_ofs >> 3;
 
-    uint8_t letter_px;
     uint32_t col_bit;
     col_bit = bit_ofs & 0x7; /*"& 0x7" equals to "% 8" just faster*/
 
@@ -278,38 +279,23 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
     blend_dsc.blend_area = &fill_area;
     blend_dsc.mask_area = &fill_area;
 
-    uint32_t col_bit_max = 8 - bpp;
-    uint32_t col_bit_row_ofs = (box_w + col_start - col_end) * bpp;
+    uint32_t px_cnt = col_end - col_start;
 
     for(row = row_start ; row < row_end; row++) {
 #if LV_DRAW_COMPLEX
         int32_t mask_p_start = mask_p;
 #endif
-        bitmask = bitmask_init >> col_bit;
-        for(col = col_start; col < col_end; col++) {
-            /*Load the pixel's opacity into the mask*/
-            letter_px = (*map_p & bitmask) >> (col_bit_max - col_bit);
-            if(letter_px) {
-                mask_buf[mask_p] = bpp_opa_table_p[letter_px];
-            }
-            else {
-                mask_buf[mask_p] = 0;
-            }
-
-            /*Go to the next column*/
-            if(col_bit < col_bit_max) {
-                col_bit += bpp;
-                bitmask = bitmask >> bpp;
-            }
-            else {
-                col_bit = 0;
-                bitmask = bitmask_init;
-                map_p++;
+        /*Load the pixels' opacity of the row into the mask*/
+        if(expand_table) {
+            expand_row(map_p, col_bit, px_cnt, bpp, expand_table, mask_buf + mask_p);
+        }
+        else {
+            uint32_t i;
+            for(i = 0; i < px_cnt; i++) {
+                mask_buf[mask_p + i] = bpp_opa_table_p[map_p[i]];
             }
-
-            /*Next mask byte*/
-            mask_p++;
         }
+        mask_p += px_cnt;
 
 #if LV_DRAW_COMPLEX
         /*Apply masks if any*/
@@ -334,7 +320,8 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
             mask_p = 0;
         }
 
-        col_bit += col_bit_row_ofs;
+        /*Go to the start of the next row*/
+        col_bit += width_bit;
         map_p += (col_bit >> 3);
         col_bit = col_bit & 0x7;
     }
@@ -350,6 +337,97 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
     lv_mem_buf_release(mask_buf);
 }
 
+/**
+ * Get a table which maps a bitmap byte to the opacity of all the pixels stored in it.
+ * E.g. with bpp = 2 `table[byte * 4 + i]` is the opacity of the i-th pixel of `byte`.
+ * The tables are rebuilt only if the opacity of the letters changes.
+ * @param bpp               1, 2 or 4
+ * @param opa               opacity of the letter
+ * @param bpp_opa_table_p   maps the pixel values to opacity (already scaled by `opa`)
+ * @return                  the expand table
+ */
+static const lv_opa_t * get_expand_table(uint32_t bpp, lv_opa_t opa, const lv_opa_t * bpp_opa_table_p)
+{
+    static lv_opa_t table_bpp1[256 * 8];
+    static lv_opa_t table_bpp2[256 * 4];
+    static lv_opa_t table_bpp4[256 * 2];
+    static uint16_t table_opa[3] = {0xFFFF, 0xFFFF, 0xFFFF};    /*Invalid opacity to build the tables first*/
+
+    lv_opa_t * table;
+    uint16_t * cached_opa;
+    switch(bpp) {
+        case 1:
+            table = table_bpp1;
+            cached_opa = &table_opa[0];
+            break;
+        case 2:
+            table = table_bpp2;
+            cached_opa = &table_opa[1];
+            break;
+        default:
+            table = table_bpp4;
+            cached_opa = &table_opa[2];
+            break;
+    }
+
+    if(*cached_opa == opa) return table;
+
+    uint32_t px_per_byte = 8 / bpp;
+    uint32_t px_mask = (1 << bpp) - 1;
+    uint32_t b;
+    for(b = 0; b < 256; b++) {
+        uint32_t i;
+        for(i = 0; i < px_per_byte; i++) {
+            uint32_t px = (b >> (8 - bpp * (i + 1))) & px_mask;
+            table[b * px_per_byte + i] = bpp_opa_table_p[px];
+        }
+    }
+    *cached_opa = opa;
+
+    return table;
+}
+
+/**
+ * Convert a row of a 1, 2 or 4 bpp bitmap to opacity values
+ * @param map_p         pointer to the byte of the bitmap where the row starts
+ * @param col_bit       the bit in the first byte where the row starts
+ * @param px_cnt        number of pixels to convert
+ * @param bpp           bit per pixel of the bitmap
+ * @param expand_table  the table returned by `get_expand_table()` for this bpp
+ * @param mask_buf      store the opacity values here
+ */
+static inline void LV_ATTRIBUTE_FAST_MEM expand_row(const uint8_t * map_p, uint32_t col_bit, uint32_t px_cnt,
+                                                    uint32_t bpp, const lv_opa_t * expand_table, lv_opa_t * mask_buf)
+{
+    uint32_t px_per_byte = 8 / bpp;
+
+    /*Handle 8 bits in one step. If the row doesn't start on byte boundary combine the bits of 2 bytes*/
+    if(col_bit == 0) {
+        while(px_cnt >= px_per_byte) {
+            lv_memcpy_small(mask_buf, &expand_table[*map_p * px_per_byte], px_per_byte);
+            mask_buf += px_per_byte;
+            px_cnt -= px_per_byte;
+            map_p++;
+        }
+    }
+    else {
+        while(px_cnt >= px_per_byte) {
+            uint8_t b = (uint8_t)((map_p[0] << col_bit) | (map_p[1] >> (8 - col_bit)));
+            lv_memcpy_small(mask_buf, &expand_table[b * px_per_byte], px_per_byte);
+            mask_buf += px_per_byte;
+            px_cnt -= px_per_byte;
+            map_p++;
+        }
+    }
+
+    /*The remaining pixels. Don't read the next byte if all of them are in the current one*/
+    if(px_cnt) {
+        uint8_t b = (uint8_t)(map_p[0] << col_bit);
+        if(col_bit + px_cnt * bpp > 8) b |= map_p[1] >> (8 - col_bit);
+        lv_memcpy_small(mask_buf, &expand_table[b * px_per_byte], px_cnt);
+    }
+}
+
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
 static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos,
                               lv_font_glyph_dsc_t * g, const uint8_t * map_p)
@@ -0,0 +1,161 @@
+/**
+ * @file lv_draw_sw_parallel.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw.h"
+#include "../../hal/lv_hal_disp.h"
+#include "../../core/lv_refr.h"
+
+#if LV_USE_PARALLEL_RENDER
+
+#include <pthread.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_PARALLEL_RENDER_THREADS < 2
+    #error "LV_PARALLEL_RENDER_THREADS must be at least 2"
+#endif
+
+#define WORKER_CNT  (LV_PARALLEL_RENDER_THREADS - 1)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    POOL_STATE_NOT_STARTED,
+    POOL_STATE_RUNNING,
+    POOL_STATE_FAILED,
+} pool_state_t;
+
+typedef struct {
+    lv_draw_ctx_t draw_ctx;     /*Copy of the draw context with the band as clip area*/
+    lv_area_t clip_area;
+} band_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool pool_start(void);
+static void * worker_thread(void * param);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static pool_state_t pool_state;
+static pthread_t workers[WORKER_CNT];
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t start_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+
+/*The job of the workers. Protected by `lock`*/
+static band_t bands[LV_PARALLEL_RENDER_THREADS];
+static const lv_draw_sw_blend_dsc_t * job_dsc;
+static uint32_t job_id;
+static uint32_t job_pending;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_blend_parallel(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc)
+{
+    lv_area_t blend_area;
+    if(!_lv_area_intersect(&blend_area, dsc->blend_area, draw_ctx->clip_area)) return;
+
+    /*`set_px_cb` might not be thread safe, the ARGB blending caches the last color in static variables
+     *and without anti-aliasing the mask is rounded in place. Blend these on the rendering thread.*/
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_coord_t h = lv_area_get_height(&blend_area);
+    if(lv_area_get_size(&blend_area) < LV_PARALLEL_RENDER_MIN_PX || h < LV_PARALLEL_RENDER_THREADS ||
+       disp->driver->set_px_cb || disp->driver->screen_transp || disp->driver->antialiasing == 0 ||
+       !pool_start()) {
+        lv_draw_sw_blend_basic(draw_ctx, dsc);
+        return;
+    }
+
+    /*Split the area into bands with equal height. The first band is blended on this thread.*/
+    pthread_mutex_lock(&lock);
+    uint32_t i;
+    for(i = 0; i < LV_PARALLEL_RENDER_THREADS; i++) {
+        bands[i].draw_ctx = *draw_ctx;
+        bands[i].clip_area = blend_area;
+        bands[i].clip_area.y1 = blend_area.y1 + (h * i) / LV_PARALLEL_RENDER_THREADS;
+        bands[i].clip_area.y2 = blend_area.y1 + (h * (i + 1)) / LV_PARALLEL_RENDER_THREADS - 1;
+        bands[i].draw_ctx.clip_area = &bands[i].clip_area;
+    }
+    job_dsc = dsc;
+    job_pending = WORKER_CNT;
+    job_id++;
+    pthread_cond_broadcast(&start_cond);
+    pthread_mutex_unlock(&lock);
+
+    lv_draw_sw_blend_basic(&bands[0].draw_ctx, dsc);
+
+    /*The next drawing might read the blended pixels so wait for all bands*/
+    pthread_mutex_lock(&lock);
+    while(job_pending) pthread_cond_wait(&done_cond, &lock);
+    pthread_mutex_unlock(&lock);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Start the worker threads if they are not running yet
+ * @return true: the workers are running; false: they couldn't be started
+ */
+static bool pool_start(void)
+{
+    if(pool_state == POOL_STATE_RUNNING) return true;
+    if(pool_state == POOL_STATE_FAILED) return false;
+
+    uintptr_t i;
+    for(i = 0; i < WORKER_CNT; i++) {
+        if(pthread_create(&workers[i], NULL, worker_thread, (void *)(i + 1)) != 0) {
+            LV_LOG_WARN("Couldn't create the render worker threads. Blending on the rendering thread only.");
+            pool_state = POOL_STATE_FAILED;
+            return false;
+        }
+        pthread_detach(workers[i]);
+    }
+
+    pool_state = POOL_STATE_RUNNING;
+    return true;
+}
+
+/**
+ * Wait for jobs and blend the band with the index given in `param`
+ * @param param     index of the band in `bands`
+ */
+static void * worker_thread(void * param)
+{
+    uintptr_t band_idx = (uintptr_t)param;
+    uint32_t last_job_id = 0;
+
+    pthread_mutex_lock(&lock);
+    while(1) {
+        while(job_id == last_job_id) pthread_cond_wait(&start_cond, &lock);
+        last_job_id = job_id;
+        pthread_mutex_unlock(&lock);
+
+        lv_draw_sw_blend_basic(&bands[band_idx].draw_ctx, job_dsc);
+
+        pthread_mutex_lock(&lock);
+        job_pending--;
+        if(job_pending == 0) pthread_cond_signal(&done_cond);
+    }
+
+    return NULL;
+}
+
+#endif /*LV_USE_PARALLEL_RENDER*/
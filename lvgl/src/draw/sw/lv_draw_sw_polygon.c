@@ -16,14 +16,55 @@
 /*********************
  *      DEFINES
  *********************/
+#define SUBPX_SHIFT     8
+#define SUBPX_ONE       (1 << SUBPX_SHIFT)
+#define SUBPX_HALF      (SUBPX_ONE / 2)
+
+/*Fully covered runs shorter than this are blended together with the anti-aliased pixels*/
+#define FULL_RUN_MIN    8
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*A non-horizontal edge with sub-pixel coordinates. y1 < y2 always*/
+typedef struct {
+    int32_t x1;
+    int32_t y1;
+    int32_t x2;
+    int32_t y2;
+    int32_t dir;    /*1: the original edge pointed downward, -1: upward*/
+    int64_t slope;  /*dx/dy in 16.16 format*/
+} poly_edge_t;
+
+/*Pixels of a row touched by an edge*/
+typedef struct {
+    int32_t start;
+    int32_t end;
+} cell_range_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_DRAW_COMPLEX
+static bool is_plain_fill(const lv_draw_rect_dsc_t * draw_dsc);
+static void draw_polygon_spans(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * draw_dsc, const lv_point_t * p,
+                               uint16_t point_cnt, const lv_area_t * poly_coords);
+static void draw_polygon_masked(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * draw_dsc, const lv_point_t * p,
+                                uint16_t point_cnt, const lv_area_t * poly_coords);
+static uint16_t get_edges(const lv_point_t * p, uint16_t point_cnt, const lv_area_t * poly_coords, poly_edge_t * edges);
+static void get_vertex(const lv_point_t * p, uint16_t point_cnt, uint16_t i, int32_t area_sign,
+                       const lv_area_t * poly_coords, int32_t * x, int32_t * y);
+static int32_t get_edge_x(const poly_edge_t * e, int32_t y);
+static bool add_segment(int32_t * acc, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t dir, int32_t w,
+                        cell_range_t * range);
+static void add_cell_segment(int32_t * acc, int32_t cell, int32_t x1, int32_t x2, int32_t h);
+static int32_t add_run(lv_draw_ctx_t * draw_ctx, lv_draw_sw_blend_dsc_t * blend_dsc, lv_opa_t * line,
+                       lv_coord_t x_ofs, lv_coord_t y, int32_t start, int32_t end, int32_t sum, int32_t pending,
+                       bool mask_any);
+static void blend_masked(lv_draw_ctx_t * draw_ctx, lv_draw_sw_blend_dsc_t * blend_dsc, lv_opa_t * line,
+                         lv_coord_t x_ofs, lv_coord_t y, int32_t start, int32_t end, bool mask_any);
+#endif /*LV_DRAW_COMPLEX*/
 
 /**********************
  *  STATIC VARIABLES
@@ -38,7 +79,9 @@
  **********************/
 
 /**
- * Draw a polygon. Only convex polygons are supported
+ * Draw a polygon. Plain color fills are rasterized directly with anti-aliased spans
+ * and any simple polygon is supported (non-zero winding rule).
+ * Other fills (gradient, border, shadow, etc.) support only convex polygons.
  * @param points an array of points
  * @param point_cnt number of points
  * @param clip_area polygon will be drawn only in this area
@@ -95,9 +138,186 @@ void lv_draw_sw_polygon(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dra
     const lv_area_t * clip_area_ori = draw_ctx->clip_area;
     draw_ctx->clip_area = &clip_area;
 
+    if(is_plain_fill(draw_dsc)) draw_polygon_spans(draw_ctx, draw_dsc, p, point_cnt, &poly_coords);
+    else draw_polygon_masked(draw_ctx, draw_dsc, p, point_cnt, &poly_coords);
+
+    lv_mem_buf_release(p);
+
+    draw_ctx->clip_area = clip_area_ori;
+#else
+    LV_UNUSED(points);
+    LV_UNUSED(point_cnt);
+    LV_UNUSED(draw_ctx);
+    LV_UNUSED(draw_dsc);
+    LV_LOG_WARN("Can't draw polygon with LV_DRAW_COMPLEX == 0");
+#endif /*LV_DRAW_COMPLEX*/
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_DRAW_COMPLEX
+
+/**
+ * Tell whether the descriptor is a plain color fill which can be rasterized with spans
+ * @param draw_dsc  the polygon's draw descriptor
+ * @return          true: only the background color needs to be drawn
+ */
+static bool is_plain_fill(const lv_draw_rect_dsc_t * draw_dsc)
+{
+    if(draw_dsc->radius != 0) return false;
+    if(draw_dsc->bg_grad.dir != LV_GRAD_DIR_NONE) return false;
+    if(draw_dsc->bg_img_src != NULL) return false;
+    if(draw_dsc->border_width != 0 && draw_dsc->border_opa > LV_OPA_MIN) return false;
+    if(draw_dsc->outline_width != 0 && draw_dsc->outline_opa > LV_OPA_MIN) return false;
+    if(draw_dsc->shadow_width != 0 && draw_dsc->shadow_opa > LV_OPA_MIN) return false;
+
+    return true;
+}
+
+/**
+ * Rasterize a polygon row by row with an active edge table. The signed area covered by the edges
+ * is accumulated per pixel and summed along the row, which gives the exact coverage of every pixel.
+ * The rows are blended as spans: fully covered runs without mask, the edges with their coverage as mask.
+ * @param draw_ctx      pointer to a draw context. Its `clip_area` is already limited to the polygon
+ * @param draw_dsc      the polygon's draw descriptor
+ * @param p             the points of the polygon without duplicates
+ * @param point_cnt     number of points
+ * @param poly_coords   bounding box of the points
+ */
+static void draw_polygon_spans(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * draw_dsc, const lv_point_t * p,
+                               uint16_t point_cnt, const lv_area_t * poly_coords)
+{
+    if(draw_dsc->bg_opa <= LV_OPA_MIN) return;
+
+    const lv_area_t * clip_area = draw_ctx->clip_area;
+    lv_coord_t clip_w = lv_area_get_width(clip_area);
+
+    poly_edge_t * edges = lv_mem_buf_get(point_cnt * sizeof(poly_edge_t));
+    poly_edge_t ** active = lv_mem_buf_get(point_cnt * sizeof(poly_edge_t *));
+    cell_range_t * ranges = lv_mem_buf_get(point_cnt * sizeof(cell_range_t));
+    /*The cells are relative to the clip area. One more cell is used for the carry of the last pixel*/
+    int32_t * acc = lv_mem_buf_get((clip_w + 2) * sizeof(int32_t));
+    lv_opa_t * line = lv_mem_buf_get(clip_w + 2);
+    if(edges == NULL || active == NULL || ranges == NULL || acc == NULL || line == NULL) {
+        if(edges) lv_mem_buf_release(edges);
+        if(active) lv_mem_buf_release(active);
+        if(ranges) lv_mem_buf_release(ranges);
+        if(acc) lv_mem_buf_release(acc);
+        if(line) lv_mem_buf_release(line);
+        return;
+    }
+    lv_memset_00(acc, (clip_w + 2) * sizeof(int32_t));
+
+    uint16_t edge_cnt = get_edges(p, point_cnt, poly_coords, edges);
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = draw_dsc->bg_color;
+    blend_dsc.opa = draw_dsc->bg_opa;
+    blend_dsc.blend_mode = draw_dsc->blend_mode;
+
+    bool mask_any = lv_draw_mask_is_any(clip_area);
+
+    /*The rows are relative to `clip_area->x1`*/
+    int32_t x_ofs = (int32_t)clip_area->x1 << SUBPX_SHIFT;
+    int32_t w_subpx = (int32_t)clip_w << SUBPX_SHIFT;
+    uint16_t next_edge = 0;
+    uint16_t active_cnt = 0;
+    lv_coord_t y;
+    for(y = clip_area->y1; y <= clip_area->y2; y++) {
+        int32_t row_y1 = (int32_t)y << SUBPX_SHIFT;
+        int32_t row_y2 = row_y1 + SUBPX_ONE;
+
+        /*Drop the edges ended above this row and add the ones starting in it*/
+        uint16_t i;
+        uint16_t j = 0;
+        for(i = 0; i < active_cnt; i++) {
+            if(active[i]->y2 > row_y1) active[j++] = active[i];
+        }
+        active_cnt = j;
+        while(next_edge < edge_cnt && edges[next_edge].y1 < row_y2) {
+            if(edges[next_edge].y2 > row_y1) active[active_cnt++] = &edges[next_edge];
+            next_edge++;
+        }
+        if(active_cnt == 0) {
+            if(next_edge == edge_cnt) break;
+            continue;
+        }
+
+        /*Accumulate the edges and collect the cells touched by them sorted by their start*/
+        uint16_t range_cnt = 0;
+        for(i = 0; i < active_cnt; i++) {
+            poly_edge_t * e = active[i];
+            int32_t y1 = LV_MAX(e->y1, row_y1);
+            int32_t y2 = LV_MIN(e->y2, row_y2);
+            if(y1 >= y2) continue;
+
+            cell_range_t r;
+            int32_t x1 = get_edge_x(e, y1) - x_ofs;
+            int32_t x2 = get_edge_x(e, y2) - x_ofs;
+            if(!add_segment(acc, x1, y1, x2, y2, e->dir, w_subpx, &r)) continue;
+
+            j = range_cnt;
+            while(j > 0 && ranges[j - 1].start > r.start) {
+                ranges[j] = ranges[j - 1];
+                j--;
+            }
+            ranges[j] = r;
+            range_cnt++;
+        }
+        if(range_cnt == 0) continue;
+
+        /*Sum the accumulated areas along the row to get the coverage. Between the touched cells it's constant*/
+        int32_t sum = 0;
+        int32_t pending = -1;    /*Start of the not blended anti-aliased part*/
+        int32_t x = ranges[0].start;
+        for(i = 0; i < range_cnt; i++) {
+            int32_t start = ranges[i].start;
+            int32_t end = ranges[i].end;
+            /*Merge the overlapping ranges*/
+            while(i + 1 < range_cnt && ranges[i + 1].start <= end + 1) {
+                i++;
+                end = LV_MAX(end, ranges[i].end);
+            }
+
+            if(x < start) {
+                pending = add_run(draw_ctx, &blend_dsc, line, clip_area->x1, y, x, start - 1, sum, pending, mask_any);
+                x = start;
+            }
+            if(pending < 0) pending = x;
+            for(; x <= end; x++) {
+                sum += acc[x];
+                acc[x] = 0;
+                int32_t cov = LV_ABS(sum) >> SUBPX_SHIFT;
+                line[x] = cov >= LV_OPA_COVER ? LV_OPA_COVER : cov;
+            }
+        }
+
+        /*If the polygon continues beyond the clip area its coverage remains until the end of the row*/
+        if(x < clip_w) {
+            pending = add_run(draw_ctx, &blend_dsc, line, clip_area->x1, y, x, clip_w - 1, sum, pending, mask_any);
+            x = clip_w;
+        }
+        if(pending >= 0) blend_masked(draw_ctx, &blend_dsc, line, clip_area->x1, y, pending, LV_MIN(x, clip_w) - 1,
+                                          mask_any);
+    }
+
+    lv_mem_buf_release(line);
+    lv_mem_buf_release(acc);
+    lv_mem_buf_release(ranges);
+    lv_mem_buf_release(active);
+    lv_mem_buf_release(edges);
+}
+
+static void draw_polygon_masked(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * draw_dsc, const lv_point_t * p,
+                                uint16_t point_cnt, const lv_area_t * poly_coords)
+{
     /*Find the lowest point*/
     lv_coord_t y_min = p[0].y;
     int16_t y_min_i = 0;
+    uint16_t i;
 
     for(i = 1; i < point_cnt; i++) {
         if(p[i].y < y_min) {
@@ -185,23 +405,321 @@ void lv_draw_sw_polygon(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dra
 
     } while(mask_cnt < point_cnt);
 
-    lv_draw_rect(draw_ctx, draw_dsc, &poly_coords);
+    lv_draw_rect(draw_ctx, draw_dsc, poly_coords);
 
     lv_draw_mask_remove_custom(mp);
 
     lv_mem_buf_release(mp);
-    lv_mem_buf_release(p);
+}
 
-    draw_ctx->clip_area = clip_area_ori;
-#else
-    LV_UNUSED(points);
-    LV_UNUSED(point_cnt);
-    LV_UNUSED(draw_ctx);
-    LV_UNUSED(draw_dsc);
-    LV_LOG_WARN("Can't draw polygon with LV_DRAW_COMPLEX == 0");
-#endif /*LV_DRAW_COMPLEX*/
+/**
+ * Collect the non-horizontal edges of the polygon sorted by their top coordinate.
+ * @param p             the points of the polygon
+ * @param point_cnt     number of points
+ * @param poly_coords   bounding box of the points
+ * @param edges         store the edges here. Should have room for `point_cnt` edges
+ * @return              number of edges
+ */
+static uint16_t get_edges(const lv_point_t * p, uint16_t point_cnt, const lv_area_t * poly_coords, poly_edge_t * edges)
+{
+    /*Orientation of the polygon to know which side of an edge is outside*/
+    int32_t area = 0;
+    uint16_t i;
+    for(i = 0; i < point_cnt; i++) {
+        const lv_point_t * a = &p[i];
+        const lv_point_t * b = &p[i + 1 < point_cnt ? i + 1 : 0];
+        area += (int32_t)a->x * b->y - (int32_t)b->x * a->y;
+    }
+    int32_t area_sign = area >= 0 ? 1 : -1;
+
+    int32_t x_first;
+    int32_t y_first;
+    get_vertex(p, point_cnt, 0, area_sign, poly_coords, &x_first, &y_first);
+
+    uint16_t edge_cnt = 0;
+    int32_t x_prev = x_first;
+    int32_t y_prev = y_first;
+    for(i = 1; i <= point_cnt; i++) {
+        int32_t x_act;
+        int32_t y_act;
+        if(i < point_cnt) get_vertex(p, point_cnt, i, area_sign, poly_coords, &x_act, &y_act);
+        else {
+            x_act = x_first;
+            y_act = y_first;
+        }
+
+        if(y_prev != y_act) {
+            /*Insertion sort by the top coordinate. There are only a few edges typically*/
+            poly_edge_t e;
+            if(y_prev < y_act) {
+                e.x1 = x_prev;
+                e.y1 = y_prev;
+                e.x2 = x_act;
+                e.y2 = y_act;
+                e.dir = 1;
+            }
+            else {
+                e.x1 = x_act;
+                e.y1 = y_act;
+                e.x2 = x_prev;
+                e.y2 = y_prev;
+                e.dir = -1;
+            }
+
+            e.slope = ((int64_t)(e.x2 - e.x1) * 65536) / (e.y2 - e.y1);
+
+            uint16_t k = edge_cnt;
+            while(k > 0 && edges[k - 1].y1 > e.y1) {
+                edges[k] = edges[k - 1];
+                k--;
+            }
+            edges[k] = e;
+            edge_cnt++;
+        }
+
+        x_prev = x_act;
+        y_prev = y_act;
+    }
+
+    return edge_cnt;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+/**
+ * Get the sub-pixel position of a vertex.
+ * The points are on the pixel centers but horizontal and vertical edges are moved outward by half pixel
+ * to cover the whole last pixel. This way rectangles cover the same pixels as with `lv_draw_rect`.
+ * If an edge is moved its neighbor edges are lengthened/shortened along their lines.
+ * @param p             the points of the polygon
+ * @param point_cnt     number of points
+ * @param i             index of the vertex
+ * @param area_sign     1: the points are in clockwise order, -1: counter-clockwise
+ * @param poly_coords   bounding box of the points
+ * @param x             store the x coordinate here
+ * @param y             store the y coordinate here
+ */
+static void get_vertex(const lv_point_t * p, uint16_t point_cnt, uint16_t i, int32_t area_sign,
+                       const lv_area_t * poly_coords, int32_t * x, int32_t * y)
+{
+    const lv_point_t * act = &p[i];
+    const lv_point_t * prev = &p[i > 0 ? i - 1 : point_cnt - 1];
+    const lv_point_t * next = &p[i + 1 < point_cnt ? i + 1 : 0];
+
+    *x = ((int32_t)act->x << SUBPX_SHIFT) + SUBPX_HALF;
+    *y = ((int32_t)act->y << SUBPX_SHIFT) + SUBPX_HALF;
+
+    /*The outward normal of a clockwise edge (dx, dy) is (dy, -dx)*/
+    const lv_point_t * slanted = NULL;
+    bool has_vertical = false;
+    bool has_horizontal = false;
+    const lv_point_t * edge_start[2] = {prev, act};
+    const lv_point_t * edge_end[2] = {act, next};
+    uint32_t k;
+    for(k = 0; k < 2; k++) {
+        int32_t dx = edge_end[k]->x - edge_start[k]->x;
+        int32_t dy = edge_end[k]->y - edge_start[k]->y;
+        if(dx == 0) {
+            *x += (dy > 0 ? SUBPX_HALF : -SUBPX_HALF) * area_sign;
+            has_vertical = true;
+        }
+        else if(dy == 0) {
+            *y -= (dx > 0 ? SUBPX_HALF : -SUBPX_HALF) * area_sign;
+            has_horizontal = true;
+        }
+        else {
+            slanted = k == 0 ? prev : next;
+        }
+    }
+
+    /*Move the vertex along the slanted edge to the moved line*/
+    if(slanted && (has_vertical || has_horizontal)) {
+        int32_t dx = slanted->x - act->x;
+        int32_t dy = slanted->y - act->y;
+        int32_t x_center = ((int32_t)act->x << SUBPX_SHIFT) + SUBPX_HALF;
+        int32_t y_center = ((int32_t)act->y << SUBPX_SHIFT) + SUBPX_HALF;
+        if(has_vertical) *y = y_center + ((*x - x_center) * dy) / dx;
+        else *x = x_center + ((*y - y_center) * dx) / dy;
+    }
+
+    /*Steep edges can be lengthened a lot. Limit them to the bounding box*/
+    *x = LV_CLAMP((int32_t)poly_coords->x1 << SUBPX_SHIFT, *x, ((int32_t)poly_coords->x2 + 1) << SUBPX_SHIFT);
+    *y = LV_CLAMP((int32_t)poly_coords->y1 << SUBPX_SHIFT, *y, ((int32_t)poly_coords->y2 + 1) << SUBPX_SHIFT);
+}
+
+/**
+ * Get the x coordinate of an edge at a given y coordinate
+ * @param e     pointer to an edge
+ * @param y     sub-pixel y coordinate in the range of the edge
+ * @return      sub-pixel x coordinate
+ */
+static int32_t get_edge_x(const poly_edge_t * e, int32_t y)
+{
+    if(y == e->y1) return e->x1;
+    if(y == e->y2) return e->x2;
+    return e->x1 + (int32_t)((e->slope * (y - e->y1)) / 65536);
+}
+
+/**
+ * Accumulate the area covered by a segment of an edge in a row.
+ * The parts left to the row are handled as vertical lines at the left side, the parts on the right are ignored.
+ * @param acc       area accumulator of the row
+ * @param x1        sub-pixel x coordinate at `y1`, relative to the row's start
+ * @param y1        upper sub-pixel y coordinate
+ * @param x2        sub-pixel x coordinate at `y2`, relative to the row's start
+ * @param y2        lower sub-pixel y coordinate, at most one pixel below `y1`
+ * @param dir       1 or -1: direction of the edge
+ * @param w         width of the row in sub-pixels
+ * @param range     store the touched cells here (including the carry to the next cell)
+ * @return          false: the segment is on the right of the row, nothing was touched
+ */
+static bool add_segment(int32_t * acc, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t dir, int32_t w,
+                        cell_range_t * range)
+{
+    /*Go from left to right. The heights become negative so the direction needs to be inverted*/
+    if(x1 > x2) {
+        int32_t t = x1;
+        x1 = x2;
+        x2 = t;
+        t = y1;
+        y1 = y2;
+        y2 = t;
+        dir = -dir;
+    }
+
+    /*Cut the parts outside of the row*/
+    if(x1 >= w) return false;
+    if(x2 > w) {
+        y2 = y1 + (int32_t)(((int64_t)(w - x1) * (y2 - y1)) / (x2 - x1));
+        x2 = w;
+    }
+    if(x2 <= 0) {
+        x1 = 0;
+        x2 = 0;
+    }
+    else if(x1 < 0) {
+        int32_t y_cut = y1 + (int32_t)(((int64_t)(0 - x1) * (y2 - y1)) / (x2 - x1));
+        add_cell_segment(acc, 0, 0, 0, (y_cut - y1) * dir);
+        x1 = 0;
+        y1 = y_cut;
+    }
+
+    int32_t cell = x1 >> SUBPX_SHIFT;
+    int32_t cell_last = (x2 - 1) >> SUBPX_SHIFT;
+    if(cell_last < cell) cell_last = cell;
+    range->start = cell;
+    range->end = cell_last + 1;
+
+    if(cell == cell_last) {
+        add_cell_segment(acc, cell, x1, x2, (y2 - y1) * dir);
+        return true;
+    }
+
+    /*Walk through the crossed pixels*/
+    int32_t dx = x2 - x1;
+    int32_t dy = y2 - y1;
+    int32_t x_act = x1;
+    int32_t y_act = y1;
+    for(; cell < cell_last; cell++) {
+        int32_t x_next = (cell + 1) << SUBPX_SHIFT;
+        int32_t y_next = y1 + ((x_next - x1) * dy) / dx;
+        add_cell_segment(acc, cell, x_act, x_next, (y_next - y_act) * dir);
+        x_act = x_next;
+        y_act = y_next;
+    }
+    add_cell_segment(acc, cell, x_act, x2, (y2 - y_act) * dir);
+
+    return true;
+}
+
+/**
+ * Accumulate the area of segment inside a pixel
+ * @param acc       area accumulator of the row
+ * @param cell      index of the pixel
+ * @param x1        start x coordinate of the segment in the pixel (sub-pixel)
+ * @param x2        end x coordinate of the segment in the pixel (sub-pixel)
+ * @param h         signed height of the segment (sub-pixel)
+ */
+static void add_cell_segment(int32_t * acc, int32_t cell, int32_t x1, int32_t x2, int32_t h)
+{
+    /*The part right to the segment is covered in this pixel, the next pixels are covered fully*/
+    int32_t right = (cell + 1) << SUBPX_SHIFT;
+    int32_t a = (h * (2 * right - x1 - x2)) / 2;
+    acc[cell] += a;
+    acc[cell + 1] += h * SUBPX_ONE - a;
+}
+
+/**
+ * Handle a run of pixels with the same coverage in a row.
+ * Long fully covered runs are blended without mask, the others are added to the anti-aliased part.
+ * @param draw_ctx      pointer to a draw context
+ * @param blend_dsc     blend descriptor with the color and opacity already set
+ * @param line          coverage of the row
+ * @param x_ofs         x coordinate of `line[0]`
+ * @param y             y coordinate of the row
+ * @param start         first index of the run
+ * @param end           last index of the run
+ * @param sum           the accumulated area in the run
+ * @param pending       start of the not blended anti-aliased part or -1 if there is no such part
+ * @param mask_any      true: there are other masks, every pixel needs to be masked
+ * @return              the new start of the not blended anti-aliased part or -1
+ */
+static int32_t add_run(lv_draw_ctx_t * draw_ctx, lv_draw_sw_blend_dsc_t * blend_dsc, lv_opa_t * line,
+                       lv_coord_t x_ofs, lv_coord_t y, int32_t start, int32_t end, int32_t sum, int32_t pending,
+                       bool mask_any)
+{
+    int32_t cov = LV_ABS(sum) >> SUBPX_SHIFT;
+    if(cov >= LV_OPA_COVER) cov = LV_OPA_COVER;
+
+    if(cov == 0 || (cov == LV_OPA_COVER && !mask_any && end - start + 1 >= FULL_RUN_MIN)) {
+        if(pending >= 0) blend_masked(draw_ctx, blend_dsc, line, x_ofs, y, pending, start - 1, mask_any);
+        if(cov == 0) return -1;
+
+        lv_area_t blend_area;
+        blend_area.x1 = x_ofs + start;
+        blend_area.x2 = x_ofs + end;
+        blend_area.y1 = y;
+        blend_area.y2 = y;
+        blend_dsc->blend_area = &blend_area;
+        blend_dsc->mask_buf = NULL;
+        blend_dsc->mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+        lv_draw_sw_blend(draw_ctx, blend_dsc);
+        return -1;
+    }
+
+    lv_memset(&line[start], cov, end - start + 1);
+    return pending >= 0 ? pending : start;
+}
+
+/**
+ * Blend a part of a row with its coverage as mask
+ * @param draw_ctx      pointer to a draw context
+ * @param blend_dsc     blend descriptor with the color and opacity already set
+ * @param line          coverage of the row
+ * @param x_ofs         x coordinate of `line[0]`
+ * @param y             y coordinate of the row
+ * @param start         first index to blend
+ * @param end           last index to blend
+ * @param mask_any      true: apply the other masks too
+ */
+static void blend_masked(lv_draw_ctx_t * draw_ctx, lv_draw_sw_blend_dsc_t * blend_dsc, lv_opa_t * line,
+                         lv_coord_t x_ofs, lv_coord_t y, int32_t start, int32_t end, bool mask_any)
+{
+    if(start > end) return;
+
+    if(mask_any) {
+        lv_draw_mask_res_t res = lv_draw_mask_apply(&line[start], x_ofs + start, y, end - start + 1);
+        if(res == LV_DRAW_MASK_RES_TRANSP) return;
+    }
+
+    lv_area_t blend_area;
+    blend_area.x1 = x_ofs + start;
+    blend_area.x2 = x_ofs + end;
+    blend_area.y1 = y;
+    blend_area.y2 = y;
+    blend_dsc->blend_area = &blend_area;
+    blend_dsc->mask_area = &blend_area;
+    blend_dsc->mask_buf = &line[start];
+    blend_dsc->mask_res = LV_DRAW_MASK_RES_CHANGED;
+    lv_draw_sw_blend(draw_ctx, blend_dsc);
+}
+
+#endif /*LV_DRAW_COMPLEX*/
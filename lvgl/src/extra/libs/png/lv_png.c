@@ -50,6 +50,8 @@ void lv_png_init(void)
     lv_img_decoder_set_info_cb(dec, decoder_info);
     lv_img_decoder_set_open_cb(dec, decoder_open);
     lv_img_decoder_set_close_cb(dec, decoder_close);
+    /*Uses only lv_fs and lv_mem: can be decoded in the background*/
+    lv_img_decoder_set_async(dec, true);
 }
 
 /**********************
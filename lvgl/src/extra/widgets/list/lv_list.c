@@ -30,7 +30,8 @@
 const lv_obj_class_t lv_list_class = {
     .base_class = &lv_obj_class,
     .width_def = (LV_DPI_DEF * 3) / 2,
-    .height_def = LV_DPI_DEF * 2
+    .height_def = LV_DPI_DEF * 2,
+    .scroll_copy = 1,
 };
 
 const lv_obj_class_t lv_list_btn_class = {
@@ -118,6 +118,12 @@ typedef struct _lv_disp_drv_t {
 
     void (*clear_cb)(struct _lv_disp_drv_t * disp_drv, uint8_t * buf, uint32_t size);
 
+    /** OPTIONAL: Move the already flushed pixels of `area` on the display by `dx` and `dy`.
+     * The pixels moved out of `area` are dropped, the uncovered parts can be left as they are.
+     * Used to scroll without redrawing the whole scrolled area. Return `false` if the copy couldn't be done
+     * to redraw the whole area instead.*/
+    bool (*copy_cb)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy);
+
     /** OPTIONAL: Called after every refresh cycle to tell the rendering and flushing time + the
      * number of flushed pixels*/
     void (*monitor_cb)(struct _lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px);
@@ -187,6 +193,11 @@ typedef struct _lv_disp_t {
     uint16_t inv_p;
     int32_t inv_en_cnt;
 
+    /** Area to move with `copy_cb` before the next refresh*/
+    lv_area_t copy_area;
+    lv_point_t copy_ofs;
+    uint8_t copy_pending : 1;
+
     /** Double buffer sync areas */
     lv_ll_t sync_areas;
 
@@ -157,6 +157,36 @@
         #endif
     #endif
 
+    /*1: Serve the small allocations (up to 256 bytes) from size-class slabs in a dedicated region of the pool.
+     *It's faster than TLSF and keeps the small objects from fragmenting the rest of the pool.*/
+    #ifndef LV_USE_MEM_SLAB
+        #ifdef CONFIG_LV_USE_MEM_SLAB
+            #define LV_USE_MEM_SLAB CONFIG_LV_USE_MEM_SLAB
+        #else
+            #define LV_USE_MEM_SLAB 0
+        #endif
+    #endif
+    #if LV_USE_MEM_SLAB
+        /*Size of the slab region in bytes. The small allocations fall back to TLSF if it's full.*/
+        #ifndef LV_MEM_SLAB_SIZE
+            #ifdef CONFIG_LV_MEM_SLAB_SIZE
+                #define LV_MEM_SLAB_SIZE CONFIG_LV_MEM_SLAB_SIZE
+            #else
+                #define LV_MEM_SLAB_SIZE (64U * 1024U)          /*[bytes]*/
+            #endif
+        #endif
+    #endif
+
+    /*1: Enable `lv_mem_arena_begin/end()` to allocate the objects of a screen from 16 kB chunks by bumping a pointer.
+     *A chunk is given back at once when all its blocks are freed.*/
+    #ifndef LV_USE_MEM_ARENA
+        #ifdef CONFIG_LV_USE_MEM_ARENA
+            #define LV_USE_MEM_ARENA CONFIG_LV_USE_MEM_ARENA
+        #else
+            #define LV_USE_MEM_ARENA 0
+        #endif
+    #endif
+
 #else       /*LV_MEM_CUSTOM*/
     #ifndef LV_MEM_CUSTOM_INCLUDE
         #ifdef CONFIG_LV_MEM_CUSTOM_INCLUDE
@@ -198,6 +228,34 @@
     #endif
 #endif
 
+/*1: Serve `lv_mem_buf_get()` from a LIFO stack of the calling thread instead of searching `LV_MEM_BUF_MAX_NUM` buffers.
+ *The buffers are aligned to 16 bytes. The ones not fitting into the stack are allocated from the heap.*/
+#ifndef LV_USE_MEM_BUF_STACK
+    #ifdef CONFIG_LV_USE_MEM_BUF_STACK
+        #define LV_USE_MEM_BUF_STACK CONFIG_LV_USE_MEM_BUF_STACK
+    #else
+        #define LV_USE_MEM_BUF_STACK 0
+    #endif
+#endif
+#if LV_USE_MEM_BUF_STACK
+    /*Size of the stack of a thread in bytes*/
+    #ifndef LV_MEM_BUF_STACK_SIZE
+        #ifdef CONFIG_LV_MEM_BUF_STACK_SIZE
+            #define LV_MEM_BUF_STACK_SIZE CONFIG_LV_MEM_BUF_STACK_SIZE
+        #else
+            #define LV_MEM_BUF_STACK_SIZE (16U * 1024U)
+        #endif
+    #endif
+    /*Max. number of threads having an own stack. More than 1 makes sense only if `LV_ATTRIBUTE_THREAD_LOCAL` is set.*/
+    #ifndef LV_MEM_BUF_STACK_CNT
+        #ifdef CONFIG_LV_MEM_BUF_STACK_CNT
+            #define LV_MEM_BUF_STACK_CNT CONFIG_LV_MEM_BUF_STACK_CNT
+        #else
+            #define LV_MEM_BUF_STACK_CNT 1
+        #endif
+    #endif
+#endif  /*LV_USE_MEM_BUF_STACK*/
+
 /*Use the standard `memcpy` and `memset` instead of LVGL's own functions. (Might or might not be faster).*/
 #ifndef LV_MEMCPY_MEMSET_STD
     #ifdef CONFIG_LV_MEMCPY_MEMSET_STD
@@ -207,6 +265,27 @@
     #endif
 #endif
 
+/*1: Use NEON or SSE2 in `lv_memcpy` and `lv_memset` if the CPU supports it (checked at run time).
+ *Has effect only if `LV_MEMCPY_MEMSET_STD == 0`*/
+#ifndef LV_USE_MEMCPY_SIMD
+    #ifdef CONFIG_LV_USE_MEMCPY_SIMD
+        #define LV_USE_MEMCPY_SIMD CONFIG_LV_USE_MEMCPY_SIMD
+    #else
+        #define LV_USE_MEMCPY_SIMD 0
+    #endif
+#endif
+#if LV_USE_MEMCPY_SIMD
+    /*Copy and set at least this many bytes with non-temporal stores to not flush the caches
+     *(e.g. copying a whole frame buffer). Used only if the CPU has such stores.*/
+    #ifndef LV_MEMCPY_SIMD_NT_SIZE
+        #ifdef CONFIG_LV_MEMCPY_SIMD_NT_SIZE
+            #define LV_MEMCPY_SIMD_NT_SIZE CONFIG_LV_MEMCPY_SIMD_NT_SIZE
+        #else
+            #define LV_MEMCPY_SIMD_NT_SIZE (128 * 1024)
+        #endif
+    #endif
+#endif  /*LV_USE_MEMCPY_SIMD*/
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -220,6 +299,17 @@
     #endif
 #endif
 
+/*Extra cost of refreshing an area separately instead of joining it with an other one, in pixels.
+ *Two invalid areas are joined if the joined area is smaller than their sum plus this value.
+ *If there is no place for a new area the cheapest join is done instead of redrawing the whole screen.*/
+#ifndef LV_DISP_INV_AREA_COST
+    #ifdef CONFIG_LV_DISP_INV_AREA_COST
+        #define LV_DISP_INV_AREA_COST CONFIG_LV_DISP_INV_AREA_COST
+    #else
+        #define LV_DISP_INV_AREA_COST 0
+    #endif
+#endif
+
 /*Input device read period in milliseconds*/
 #ifndef LV_INDEV_DEF_READ_PERIOD
     #ifdef CONFIG_LV_INDEV_DEF_READ_PERIOD
@@ -310,6 +400,19 @@
             #define LV_CIRCLE_CACHE_SIZE 4
         #endif
     #endif
+
+    /* Set number of maximally cached arc rings.
+    * The anti-aliased coverage of 1/4 ring is saved per (radius, width) so that redrawing an arc
+    * (e.g. progress arcs and spinners on every animation step) applies only the angle mask.
+    * radius * radius bytes are used per ring (the most often used rings are saved)
+    * 0: to disable caching */
+    #ifndef LV_ARC_RING_CACHE_SIZE
+        #ifdef CONFIG_LV_ARC_RING_CACHE_SIZE
+            #define LV_ARC_RING_CACHE_SIZE CONFIG_LV_ARC_RING_CACHE_SIZE
+        #else
+            #define LV_ARC_RING_CACHE_SIZE 0
+        #endif
+    #endif
 #endif /*LV_DRAW_COMPLEX*/
 
 /**
@@ -353,6 +456,43 @@
     #endif
 #endif
 
+/*Memory budget of the image cache in bytes: the decoded data of the cached images.
+ *Images are evicted (least recently used first) when a new image would exceed it.
+ *Images larger than the budget are opened but not kept in the cache.
+ *0: only `LV_IMG_CACHE_DEF_SIZE` limits the cache*/
+#ifndef LV_IMG_CACHE_MEM_SIZE
+    #ifdef CONFIG_LV_IMG_CACHE_MEM_SIZE
+        #define LV_IMG_CACHE_MEM_SIZE CONFIG_LV_IMG_CACHE_MEM_SIZE
+    #else
+        #define LV_IMG_CACHE_MEM_SIZE 0
+    #endif
+#endif
+
+/*1: Open the images of the decoders marked with `lv_img_decoder_set_async()` (e.g. PNG files) on a background thread.
+ *Until an image is decoded nothing is drawn in its place and the area is redrawn when it's ready.
+ *Requires pthread and LV_IMG_CACHE_DEF_SIZE > 0. Makes `lv_mem_alloc` & co. thread safe.*/
+#ifndef LV_IMG_CACHE_ASYNC
+    #ifdef CONFIG_LV_IMG_CACHE_ASYNC
+        #define LV_IMG_CACHE_ASYNC CONFIG_LV_IMG_CACHE_ASYNC
+    #else
+        #define LV_IMG_CACHE_ASYNC 0
+    #endif
+#endif
+
+/*Memory budget of the image transformation cache in bytes.
+ *Images which are rotated/zoomed to the same few angles (e.g. clock hands) can opt-in with
+ *`lv_img_set_transform_cache()` to keep the transformed result and blit it again instead of transforming.
+ *The cache key is the decoded image data, angle, zoom, pivot and anti-aliasing.
+ *Images whose transformations are rarely reused (less than 2/3 hits) are transformed in place instead.
+ *0: to disable caching*/
+#ifndef LV_IMG_TRANSFORM_CACHE_SIZE
+    #ifdef CONFIG_LV_IMG_TRANSFORM_CACHE_SIZE
+        #define LV_IMG_TRANSFORM_CACHE_SIZE CONFIG_LV_IMG_TRANSFORM_CACHE_SIZE
+    #else
+        #define LV_IMG_TRANSFORM_CACHE_SIZE 0
+    #endif
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -409,6 +549,35 @@
     #endif
 #endif
 
+/*1: Split large software blend operations (fills and image copies) into horizontal bands
+ *and blend them on a pool of worker threads. Requires pthread.*/
+#ifndef LV_USE_PARALLEL_RENDER
+    #ifdef CONFIG_LV_USE_PARALLEL_RENDER
+        #define LV_USE_PARALLEL_RENDER CONFIG_LV_USE_PARALLEL_RENDER
+    #else
+        #define LV_USE_PARALLEL_RENDER 0
+    #endif
+#endif
+#if LV_USE_PARALLEL_RENDER
+    /*Number of threads blending together, including the rendering thread*/
+    #ifndef LV_PARALLEL_RENDER_THREADS
+        #ifdef CONFIG_LV_PARALLEL_RENDER_THREADS
+            #define LV_PARALLEL_RENDER_THREADS CONFIG_LV_PARALLEL_RENDER_THREADS
+        #else
+            #define LV_PARALLEL_RENDER_THREADS 2
+        #endif
+    #endif
+
+    /*Smaller areas are blended on the rendering thread as waking up the workers costs more than it saves [px]*/
+    #ifndef LV_PARALLEL_RENDER_MIN_PX
+        #ifdef CONFIG_LV_PARALLEL_RENDER_MIN_PX
+            #define LV_PARALLEL_RENDER_MIN_PX CONFIG_LV_PARALLEL_RENDER_MIN_PX
+        #else
+            #define LV_PARALLEL_RENDER_MIN_PX (16 * 1024)
+        #endif
+    #endif
+#endif
+
 /*-------------
  * GPU
  *-----------*/
@@ -773,6 +942,69 @@
     #endif
 #endif
 
+/*1: Skip drawing the parts of widgets which are covered by opaque siblings or children drawn later.
+ *The saving can be read with `lv_refr_get_overdraw()`*/
+#ifndef LV_USE_REFR_OCCLUSION
+    #ifdef CONFIG_LV_USE_REFR_OCCLUSION
+        #define LV_USE_REFR_OCCLUSION CONFIG_LV_USE_REFR_OCCLUSION
+    #else
+        #define LV_USE_REFR_OCCLUSION 0
+    #endif
+#endif
+
+/*1: Cache the style property values read by `lv_obj_get_style_prop` per object, part and state.
+ *The cache is dropped when any style, object state or parent changes.*/
+#ifndef LV_USE_STYLE_CACHE
+    #ifdef CONFIG_LV_USE_STYLE_CACHE
+        #define LV_USE_STYLE_CACHE CONFIG_LV_USE_STYLE_CACHE
+    #else
+        #define LV_USE_STYLE_CACHE 0
+    #endif
+#endif
+#if LV_USE_STYLE_CACHE
+    /*Number of cached values. Must be a power of 2*/
+    #ifndef LV_STYLE_CACHE_SIZE
+        #ifdef CONFIG_LV_STYLE_CACHE_SIZE
+            #define LV_STYLE_CACHE_SIZE CONFIG_LV_STYLE_CACHE_SIZE
+        #else
+            #define LV_STYLE_CACHE_SIZE 512
+        #endif
+    #endif
+#endif
+
+/*1: Remember the state of the children after a flex/grid layout run and skip the next run of
+ *the container if its size and its children's position, size and flags haven't changed since.
+ *The state is stored per container, it takes a pointer, the flags and 4 coordinates per child.
+ *`lv_obj_mark_layout_as_dirty()` always runs the layout.*/
+#ifndef LV_USE_LAYOUT_CACHE
+    #ifdef CONFIG_LV_USE_LAYOUT_CACHE
+        #define LV_USE_LAYOUT_CACHE CONFIG_LV_USE_LAYOUT_CACHE
+    #else
+        #define LV_USE_LAYOUT_CACHE 0
+    #endif
+#endif
+
+/*1: Step the animations in batches: evaluate all the animations first, then apply the values
+ *while refreshing the style of each animated object only once, and run the step right before
+ *the display refresh to show the new values in the same frame.*/
+#ifndef LV_USE_ANIM_BATCH
+    #ifdef CONFIG_LV_USE_ANIM_BATCH
+        #define LV_USE_ANIM_BATCH CONFIG_LV_USE_ANIM_BATCH
+    #else
+        #define LV_USE_ANIM_BATCH 0
+    #endif
+#endif
+#if LV_USE_ANIM_BATCH
+    /*Max. number of objects whose style refresh can be coalesced in one step. The others are refreshed immediately*/
+    #ifndef LV_ANIM_BATCH_OBJ_MAX
+        #ifdef CONFIG_LV_ANIM_BATCH_OBJ_MAX
+            #define LV_ANIM_BATCH_OBJ_MAX CONFIG_LV_ANIM_BATCH_OBJ_MAX
+        #else
+            #define LV_ANIM_BATCH_OBJ_MAX 32
+        #endif
+    #endif
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #ifndef LV_SPRINTF_CUSTOM
     #ifdef CONFIG_LV_SPRINTF_CUSTOM
@@ -943,6 +1175,16 @@
     #endif
 #endif
 
+/*Prefix variables having a separate instance in each thread. E.g. `__thread` or `_Thread_local`.
+ *Leave empty if LVGL is used from one thread only.*/
+#ifndef LV_ATTRIBUTE_THREAD_LOCAL
+    #ifdef CONFIG_LV_ATTRIBUTE_THREAD_LOCAL
+        #define LV_ATTRIBUTE_THREAD_LOCAL CONFIG_LV_ATTRIBUTE_THREAD_LOCAL
+    #else
+        #define LV_ATTRIBUTE_THREAD_LOCAL
+    #endif
+#endif
+
 /*Export integer constant to binding. This macro is used with constants in the form of LV_<CONST> that
  *should also appear on LVGL binding API such as Micropython.*/
 #ifndef LV_EXPORT_CONST_INT
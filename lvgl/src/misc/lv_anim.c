@@ -29,6 +29,7 @@
  *  STATIC PROTOTYPES
  **********************/
 static void anim_timer(lv_timer_t * param);
+static bool anim_eval(lv_anim_t * a, uint32_t elaps);
 static void anim_mark_list_change(void);
 static void anim_ready_handler(lv_anim_t * a);
 
@@ -39,6 +40,10 @@ static uint32_t last_timer_run;
 static bool anim_list_changed;
 static bool anim_run_round;
 static lv_timer_t * _lv_anim_tmr;
+#if LV_USE_ANIM_BATCH
+    static lv_anim_frame_cb_t frame_begin_cb;
+    static lv_anim_frame_cb_t frame_end_cb;
+#endif
 
 /**********************
  *      MACROS
@@ -93,6 +98,10 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
     if(a->var == a) new_anim->var = new_anim;
     new_anim->run_round = anim_run_round;
+#if LV_USE_ANIM_BATCH
+    new_anim->apply_pending = 0;
+    new_anim->ready_pending = 0;
+#endif
 
     /*Set the start value*/
     if(new_anim->early_apply) {
@@ -208,6 +217,23 @@ void lv_anim_refr_now(void)
     anim_timer(NULL);
 }
 
+#if LV_USE_ANIM_BATCH
+void _lv_anim_set_frame_cb(lv_anim_frame_cb_t begin_cb, lv_anim_frame_cb_t end_cb)
+{
+    frame_begin_cb = begin_cb;
+    frame_end_cb = end_cb;
+}
+
+void _lv_anim_refr_frame(void)
+{
+    if(_lv_anim_tmr->paused) return;
+    if(lv_tick_elaps(_lv_anim_tmr->last_run) < _lv_anim_tmr->period) return;
+
+    anim_timer(NULL);
+    lv_timer_reset(_lv_anim_tmr);
+}
+#endif
+
 int32_t lv_anim_path_linear(const lv_anim_t * a)
 {
     /*Calculate the current step*/
@@ -342,6 +368,7 @@ int32_t lv_anim_path_step(const lv_anim_t * a)
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_USE_ANIM_BATCH == 0
 /**
  * Periodically handle the animations.
  * @param param unused
@@ -367,34 +394,12 @@ static void anim_timer(lv_timer_t * param)
         if(a->run_round != anim_run_round) {
             a->run_round = anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
 
-            /*The animation will run now for the first time. Call `start_cb`*/
-            int32_t new_act_time = a->act_time + elaps;
-            if(!a->start_cb_called && a->act_time <= 0 && new_act_time >= 0) {
-                if(a->early_apply == 0 && a->get_value_cb) {
-                    int32_t v_ofs = a->get_value_cb(a);
-                    a->start_value += v_ofs;
-                    a->end_value += v_ofs;
-                }
-                if(a->start_cb) a->start_cb(a);
-                a->start_cb_called = 1;
-            }
-            a->act_time += elaps;
-            if(a->act_time >= 0) {
-                if(a->act_time > a->time) a->act_time = a->time;
-
-                int32_t new_value;
-                new_value = a->path_cb(a);
-
-                if(new_value != a->current_value) {
-                    a->current_value = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
-                }
-
-                /*If the time is elapsed the animation is ready*/
-                if(a->act_time >= a->time) {
-                    anim_ready_handler(a);
-                }
+            /*Apply the calculated value*/
+            if(anim_eval(a, elaps) && a->exec_cb) a->exec_cb(a->var, a->current_value);
+
+            /*If the time is elapsed the animation is ready*/
+            if(a->act_time >= 0 && a->act_time >= a->time) {
+                anim_ready_handler(a);
             }
         }
 
@@ -408,6 +413,110 @@ static void anim_timer(lv_timer_t * param)
 
     last_timer_run = lv_tick_get();
 }
+#else
+/**
+ * Periodically handle the animations in three passes:
+ * evaluate all the animations, apply the new values and handle the finished animations.
+ * The new values are applied between the frame begin and end callbacks (see `_lv_anim_set_frame_cb`).
+ * @param param unused
+ */
+static void anim_timer(lv_timer_t * param)
+{
+    LV_UNUSED(param);
+
+    uint32_t elaps = lv_tick_elaps(last_timer_run);
+
+    /*Flip the run round*/
+    anim_run_round = anim_run_round ? false : true;
+
+    /*Evaluate. Only the `start_cb`s can change the list here.
+     *If it happens start from the head again, `run_round` tells which animations are evaluated already.*/
+    lv_anim_t * a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
+    while(a != NULL) {
+        anim_list_changed = false;
+
+        if(a->run_round != anim_run_round) {
+            a->run_round = anim_run_round;
+            if(anim_eval(a, elaps)) a->apply_pending = 1;
+            if(a->act_time >= 0 && a->act_time >= a->time) a->ready_pending = 1;
+        }
+
+        if(anim_list_changed)
+            a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
+        else
+            a = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
+    }
+
+    /*Apply the new values*/
+    if(frame_begin_cb) frame_begin_cb();
+    a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
+    while(a != NULL) {
+        anim_list_changed = false;
+
+        if(a->apply_pending) {
+            a->apply_pending = 0;
+            if(a->exec_cb) a->exec_cb(a->var, a->current_value);
+        }
+
+        if(anim_list_changed)
+            a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
+        else
+            a = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
+    }
+    if(frame_end_cb) frame_end_cb();
+
+    /*Repeat, play back or delete the finished animations*/
+    a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
+    while(a != NULL) {
+        anim_list_changed = false;
+
+        if(a->ready_pending) {
+            a->ready_pending = 0;
+            anim_ready_handler(a);
+        }
+
+        if(anim_list_changed)
+            a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
+        else
+            a = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
+    }
+
+    last_timer_run = lv_tick_get();
+}
+#endif
+
+/**
+ * Advance an animation by the elapsed time and calculate its new value.
+ * Calls `start_cb` if the animation starts now.
+ * @param a         pointer to an animation descriptor
+ * @param elaps     elapsed time since the last step in [ms]
+ * @return          true: `current_value` has changed and needs to be applied
+ */
+static bool anim_eval(lv_anim_t * a, uint32_t elaps)
+{
+    /*The animation will run now for the first time. Call `start_cb`*/
+    int32_t new_act_time = a->act_time + elaps;
+    if(!a->start_cb_called && a->act_time <= 0 && new_act_time >= 0) {
+        if(a->early_apply == 0 && a->get_value_cb) {
+            int32_t v_ofs = a->get_value_cb(a);
+            a->start_value += v_ofs;
+            a->end_value += v_ofs;
+        }
+        if(a->start_cb) a->start_cb(a);
+        a->start_cb_called = 1;
+    }
+    a->act_time += elaps;
+    if(a->act_time < 0) return false;
+
+    if(a->act_time > a->time) a->act_time = a->time;
+
+    int32_t new_value;
+    new_value = a->path_cb(a);
+    if(new_value == a->current_value) return false;
+
+    a->current_value = new_value;
+    return true;
+}
 
 /**
  * Called when an animation is ready to do the necessary thinks
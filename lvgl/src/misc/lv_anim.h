@@ -33,6 +33,11 @@ LV_EXPORT_CONST_INT(LV_ANIM_PLAYTIME_INFINITE);
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_ANIM_BATCH
+/** Called around applying the new values of the animations in a step*/
+typedef void (*lv_anim_frame_cb_t)(void);
+#endif
+
 /** Can be used to indicate if animations are enabled or disabled in a case*/
 typedef enum {
     LV_ANIM_OFF,
@@ -96,6 +101,10 @@ typedef struct _lv_anim_t {
     uint8_t playback_now : 1; /**< Play back is in progress*/
     uint8_t run_round : 1;    /**< Indicates the animation has run in this round*/
     uint8_t start_cb_called : 1;    /**< Indicates that the `start_cb` was already called*/
+#if LV_USE_ANIM_BATCH
+    uint8_t apply_pending : 1;      /**< `current_value` is evaluated in this step but not applied yet*/
+    uint8_t ready_pending : 1;      /**< The animation reached its end in this step*/
+#endif
 } lv_anim_t;
 
 /**********************
@@ -419,6 +428,22 @@ uint32_t lv_anim_speed_to_time(uint32_t speed, int32_t start, int32_t end);
  */
 void lv_anim_refr_now(void);
 
+#if LV_USE_ANIM_BATCH
+/**
+ * Set the callbacks called before and after the new values of the animations are applied in a step.
+ * The core uses them to refresh the style of an object only once after all of its animations.
+ * @param begin_cb  called before the first `exec_cb` of the step or NULL
+ * @param end_cb    called after the last `exec_cb` of the step or NULL
+ */
+void _lv_anim_set_frame_cb(lv_anim_frame_cb_t begin_cb, lv_anim_frame_cb_t end_cb);
+
+/**
+ * Step the animations now if their period has elapsed and restart the animation timer.
+ * Called by the display refresh to show the new values in the frame being drawn.
+ */
+void _lv_anim_refr_frame(void);
+#endif
+
 /**
  * Calculate the current value of an animation applying linear characteristic
  * @param a     pointer to an animation
@@ -12,6 +12,7 @@
 #include "lv_gc.h"
 #include "lv_assert.h"
 #include "lv_log.h"
+#include "lv_mem_simd.h"
 
 #if LV_MEM_CUSTOM != 0
     #include LV_MEM_CUSTOM_INCLUDE
@@ -21,6 +22,10 @@
     #include LV_MEM_POOL_INCLUDE
 #endif
 
+#if LV_MEM_CUSTOM == 0 && LV_IMG_CACHE_ASYNC
+    #include <pthread.h>
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -29,6 +34,15 @@
     #define LV_MEM_ADD_JUNK  0
 #endif
 
+/*The image cache's decoding thread allocates too: protect the heap with a mutex*/
+#if LV_MEM_CUSTOM == 0 && LV_IMG_CACHE_ASYNC
+    #define MEM_LOCK()       pthread_mutex_lock(&mem_mutex)
+    #define MEM_UNLOCK()     pthread_mutex_unlock(&mem_mutex)
+#else
+    #define MEM_LOCK()
+    #define MEM_UNLOCK()
+#endif
+
 #ifdef LV_ARCH_64
     #define MEM_UNIT         uint64_t
     #define ALIGN_MASK       0x7
@@ -39,9 +53,103 @@
 
 #define ZERO_MEM_SENTINEL  0xa1b2c3d4
 
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_SLAB
+    #define SLAB_PAGE_SHIFT     12
+    #define SLAB_PAGE_SIZE      (1U << SLAB_PAGE_SHIFT)
+    #define SLAB_PAGE_CNT       (LV_MEM_SLAB_SIZE / SLAB_PAGE_SIZE)
+    #define SLAB_MAX_SIZE       256
+    #define SLAB_NONE           0xFFFF  /*No page*/
+    #define SLAB_PAGE_UNUSED    0xFF    /*Class of the pages not used by any class*/
+
+    #if SLAB_PAGE_CNT == 0 || SLAB_PAGE_CNT >= SLAB_NONE
+        #error "LV_MEM_SLAB_SIZE must be at least 4 kB and less than 256 MB"
+    #endif
+#endif
+
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    #define ARENA_CHUNK_SHIFT   14
+    #define ARENA_CHUNK_SIZE    (1U << ARENA_CHUNK_SHIFT)
+    #define ARENA_MAX_SIZE      1024    /*Larger memories are allocated from TLSF*/
+    #define ARENA_MAX_CNT       8       /*Max. number of arenas*/
+    #define ARENA_NEST_MAX      4       /*Max. nesting of `lv_mem_arena_begin`*/
+    #define ARENA_ALIGN         8
+    #define ARENA_HDR_SIZE      ARENA_ALIGN     /*The size of the block is stored before it. Keeps the alignment.*/
+    /*A bit for each chunk sized slot of the pool. +1 as the pool might not be aligned to the chunks*/
+    #define ARENA_MAP_BITS      (LV_MEM_SIZE / ARENA_CHUNK_SIZE + 1)
+#endif
+
+#if LV_USE_MEM_BUF_STACK
+    #define BUF_ALIGN           16      /*Alignment of the buffers. Enough for NEON and SSE*/
+    #define BUF_FRAME_NONE      0xFFFFFFFF
+    #define BUF_FRAME_MAGIC     0x6C62
+    #define BUF_STACK_HEAP      0xFF    /*`stack_id` of the buffers allocated from the heap*/
+    #define BUF_ALIGN_UP(x)     (((x) + BUF_ALIGN - 1) & ~((lv_uintptr_t)BUF_ALIGN - 1))
+
+    #if LV_MEM_BUF_STACK_CNT < 1 || LV_MEM_BUF_STACK_CNT >= BUF_STACK_HEAP
+        #error "LV_MEM_BUF_STACK_CNT must be between 1 and 254"
+    #endif
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_SLAB
+/*A page of the slab region. It's divided into blocks of the same size class.*/
+typedef struct {
+    void * free_list;   /*The freed blocks of the page linked through their first word*/
+    uint16_t bump;      /*Number of blocks ever given out. The blocks after these weren't touched yet.*/
+    uint16_t used;      /*Number of allocated blocks*/
+    uint16_t prev;      /*Neighbours in the list of the class's pages having free blocks*/
+    uint16_t next;      /*(or in the list of unused pages)*/
+    uint8_t cls;        /*Index of the size class or `SLAB_PAGE_UNUSED`*/
+} slab_page_t;
+
+typedef struct {
+    uint16_t partial;   /*First page of the class having free blocks*/
+    uint16_t blocks;    /*Number of blocks in a page*/
+    uint16_t page_cnt;
+    uint32_t used_cnt;
+    uint32_t alloc_cnt;
+    uint32_t fallback_cnt;
+} slab_class_t;
+#endif
+
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+struct _mem_arena_t;
+
+/*Header in the beginning of an arena chunk*/
+typedef struct {
+    struct _mem_arena_t * arena;    /*The arena allocating from this chunk or NULL if it's closed*/
+    uint32_t used;                  /*Number of living blocks*/
+    uint32_t bump;                  /*Offset of the first free byte*/
+} arena_chunk_t;
+
+typedef struct _mem_arena_t {
+    const void * owner;             /*NULL if the arena is not used*/
+    arena_chunk_t * chunk;          /*The chunk to allocate from*/
+} mem_arena_t;
+#endif
+
+#if LV_USE_MEM_BUF_STACK
+/*Header right before each buffer*/
+typedef struct {
+    uint32_t prev;      /*Offset of the header of the buffer below or `BUF_FRAME_NONE`*/
+    uint32_t top_prev;  /*`top` of the stack before pushing the buffer. For heap buffers their offset in the allocation*/
+    uint16_t magic;
+    uint8_t stack_id;   /*Index in `buf_stacks` or `BUF_STACK_HEAP`*/
+    uint8_t released;   /*Released but there are buffers above it*/
+} buf_frame_t;
+
+typedef struct {
+    uint8_t * mem;      /*`BUF_ALIGN` aligned start of the stack*/
+    uint32_t last;      /*Offset of the header of the topmost buffer or `BUF_FRAME_NONE`*/
+    uint32_t top;       /*Offset of the first free byte*/
+    uint32_t size;
+    uint32_t max_used;
+    uint32_t get_cnt;
+    uint32_t fallback_cnt;
+} buf_stack_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -49,6 +157,28 @@
 #if LV_MEM_CUSTOM == 0
     static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
 #endif
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_SLAB
+    static void slab_init(void);
+    static void * slab_alloc(size_t size);
+    static size_t slab_free(void * data);
+    static void * slab_realloc(void * data_p, size_t new_size);
+    static inline bool slab_contains(const void * data);
+#endif
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    static void arena_init(void * pool);
+    static void * arena_alloc(mem_arena_t * arena, size_t size);
+    static void arena_free(void * data);
+    static void arena_chunk_free(arena_chunk_t * chunk);
+    static void * arena_realloc(void * data_p, size_t new_size);
+    static inline bool arena_contains(const void * data);
+#endif
+#if LV_USE_MEM_BUF_STACK
+    static buf_stack_t * buf_stack_claim(void);
+    static void * buf_heap_get(buf_stack_t * stack, uint32_t size);
+#endif
+#if LV_MEMCPY_MEMSET_STD == 0 && LV_USE_MEMCPY_SIMD
+    static void std_memset(void * dst, uint8_t v, size_t len);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -59,8 +189,52 @@
     static uint32_t max_used;
 #endif
 
+#if LV_MEM_CUSTOM == 0 && LV_IMG_CACHE_ASYNC
+    static pthread_mutex_t mem_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variable if 0 byte should be allocated*/
 
+/*The slab and the arena are shared by all threads like the TLSF heap (the image cache's decoding thread allocates too).
+ *Read or modify their state only with `MEM_LOCK()` held.*/
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_SLAB
+    static const uint16_t slab_sizes[LV_MEM_SLAB_CLASS_CNT] = {16, 32, 48, 64, 96, 128, 192, 256};
+    /*Size class of the allocations by their size in 16 bytes units, rounded up*/
+    static const uint8_t slab_size_to_class[SLAB_MAX_SIZE / 16 + 1] = {0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7};
+    static uint8_t * slab_mem;
+    static slab_page_t slab_pages[SLAB_PAGE_CNT];
+    static slab_class_t slab_classes[LV_MEM_SLAB_CLASS_CNT];
+    static uint16_t slab_unused_page;   /*First unused page, linked through `next`*/
+    static uint16_t slab_unused_cnt;
+#endif
+
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    static mem_arena_t arenas[ARENA_MAX_CNT];
+    /*Only the thread calling `lv_mem_arena_begin` allocates from the arena*/
+    static LV_ATTRIBUTE_THREAD_LOCAL mem_arena_t * arena_act;   /*Allocate from this arena*/
+    static LV_ATTRIBUTE_THREAD_LOCAL mem_arena_t * arena_stack[ARENA_NEST_MAX];
+    static LV_ATTRIBUTE_THREAD_LOCAL uint32_t arena_nest;
+    static uintptr_t arena_map_start;               /*Address of the first chunk slot*/
+    static uint32_t arena_map[(ARENA_MAP_BITS + 31) / 32];
+    static uint32_t arena_chunk_cnt;
+    static uint32_t arena_alloc_cnt;
+#endif
+
+#if LV_USE_MEM_BUF_STACK
+    static uint8_t buf_stack_mem[LV_MEM_BUF_STACK_CNT][LV_MEM_BUF_STACK_SIZE + BUF_ALIGN];
+    static buf_stack_t buf_stacks[LV_MEM_BUF_STACK_CNT];
+    static buf_stack_t buf_stack_none;  /*Used by the threads not getting a stack. Everything goes to the heap.*/
+    static uint32_t buf_stack_cnt;      /*Number of stacks given to threads*/
+    static LV_ATTRIBUTE_THREAD_LOCAL buf_stack_t * buf_stack_act;   /*Stack of the calling thread*/
+#endif
+
+#if LV_MEMCPY_MEMSET_STD == 0 && LV_USE_MEMCPY_SIMD
+    static lv_memcpy_impl_t memcpy_impl = LV_MEMCPY_IMPL_LOOP;
+    /*`lv_memcpy` and `lv_memset` call these if set, else use their own loops*/
+    static void * (*memcpy_cb)(void * dst, const void * src, size_t len);
+    static void (*memset_cb)(void * dst, uint8_t v, size_t len);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -98,6 +272,17 @@ void lv_mem_init(void)
 #else
     tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_ADR, LV_MEM_SIZE);
 #endif
+
+#if LV_USE_MEM_SLAB
+    slab_init();
+#endif
+#if LV_USE_MEM_ARENA
+    arena_init(lv_tlsf_get_pool(tlsf));
+#endif
+#endif
+
+#if LV_MEMCPY_MEMSET_STD == 0 && LV_USE_MEMCPY_SIMD
+    lv_memcpy_set_impl(LV_MEMCPY_IMPL_AUTO);
 #endif
 
 #if LV_MEM_ADD_JUNK
@@ -130,8 +315,37 @@ void * lv_mem_alloc(size_t size)
         return &zero_mem;
     }
 
+    MEM_LOCK();
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    if(arena_act && size <= ARENA_MAX_SIZE) {
+        void * alloc = arena_alloc(arena_act, size);
+        if(alloc) {
+            MEM_UNLOCK();
+            MEM_TRACE("allocated at %p from arena", alloc);
+            return alloc;
+        }
+    }
+#endif
+
 #if LV_MEM_CUSTOM == 0
-    void * alloc = lv_tlsf_malloc(tlsf, size);
+    /*Count the size of the block, not the requested size, as only that is known when it's freed*/
+    void * alloc = NULL;
+    size_t block_size = 0;
+#if LV_USE_MEM_SLAB
+    if(size <= SLAB_MAX_SIZE) {
+        alloc = slab_alloc(size);
+        if(alloc) block_size = slab_sizes[slab_size_to_class[(size + 15) >> 4]];
+    }
+#endif
+    if(alloc == NULL) {
+        alloc = lv_tlsf_malloc(tlsf, size);
+        if(alloc) block_size = lv_tlsf_block_size(alloc);
+    }
+    if(alloc) {
+        cur_used += block_size;
+        max_used = LV_MAX(cur_used, max_used);
+    }
+    MEM_UNLOCK();
 #else
     void * alloc = LV_MEM_CUSTOM_ALLOC(size);
 #endif
@@ -153,10 +367,6 @@ void * lv_mem_alloc(size_t size)
 #endif
 
     if(alloc) {
-#if LV_MEM_CUSTOM == 0
-        cur_used += size;
-        max_used = LV_MAX(cur_used, max_used);
-#endif
         MEM_TRACE("allocated at %p", alloc);
     }
     return alloc;
@@ -173,12 +383,29 @@ void lv_mem_free(void * data)
     if(data == NULL) return;
 
 #if LV_MEM_CUSTOM == 0
+    MEM_LOCK();
+#  if LV_USE_MEM_ARENA
+    if(arena_contains(data)) {
+        arena_free(data);
+        MEM_UNLOCK();
+        return;
+    }
+#  endif
+    size_t size;
+#  if LV_USE_MEM_SLAB
+    if(slab_contains(data)) size = slab_free(data);
+    else
+#  endif
+    {
+        size = lv_tlsf_block_size(data);
 #  if LV_MEM_ADD_JUNK
-    lv_memset(data, 0xbb, lv_tlsf_block_size(data));
+        lv_memset(data, 0xbb, size);
 #  endif
-    size_t size = lv_tlsf_free(tlsf, data);
+        lv_tlsf_free(tlsf, data);
+    }
     if(cur_used > size) cur_used -= size;
     else cur_used = 0;
+    MEM_UNLOCK();
 #else
     LV_MEM_CUSTOM_FREE(data);
 #endif
@@ -202,8 +429,33 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
 
     if(data_p == &zero_mem) return lv_mem_alloc(new_size);
 
+#if LV_MEM_CUSTOM == 0 && (LV_USE_MEM_SLAB || LV_USE_MEM_ARENA)
+    if(data_p == NULL) return lv_mem_alloc(new_size);
+#endif
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_SLAB
+    MEM_LOCK();
+    bool in_slab = slab_contains(data_p);
+    MEM_UNLOCK();
+    if(in_slab) return slab_realloc(data_p, new_size);
+#endif
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    /*The arena map changes when an other thread takes or frees a chunk*/
+    MEM_LOCK();
+    bool in_arena = arena_contains(data_p);
+    MEM_UNLOCK();
+    if(in_arena) return arena_realloc(data_p, new_size);
+#endif
+
 #if LV_MEM_CUSTOM == 0
+    MEM_LOCK();
+    size_t old_size = lv_tlsf_block_size(data_p);
     void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
+    if(new_p) {
+        cur_used = cur_used > old_size ? cur_used - old_size : 0;
+        cur_used += lv_tlsf_block_size(new_p);
+        max_used = LV_MAX(cur_used, max_used);
+    }
+    MEM_UNLOCK();
 #else
     void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
 #endif
@@ -224,12 +476,17 @@ lv_res_t lv_mem_test(void)
     }
 
 #if LV_MEM_CUSTOM == 0
-    if(lv_tlsf_check(tlsf)) {
+    MEM_LOCK();
+    int tlsf_res = lv_tlsf_check(tlsf);
+    int pool_res = lv_tlsf_check_pool(lv_tlsf_get_pool(tlsf));
+    MEM_UNLOCK();
+
+    if(tlsf_res) {
         LV_LOG_WARN("failed");
         return LV_RES_INV;
     }
 
-    if(lv_tlsf_check_pool(lv_tlsf_get_pool(tlsf))) {
+    if(pool_res) {
         LV_LOG_WARN("pool failed");
         return LV_RES_INV;
     }
@@ -250,6 +507,7 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 #if LV_MEM_CUSTOM == 0
     MEM_TRACE("begin");
 
+    MEM_LOCK();
     lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf), lv_mem_walker, mon_p);
 
     mon_p->total_size = LV_MEM_SIZE;
@@ -262,12 +520,115 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
         mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
     }
 
+    mon_p->cur_used = cur_used;
     mon_p->max_used = max_used;
 
+#if LV_USE_MEM_SLAB
+    mon_p->slab_size = slab_mem ? SLAB_PAGE_CNT * SLAB_PAGE_SIZE : 0;
+    mon_p->slab_free_page_cnt = slab_unused_cnt;
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        mon_p->slab[i].size = slab_sizes[i];
+        mon_p->slab[i].page_cnt = slab_classes[i].page_cnt;
+        mon_p->slab[i].used_cnt = slab_classes[i].used_cnt;
+        mon_p->slab[i].alloc_cnt = slab_classes[i].alloc_cnt;
+        mon_p->slab[i].fallback_cnt = slab_classes[i].fallback_cnt;
+    }
+#endif
+
+#if LV_USE_MEM_ARENA
+    uint32_t a;
+    for(a = 0; a < ARENA_MAX_CNT; a++) {
+        if(arenas[a].owner) mon_p->arena_cnt++;
+    }
+    mon_p->arena_chunk_cnt = arena_chunk_cnt;
+    mon_p->arena_alloc_cnt = arena_alloc_cnt;
+#endif
+    MEM_UNLOCK();
+
     MEM_TRACE("finished");
 #endif
 }
 
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+void lv_mem_arena_begin(const void * owner)
+{
+    if(arena_nest >= ARENA_NEST_MAX) {
+        LV_LOG_WARN("lv_mem_arena_begin is nested too deeply");
+        arena_nest++;   /*Still count it to match `lv_mem_arena_end`*/
+        return;
+    }
+
+    /*Find the arena of the owner or a free one. No owner: allocate from the heap.*/
+    mem_arena_t * arena = NULL;
+    uint32_t i;
+    MEM_LOCK();
+    for(i = 0; i < ARENA_MAX_CNT && owner; i++) {
+        if(arenas[i].owner == owner) {
+            arena = &arenas[i];
+            break;
+        }
+        if(arena == NULL && arenas[i].owner == NULL) arena = &arenas[i];
+    }
+
+    if(arena && arena->owner == NULL) {
+        arena->owner = owner;
+        arena->chunk = NULL;
+    }
+    MEM_UNLOCK();
+
+    if(arena == NULL && owner) {
+        LV_LOG_WARN("no free arena, allocating normally");
+    }
+
+    arena_stack[arena_nest] = arena_act;
+    arena_nest++;
+    arena_act = arena;
+}
+
+void lv_mem_arena_end(void)
+{
+    if(arena_nest == 0) {
+        LV_LOG_WARN("called without lv_mem_arena_begin");
+        return;
+    }
+
+    arena_nest--;
+    if(arena_nest < ARENA_NEST_MAX) arena_act = arena_stack[arena_nest];
+}
+
+void lv_mem_arena_release(const void * owner)
+{
+    if(owner == NULL) return;
+
+    MEM_LOCK();
+    uint32_t i;
+    for(i = 0; i < ARENA_MAX_CNT; i++) {
+        if(arenas[i].owner == owner) break;
+    }
+    if(i == ARENA_MAX_CNT) {
+        MEM_UNLOCK();
+        return;
+    }
+
+    mem_arena_t * arena = &arenas[i];
+    arena_chunk_t * chunk = arena->chunk;
+    if(chunk) {
+        chunk->arena = NULL;
+        if(chunk->used == 0) arena_chunk_free(chunk);
+    }
+    arena->owner = NULL;
+    arena->chunk = NULL;
+    MEM_UNLOCK();
+
+    /*Don't allocate from it if it's released between begin and end*/
+    if(arena_act == arena) arena_act = NULL;
+    for(i = 0; i < arena_nest && i < ARENA_NEST_MAX; i++) {
+        if(arena_stack[i] == arena) arena_stack[i] = NULL;
+    }
+}
+#endif
+
 /**
  * Get a temporal buffer with the given size.
  * @param size the required size
@@ -278,6 +639,29 @@ void * lv_mem_buf_get(uint32_t size)
 
     MEM_TRACE("begin, getting %d bytes", size);
 
+#if LV_USE_MEM_BUF_STACK
+    buf_stack_t * stack = buf_stack_act;
+    if(stack == NULL) stack = buf_stack_claim();
+    stack->get_cnt++;
+
+    uint32_t data_ofs = BUF_ALIGN_UP(stack->top + sizeof(buf_frame_t));
+    if(data_ofs > stack->size || size > stack->size - data_ofs) return buf_heap_get(stack, size);
+
+    buf_frame_t * frame = (buf_frame_t *)(stack->mem + data_ofs - sizeof(buf_frame_t));
+    frame->prev = stack->last;
+    frame->top_prev = stack->top;
+    frame->magic = BUF_FRAME_MAGIC;
+    frame->stack_id = stack - buf_stacks;
+    frame->released = 0;
+
+    stack->last = data_ofs - sizeof(buf_frame_t);
+    stack->top = data_ofs + size;
+    if(stack->top > stack->max_used) stack->max_used = stack->top;
+
+    MEM_TRACE("pushed to the stack (address: %p)", stack->mem + data_ofs);
+    return stack->mem + data_ofs;
+#else
+
     /*Try to find a free buffer with suitable size*/
     int8_t i_guess = -1;
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
@@ -307,7 +691,15 @@ void * lv_mem_buf_get(uint32_t size)
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
         if(LV_GC_ROOT(lv_mem_buf[i]).used == 0) {
             /*if this fails you probably need to increase your LV_MEM_SIZE/heap size*/
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+            /*The buffers are kept for ever so don't let them keep an arena chunk allocated*/
+            mem_arena_t * arena_act_ori = arena_act;
+            arena_act = NULL;
             void * buf = lv_mem_realloc(LV_GC_ROOT(lv_mem_buf[i]).p, size);
+            arena_act = arena_act_ori;
+#else
+            void * buf = lv_mem_realloc(LV_GC_ROOT(lv_mem_buf[i]).p, size);
+#endif
             LV_ASSERT_MSG(buf != NULL, "Out of memory, can't allocate a new buffer (increase your LV_MEM_SIZE/heap size)");
             if(buf == NULL) return NULL;
 
@@ -322,6 +714,7 @@ void * lv_mem_buf_get(uint32_t size)
     LV_LOG_ERROR("no more buffers. (increase LV_MEM_BUF_MAX_NUM)");
     LV_ASSERT_MSG(false, "No more buffers. Increase LV_MEM_BUF_MAX_NUM.");
     return NULL;
+#endif
 }
 
 /**
@@ -332,6 +725,33 @@ void lv_mem_buf_release(void * p)
 {
     MEM_TRACE("begin (address: %p)", p);
 
+#if LV_USE_MEM_BUF_STACK
+    if(p == NULL) return;
+
+    buf_frame_t * frame = (buf_frame_t *)((uint8_t *)p - sizeof(buf_frame_t));
+    if(frame->magic != BUF_FRAME_MAGIC) {
+        LV_LOG_ERROR("p is not a known buffer");
+        return;
+    }
+
+    if(frame->stack_id == BUF_STACK_HEAP) {
+        frame->magic = 0;
+        lv_mem_free((uint8_t *)p - frame->top_prev);
+        return;
+    }
+
+    /*Pop the released buffers from the top. A buffer released out of order is popped
+     *together with the last one above it.*/
+    buf_stack_t * stack = &buf_stacks[frame->stack_id];
+    frame->released = 1;
+    while(stack->last != BUF_FRAME_NONE) {
+        buf_frame_t * last = (buf_frame_t *)(stack->mem + stack->last);
+        if(!last->released) break;
+        last->magic = 0;
+        stack->top = last->top_prev;
+        stack->last = last->prev;
+    }
+#else
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
         if(LV_GC_ROOT(lv_mem_buf[i]).p == p) {
             LV_GC_ROOT(lv_mem_buf[i]).used = 0;
@@ -340,6 +760,7 @@ void lv_mem_buf_release(void * p)
     }
 
     LV_LOG_ERROR("p is not a known buffer");
+#endif
 }
 
 /**
@@ -347,6 +768,13 @@ void lv_mem_buf_release(void * p)
  */
 void lv_mem_buf_free_all(void)
 {
+#if LV_USE_MEM_BUF_STACK
+    /*The stacks are kept and the heap buffers were freed on release, nothing to do*/
+    buf_stack_t * stack = buf_stack_act;
+    if(stack && stack->top != 0) {
+        LV_LOG_WARN("%" LV_PRIu32 " bytes of buffers are still used", stack->top);
+    }
+#else
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
         if(LV_GC_ROOT(lv_mem_buf[i]).p) {
             lv_mem_free(LV_GC_ROOT(lv_mem_buf[i]).p);
@@ -355,9 +783,90 @@ void lv_mem_buf_free_all(void)
             LV_GC_ROOT(lv_mem_buf[i]).size = 0;
         }
     }
+#endif
 }
 
+#if LV_USE_MEM_BUF_STACK
+/**
+ * Give information about the buffer stacks
+ * @param mon_p     the result will be stored here
+ */
+void lv_mem_buf_monitor(lv_mem_buf_monitor_t * mon_p)
+{
+    lv_memset_00(mon_p, sizeof(lv_mem_buf_monitor_t));
+
+    uint32_t cnt = LV_MIN(buf_stack_cnt, LV_MEM_BUF_STACK_CNT);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        mon_p->used += buf_stacks[i].top;
+        mon_p->max_used = LV_MAX(mon_p->max_used, buf_stacks[i].max_used);
+        mon_p->get_cnt += buf_stacks[i].get_cnt;
+        mon_p->fallback_cnt += buf_stacks[i].fallback_cnt;
+    }
+    mon_p->get_cnt += buf_stack_none.get_cnt;
+    mon_p->fallback_cnt += buf_stack_none.fallback_cnt;
+    mon_p->stack_size = LV_MEM_BUF_STACK_SIZE;
+    mon_p->thread_cnt = cnt;
+}
+#endif
+
 #if LV_MEMCPY_MEMSET_STD == 0
+
+#if LV_USE_MEMCPY_SIMD
+bool lv_memcpy_set_impl(lv_memcpy_impl_t impl)
+{
+    if(impl == LV_MEMCPY_IMPL_AUTO) {
+        /*The standard functions are not used automatically as they are slower than the loops with some libc*/
+        impl = lv_memcpy_set_impl(LV_MEMCPY_IMPL_SIMD) ? LV_MEMCPY_IMPL_SIMD : LV_MEMCPY_IMPL_LOOP;
+    }
+
+    switch(impl) {
+        case LV_MEMCPY_IMPL_LOOP:
+            memcpy_cb = NULL;
+            memset_cb = NULL;
+            break;
+        case LV_MEMCPY_IMPL_STD:
+            memcpy_cb = memcpy;
+            memset_cb = std_memset;
+            break;
+        case LV_MEMCPY_IMPL_SIMD:
+#if _LV_MEM_SIMD
+            if(!_lv_mem_simd_supported()) return false;
+            memcpy_cb = _lv_memcpy_simd;
+            memset_cb = _lv_memset_simd;
+            break;
+#else
+            return false;
+#endif
+        default:
+            return false;
+    }
+
+    memcpy_impl = impl;
+    MEM_TRACE("lv_memcpy uses %s", lv_memcpy_get_impl_name());
+    return true;
+}
+
+lv_memcpy_impl_t lv_memcpy_get_impl(void)
+{
+    return memcpy_impl;
+}
+
+const char * lv_memcpy_get_impl_name(void)
+{
+    switch(memcpy_impl) {
+        case LV_MEMCPY_IMPL_STD:
+            return "std";
+#if _LV_MEM_SIMD
+        case LV_MEMCPY_IMPL_SIMD:
+            return _lv_mem_simd_name();
+#endif
+        default:
+            return "loop";
+    }
+}
+#endif /*LV_USE_MEMCPY_SIMD*/
+
 /**
  * Same as `memcpy` but optimized for 4 byte operation.
  * @param dst pointer to the destination buffer
@@ -366,6 +875,10 @@ void lv_mem_buf_free_all(void)
  */
 void * LV_ATTRIBUTE_FAST_MEM lv_memcpy(void * dst, const void * src, size_t len)
 {
+#if LV_USE_MEMCPY_SIMD
+    if(memcpy_cb) return memcpy_cb(dst, src, len);
+#endif
+
     uint8_t * d8 = dst;
     const uint8_t * s8 = src;
 
@@ -428,6 +941,12 @@ void * LV_ATTRIBUTE_FAST_MEM lv_memcpy(void * dst, const void * src, size_t len)
  */
 void LV_ATTRIBUTE_FAST_MEM lv_memset(void * dst, uint8_t v, size_t len)
 {
+#if LV_USE_MEMCPY_SIMD
+    if(memset_cb) {
+        memset_cb(dst, v, len);
+        return;
+    }
+#endif
 
     uint8_t * d8 = (uint8_t *)dst;
 
@@ -471,6 +990,13 @@ void LV_ATTRIBUTE_FAST_MEM lv_memset(void * dst, uint8_t v, size_t len)
  */
 void LV_ATTRIBUTE_FAST_MEM lv_memset_00(void * dst, size_t len)
 {
+#if LV_USE_MEMCPY_SIMD
+    if(memset_cb) {
+        memset_cb(dst, 0x00, len);
+        return;
+    }
+#endif
+
     uint8_t * d8 = (uint8_t *)dst;
     uintptr_t d_align = (lv_uintptr_t) d8 & ALIGN_MASK;
 
@@ -509,6 +1035,13 @@ void LV_ATTRIBUTE_FAST_MEM lv_memset_00(void * dst, size_t len)
  */
 void LV_ATTRIBUTE_FAST_MEM lv_memset_ff(void * dst, size_t len)
 {
+#if LV_USE_MEMCPY_SIMD
+    if(memset_cb) {
+        memset_cb(dst, 0xFF, len);
+        return;
+    }
+#endif
+
     uint8_t * d8 = (uint8_t *)dst;
     uintptr_t d_align = (lv_uintptr_t) d8 & ALIGN_MASK;
 
@@ -563,3 +1096,374 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
     }
 }
 #endif
+
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_SLAB
+/**
+ * Allocate the slab region from the pool and put all its pages to the unused list
+ */
+static void slab_init(void)
+{
+    lv_memset_00(slab_classes, sizeof(slab_classes));
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        slab_classes[i].partial = SLAB_NONE;
+        slab_classes[i].blocks = SLAB_PAGE_SIZE / slab_sizes[i];
+    }
+
+    slab_unused_page = SLAB_NONE;
+    slab_unused_cnt = 0;
+    slab_mem = lv_tlsf_memalign(tlsf, SLAB_PAGE_SIZE, SLAB_PAGE_CNT * SLAB_PAGE_SIZE);
+    if(slab_mem == NULL) {
+        LV_LOG_WARN("couldn't allocate the slab region, increase LV_MEM_SIZE or reduce LV_MEM_SLAB_SIZE");
+        return;
+    }
+
+    for(i = SLAB_PAGE_CNT; i > 0; i--) {
+        slab_pages[i - 1].cls = SLAB_PAGE_UNUSED;
+        slab_pages[i - 1].next = slab_unused_page;
+        slab_unused_page = i - 1;
+    }
+    slab_unused_cnt = SLAB_PAGE_CNT;
+}
+
+static inline bool slab_contains(const void * data)
+{
+    /*If `slab_mem` is NULL no pointer is in [0, size) as they are in the heap*/
+    return (const uint8_t *)data >= slab_mem && (const uint8_t *)data < slab_mem + SLAB_PAGE_CNT * SLAB_PAGE_SIZE;
+}
+
+/**
+ * Remove a page from the list of its class's pages having free blocks
+ * @param c         the size class
+ * @param page_id   index of the page
+ */
+static void slab_partial_remove(slab_class_t * c, uint16_t page_id)
+{
+    slab_page_t * page = &slab_pages[page_id];
+    if(page->prev != SLAB_NONE) slab_pages[page->prev].next = page->next;
+    else c->partial = page->next;
+    if(page->next != SLAB_NONE) slab_pages[page->next].prev = page->prev;
+}
+
+/**
+ * Allocate a block from the size class of `size`
+ * @param size      size of the allocation, at most `SLAB_MAX_SIZE`
+ * @return          pointer to the block or NULL if the slab region is full
+ */
+static void * slab_alloc(size_t size)
+{
+    uint8_t cls = slab_size_to_class[(size + 15) >> 4];
+    slab_class_t * c = &slab_classes[cls];
+
+    uint16_t page_id = c->partial;
+    if(page_id == SLAB_NONE) {
+        /*Take a new page for the class*/
+        page_id = slab_unused_page;
+        if(page_id == SLAB_NONE) {
+            c->fallback_cnt++;
+            return NULL;
+        }
+        slab_page_t * page = &slab_pages[page_id];
+        slab_unused_page = page->next;
+        slab_unused_cnt--;
+
+        page->free_list = NULL;
+        page->bump = 0;
+        page->used = 0;
+        page->prev = SLAB_NONE;
+        page->next = SLAB_NONE;
+        page->cls = cls;
+        c->partial = page_id;
+        c->page_cnt++;
+    }
+
+    slab_page_t * page = &slab_pages[page_id];
+    void * block;
+    if(page->free_list) {
+        block = page->free_list;
+        page->free_list = *(void **)block;
+    }
+    else {
+        block = slab_mem + ((uint32_t)page_id << SLAB_PAGE_SHIFT) + (uint32_t)page->bump * slab_sizes[cls];
+        page->bump++;
+    }
+    page->used++;
+
+    /*Full page: don't allocate from it until a block is freed*/
+    if(page->used == c->blocks) slab_partial_remove(c, page_id);
+
+    c->used_cnt++;
+    c->alloc_cnt++;
+    return block;
+}
+
+/**
+ * Free a block of the slab region. If its page becomes empty give it back to the unused pages.
+ * @param data      pointer to a block in the slab region
+ * @return          size of the block
+ */
+static size_t slab_free(void * data)
+{
+    uint16_t page_id = ((uint8_t *)data - slab_mem) >> SLAB_PAGE_SHIFT;
+    slab_page_t * page = &slab_pages[page_id];
+    slab_class_t * c = &slab_classes[page->cls];
+    size_t size = slab_sizes[page->cls];
+
+#if LV_MEM_ADD_JUNK
+    lv_memset(data, 0xbb, size);
+#endif
+
+    bool was_full = page->used == c->blocks;
+    *(void **)data = page->free_list;
+    page->free_list = data;
+    page->used--;
+    c->used_cnt--;
+
+    if(page->used == 0) {
+        if(!was_full) slab_partial_remove(c, page_id);
+        page->cls = SLAB_PAGE_UNUSED;
+        page->next = slab_unused_page;
+        slab_unused_page = page_id;
+        slab_unused_cnt++;
+        c->page_cnt--;
+    }
+    else if(was_full) {
+        page->prev = SLAB_NONE;
+        page->next = c->partial;
+        if(c->partial != SLAB_NONE) slab_pages[c->partial].prev = page_id;
+        c->partial = page_id;
+    }
+
+    return size;
+}
+
+/**
+ * Reallocate a block of the slab region. Keep it if the new size still fits into the block.
+ * @param data_p    pointer to a block in the slab region
+ * @param new_size  the new size in bytes
+ * @return          pointer to the new memory or NULL on failure
+ */
+static void * slab_realloc(void * data_p, size_t new_size)
+{
+    uint16_t page_id = ((uint8_t *)data_p - slab_mem) >> SLAB_PAGE_SHIFT;
+    MEM_LOCK();
+    size_t size = slab_sizes[slab_pages[page_id].cls];
+    MEM_UNLOCK();
+    if(new_size <= size) return data_p;
+
+    void * new_p = lv_mem_alloc(new_size);
+    if(new_p == NULL) {
+        LV_LOG_ERROR("couldn't allocate memory");
+        return NULL;
+    }
+
+    lv_memcpy(new_p, data_p, size);
+    lv_mem_free(data_p);
+    return new_p;
+}
+#endif
+
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+/**
+ * Reset the arenas and remember where the pool starts to find the chunks by address
+ * @param pool      start of the pool of TLSF
+ */
+static void arena_init(void * pool)
+{
+    lv_memset_00(arenas, sizeof(arenas));
+    lv_memset_00(arena_map, sizeof(arena_map));
+    arena_act = NULL;
+    arena_nest = 0;
+    arena_chunk_cnt = 0;
+    arena_map_start = (uintptr_t)pool & ~((uintptr_t)ARENA_CHUNK_SIZE - 1);
+}
+
+static inline bool arena_contains(const void * data)
+{
+    if(arena_chunk_cnt == 0) return false;
+    if((uintptr_t)data < arena_map_start) return false;
+    uintptr_t idx = ((uintptr_t)data - arena_map_start) >> ARENA_CHUNK_SHIFT;
+    if(idx >= ARENA_MAP_BITS) return false;
+    return (arena_map[idx >> 5] >> (idx & 0x1F)) & 1;
+}
+
+/**
+ * Allocate a block from the arena. Take a new chunk if it doesn't fit into the current one.
+ * @param arena     pointer to an arena
+ * @param size      size of the block, at most `ARENA_MAX_SIZE`
+ * @return          pointer to the block or NULL if no new chunk could be allocated
+ */
+static void * arena_alloc(mem_arena_t * arena, size_t size)
+{
+    size = (size + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+
+    arena_chunk_t * chunk = arena->chunk;
+    if(chunk == NULL || chunk->bump + ARENA_HDR_SIZE + size > ARENA_CHUNK_SIZE) {
+        arena_chunk_t * chunk_new = lv_tlsf_memalign(tlsf, ARENA_CHUNK_SIZE, ARENA_CHUNK_SIZE);
+        if(chunk_new == NULL) return NULL;
+
+        /*Close the old chunk. It will be given back when its last block is freed.*/
+        if(chunk) {
+            chunk->arena = NULL;
+            if(chunk->used == 0) arena_chunk_free(chunk);
+        }
+
+        chunk = chunk_new;
+        chunk->arena = arena;
+        chunk->used = 0;
+        chunk->bump = (sizeof(arena_chunk_t) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+        arena->chunk = chunk;
+
+        uintptr_t idx = ((uintptr_t)chunk - arena_map_start) >> ARENA_CHUNK_SHIFT;
+        arena_map[idx >> 5] |= 1UL << (idx & 0x1F);
+        arena_chunk_cnt++;
+        cur_used += ARENA_CHUNK_SIZE;
+        max_used = LV_MAX(cur_used, max_used);
+    }
+
+    uint8_t * block = (uint8_t *)chunk + chunk->bump + ARENA_HDR_SIZE;
+    *(uint32_t *)(block - ARENA_HDR_SIZE) = size;
+    chunk->bump += ARENA_HDR_SIZE + size;
+    chunk->used++;
+    arena_alloc_cnt++;
+
+#if LV_MEM_ADD_JUNK
+    lv_memset(block, 0xaa, size);
+#endif
+    return block;
+}
+
+/**
+ * Free a block of an arena. If it was the last block of the chunk,
+ * reuse the chunk if its arena is still allocating from it, else give it back to the heap.
+ * @param data      pointer to a block in an arena chunk
+ */
+static void arena_free(void * data)
+{
+    arena_chunk_t * chunk = (arena_chunk_t *)((uintptr_t)data & ~((uintptr_t)ARENA_CHUNK_SIZE - 1));
+    chunk->used--;
+    if(chunk->used) return;
+
+    if(chunk->arena) chunk->bump = (sizeof(arena_chunk_t) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+    else arena_chunk_free(chunk);
+}
+
+/**
+ * Give back an arena chunk to the heap
+ * @param chunk     pointer to a chunk without living blocks
+ */
+static void arena_chunk_free(arena_chunk_t * chunk)
+{
+    uintptr_t idx = ((uintptr_t)chunk - arena_map_start) >> ARENA_CHUNK_SHIFT;
+    arena_map[idx >> 5] &= ~(1UL << (idx & 0x1F));
+    arena_chunk_cnt--;
+    lv_tlsf_free(tlsf, chunk);
+    if(cur_used > ARENA_CHUNK_SIZE) cur_used -= ARENA_CHUNK_SIZE;
+    else cur_used = 0;
+}
+
+/**
+ * Reallocate a block of an arena. The last block of the chunk is resized in place if it fits,
+ * else the content is copied to a new memory.
+ * @param data_p    pointer to a block in an arena chunk
+ * @param new_size  the new size in bytes
+ * @return          pointer to the new memory or NULL on failure
+ */
+static void * arena_realloc(void * data_p, size_t new_size)
+{
+    arena_chunk_t * chunk = (arena_chunk_t *)((uintptr_t)data_p & ~((uintptr_t)ARENA_CHUNK_SIZE - 1));
+    uint32_t * size_p = (uint32_t *)((uint8_t *)data_p - ARENA_HDR_SIZE);
+    size_t new_size_aligned = (new_size + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+
+    MEM_LOCK();
+    size_t size = *size_p;
+    uint32_t ofs = (uint8_t *)data_p - (uint8_t *)chunk;
+    if(ofs + size == chunk->bump && new_size <= ARENA_MAX_SIZE && ofs + new_size_aligned <= ARENA_CHUNK_SIZE) {
+        chunk->bump = ofs + new_size_aligned;
+        *size_p = new_size_aligned;
+        MEM_UNLOCK();
+        return data_p;
+    }
+    MEM_UNLOCK();
+
+    if(new_size <= size) return data_p;
+
+    void * new_p = lv_mem_alloc(new_size);
+    if(new_p == NULL) {
+        LV_LOG_ERROR("couldn't allocate memory");
+        return NULL;
+    }
+
+    lv_memcpy(new_p, data_p, size);
+    lv_mem_free(data_p);
+    return new_p;
+}
+#endif
+
+#if LV_USE_MEM_BUF_STACK
+/**
+ * Give a stack to the calling thread. The stacks are never given back,
+ * the threads using LVGL are expected to live as long as LVGL.
+ * @return      the stack of the thread or `buf_stack_none` if there are no free stacks
+ */
+static buf_stack_t * buf_stack_claim(void)
+{
+#if defined(__GNUC__)
+    uint32_t id = __atomic_fetch_add(&buf_stack_cnt, 1, __ATOMIC_RELAXED);
+#else
+    uint32_t id = buf_stack_cnt++;
+#endif
+
+    buf_stack_t * stack;
+    if(id < LV_MEM_BUF_STACK_CNT) {
+        stack = &buf_stacks[id];
+        stack->mem = (uint8_t *)BUF_ALIGN_UP((lv_uintptr_t)buf_stack_mem[id]);
+        stack->size = LV_MEM_BUF_STACK_SIZE;
+        stack->top = 0;
+        stack->last = BUF_FRAME_NONE;
+    }
+    else {
+        LV_LOG_WARN("no free buffer stack, allocating the buffers from the heap (increase LV_MEM_BUF_STACK_CNT)");
+        stack = &buf_stack_none;
+    }
+
+    buf_stack_act = stack;
+    return stack;
+}
+
+/**
+ * Allocate a buffer from the heap if it doesn't fit into the stack
+ * @param stack     the stack of the calling thread
+ * @param size      size of the buffer
+ * @return          `BUF_ALIGN` aligned buffer or NULL on failure
+ */
+static void * buf_heap_get(buf_stack_t * stack, uint32_t size)
+{
+    stack->fallback_cnt++;
+
+    uint8_t * raw = lv_mem_alloc(size + sizeof(buf_frame_t) + BUF_ALIGN - 1);
+    LV_ASSERT_MSG(raw != NULL, "Out of memory, can't allocate a new buffer (increase your LV_MEM_SIZE/heap size)");
+    if(raw == NULL) return NULL;
+
+    uint8_t * data = (uint8_t *)BUF_ALIGN_UP((lv_uintptr_t)raw + sizeof(buf_frame_t));
+    buf_frame_t * frame = (buf_frame_t *)(data - sizeof(buf_frame_t));
+    frame->prev = BUF_FRAME_NONE;
+    frame->top_prev = data - raw;
+    frame->magic = BUF_FRAME_MAGIC;
+    frame->stack_id = BUF_STACK_HEAP;
+    frame->released = 0;
+
+    MEM_TRACE("allocated from the heap (address: %p)", data);
+    return data;
+}
+#endif
+
+#if LV_MEMCPY_MEMSET_STD == 0 && LV_USE_MEMCPY_SIMD
+/**
+ * `memset` with the signature of `memset_cb`
+ */
+static void std_memset(void * dst, uint8_t v, size_t len)
+{
+    memset(dst, v, len);
+}
+#endif
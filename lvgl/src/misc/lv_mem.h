@@ -17,6 +17,7 @@ extern "C" {
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include "lv_types.h"
@@ -24,11 +25,28 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_SLAB
+/*Number of slab size classes: 16, 32, 48, 64, 96, 128, 192 and 256 bytes*/
+#define LV_MEM_SLAB_CLASS_CNT   8
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_SLAB
+/**
+ * Usage of a slab size class
+ */
+typedef struct {
+    uint16_t size;          /**< Size of the blocks of the class*/
+    uint16_t page_cnt;      /**< Number of slab pages used by the class*/
+    uint32_t used_cnt;      /**< Number of allocated blocks*/
+    uint32_t alloc_cnt;     /**< Number of allocations served by the class since the start*/
+    uint32_t fallback_cnt;  /**< Number of allocations passed to TLSF because the slab region was full*/
+} lv_mem_slab_monitor_t;
+#endif
+
 /**
  * Heap information structure.
  */
@@ -38,9 +56,20 @@ typedef struct {
     uint32_t free_size; /**< Size of available memory*/
     uint32_t free_biggest_size;
     uint32_t used_cnt;
+    uint32_t cur_used; /**< Sum of the size of the allocated blocks*/
     uint32_t max_used; /**< Max size of Heap memory used*/
     uint8_t used_pct; /**< Percentage used*/
     uint8_t frag_pct; /**< Amount of fragmentation*/
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_SLAB
+    uint32_t slab_size;             /**< Size of the slab region. It's a used block of the heap above.*/
+    uint32_t slab_free_page_cnt;    /**< Number of slab pages not used by any class*/
+    lv_mem_slab_monitor_t slab[LV_MEM_SLAB_CLASS_CNT];  /**< Usage of the size classes*/
+#endif
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    uint32_t arena_cnt;             /**< Number of arenas*/
+    uint32_t arena_chunk_cnt;       /**< Number of arena chunks. They are used blocks of the heap above.*/
+    uint32_t arena_alloc_cnt;       /**< Number of allocations served by the arenas since the start*/
+#endif
 } lv_mem_monitor_t;
 
 typedef struct {
@@ -51,6 +80,32 @@ typedef struct {
 
 typedef lv_mem_buf_t lv_mem_buf_arr_t[LV_MEM_BUF_MAX_NUM];
 
+#if LV_USE_MEM_BUF_STACK
+/**
+ * Usage of the `lv_mem_buf_get()` stacks of the threads
+ */
+typedef struct {
+    uint32_t stack_size;    /**< Size of a stack*/
+    uint32_t used;          /**< Sum of the used bytes of the stacks*/
+    uint32_t max_used;      /**< Largest high-water mark of the stacks*/
+    uint32_t get_cnt;       /**< Number of `lv_mem_buf_get()` calls since the start*/
+    uint32_t fallback_cnt;  /**< Number of buffers allocated from the heap as they didn't fit into the stack*/
+    uint8_t thread_cnt;     /**< Number of threads having a stack*/
+} lv_mem_buf_monitor_t;
+#endif
+
+#if LV_MEMCPY_MEMSET_STD == 0 && LV_USE_MEMCPY_SIMD
+/**
+ * Implementations of `lv_memcpy` and `lv_memset`
+ */
+typedef enum {
+    LV_MEMCPY_IMPL_AUTO,    /**< The fastest one available on the CPU*/
+    LV_MEMCPY_IMPL_LOOP,    /**< LVGL's own 4 byte loops*/
+    LV_MEMCPY_IMPL_STD,     /**< The standard `memcpy` and `memset`*/
+    LV_MEMCPY_IMPL_SIMD,    /**< NEON or SSE2*/
+} lv_memcpy_impl_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -101,9 +156,38 @@ lv_res_t lv_mem_test(void);
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+/**
+ * Allocate the memories up to 1 kB from the arena of `owner` until `lv_mem_arena_end()`.
+ * The arena bumps a pointer in 16 kB chunks and counts the living blocks of each chunk.
+ * `lv_mem_free` only decrements the counter and a chunk is given back to the heap at once
+ * when its last block is freed. So blocks outliving the owner (e.g. an object moved to an other screen)
+ * stay valid, they only keep their chunk allocated.
+ * Can be nested. With `owner == NULL` the memories are allocated from the heap until the matching
+ * `lv_mem_arena_end()`. Use it around data outliving the screen being built (e.g. caches, fonts)
+ * not to keep a chunk of the screen allocated.
+ * @param owner     the arena is identified by this pointer, typically the screen being built, or NULL
+ */
+void lv_mem_arena_begin(const void * owner);
+
+/**
+ * Stop allocating from the arena given in the last `lv_mem_arena_begin()`
+ */
+void lv_mem_arena_end(void);
+
+/**
+ * Close the arena of `owner`. Its chunks are given back when their last block is freed.
+ * Called when an object is deleted.
+ * @param owner     the owner of the arena
+ */
+void lv_mem_arena_release(const void * owner);
+#endif
+
 /**
  * Get a temporal buffer with the given size.
  * @param size the required size
+ * @note With `LV_USE_MEM_BUF_STACK` the buffer is pushed to the stack of the calling thread
+ *       and it's popped only when the buffers got after it are released too.
  */
 void * lv_mem_buf_get(uint32_t size);
 
@@ -118,6 +202,14 @@ void lv_mem_buf_release(void * p);
  */
 void lv_mem_buf_free_all(void);
 
+#if LV_USE_MEM_BUF_STACK
+/**
+ * Give information about the buffer stacks
+ * @param mon_p     the result will be stored here
+ */
+void lv_mem_buf_monitor(lv_mem_buf_monitor_t * mon_p);
+#endif
+
 //! @cond Doxygen_Suppress
 
 #if LV_MEMCPY_MEMSET_STD
@@ -227,6 +319,28 @@ void /* LV_ATTRIBUTE_FAST_MEM */ lv_memset_00(void * dst, size_t len);
  */
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_memset_ff(void * dst, size_t len);
 
+#if LV_USE_MEMCPY_SIMD
+/**
+ * Select the implementation of `lv_memcpy`, `lv_memset`, `lv_memset_00` and `lv_memset_ff`.
+ * `lv_mem_init()` selects `LV_MEMCPY_IMPL_AUTO`.
+ * @param impl  the implementation to use
+ * @return      true: selected; false: not available on this CPU, the previous one is kept
+ */
+bool lv_memcpy_set_impl(lv_memcpy_impl_t impl);
+
+/**
+ * Get the current implementation of `lv_memcpy` and `lv_memset`
+ * @return      `LV_MEMCPY_IMPL_LOOP`, `LV_MEMCPY_IMPL_STD` or `LV_MEMCPY_IMPL_SIMD`
+ */
+lv_memcpy_impl_t lv_memcpy_get_impl(void);
+
+/**
+ * Get the name of the current implementation of `lv_memcpy` and `lv_memset`
+ * @return      "loop", "std", "NEON" or "SSE2"
+ */
+const char * lv_memcpy_get_impl_name(void);
+#endif
+
 //! @endcond
 
 #endif
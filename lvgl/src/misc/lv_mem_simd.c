@@ -0,0 +1,290 @@
+/**
+ * @file lv_mem_simd.c
+ * `memcpy` and `memset` with NEON or SSE2. Used by `lv_memcpy` and `lv_memset`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_mem_simd.h"
+
+#if _LV_MEM_SIMD
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #if defined(__linux__) && !defined(__aarch64__)
+        #include <sys/auxv.h>
+    #endif
+#else
+    #include <emmintrin.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define SIMD_NAME           "NEON"
+    #define VEC_LOAD(p)         vld1q_u8((const uint8_t *)(p))
+    #define VEC_STORE(p, v)     vst1q_u8((uint8_t *)(p), v)
+    /*ARMv7 has no non-temporal stores, only prefetch the source*/
+    #define VEC_STORE_NT(p, v)  vst1q_u8((uint8_t *)(p), v)
+    #define VEC_NT_FENCE()
+    #define VEC_SPLAT(v)        vdupq_n_u8(v)
+    #ifndef HWCAP_NEON
+        #define HWCAP_NEON      (1 << 12)
+    #endif
+#else
+    #define SIMD_NAME           "SSE2"
+    #define VEC_LOAD(p)         _mm_loadu_si128((const __m128i *)(p))
+    #define VEC_STORE(p, v)     _mm_storeu_si128((__m128i *)(p), v)
+    #define VEC_STORE_NT(p, v)  _mm_stream_si128((__m128i *)(p), v)    /*`p` has to be 16 byte aligned*/
+    #define VEC_NT_FENCE()      _mm_sfence()
+    #define VEC_SPLAT(v)        _mm_set1_epi8((char)(v))
+#endif
+
+#define PREFETCH_DIST   256     /*Prefetch the source this many bytes ahead in the large copies*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    typedef uint8x16_t vec_t;
+#else
+    typedef __m128i vec_t;
+#endif
+
+/*Integers which can be read and written at any address*/
+typedef uint64_t __attribute__((aligned(1), may_alias)) u64_unaligned_t;
+typedef uint32_t __attribute__((aligned(1), may_alias)) u32_unaligned_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static inline void copy_small(uint8_t * d, const uint8_t * s, size_t len);
+static inline void set_small(uint8_t * d, uint8_t v, size_t len);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool _lv_mem_simd_supported(void)
+{
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#if defined(__linux__) && !defined(__aarch64__)
+    return (getauxval(AT_HWCAP) & HWCAP_NEON) != 0;
+#else
+    return true;    /*Always available on AArch64, elsewhere trust the compiler flags*/
+#endif
+#else
+#if defined(__x86_64__)
+    return true;    /*Part of x86-64*/
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+#endif
+#endif
+}
+
+const char * _lv_mem_simd_name(void)
+{
+    return SIMD_NAME;
+}
+
+void * _lv_memcpy_simd(void * dst, const void * src, size_t len)
+{
+    uint8_t * d = dst;
+    const uint8_t * s = src;
+
+    /*Up to 64 bytes copy the beginning and the end with overlapping vectors, without loops*/
+    if(len < 16) {
+        copy_small(d, s, len);
+        return dst;
+    }
+    if(len <= 32) {
+        vec_t v0 = VEC_LOAD(s);
+        vec_t v1 = VEC_LOAD(s + len - 16);
+        VEC_STORE(d, v0);
+        VEC_STORE(d + len - 16, v1);
+        return dst;
+    }
+    if(len <= 64) {
+        vec_t v0 = VEC_LOAD(s);
+        vec_t v1 = VEC_LOAD(s + 16);
+        vec_t v2 = VEC_LOAD(s + len - 32);
+        vec_t v3 = VEC_LOAD(s + len - 16);
+        VEC_STORE(d, v0);
+        VEC_STORE(d + 16, v1);
+        VEC_STORE(d + len - 32, v2);
+        VEC_STORE(d + len - 16, v3);
+        return dst;
+    }
+
+    /*Write the first 16 bytes unaligned and continue from the next 16 byte aligned address of `dst`*/
+    VEC_STORE(d, VEC_LOAD(s));
+    size_t head = 16 - ((uintptr_t)d & 0xF);
+    d += head;
+    s += head;
+    len -= head;
+
+    if(len >= LV_MEMCPY_SIMD_NT_SIZE) {
+        /*Too large to fit into the cache: bypass it*/
+        while(len >= 64) {
+            __builtin_prefetch(s + PREFETCH_DIST);
+            vec_t v0 = VEC_LOAD(s);
+            vec_t v1 = VEC_LOAD(s + 16);
+            vec_t v2 = VEC_LOAD(s + 32);
+            vec_t v3 = VEC_LOAD(s + 48);
+            VEC_STORE_NT(d, v0);
+            VEC_STORE_NT(d + 16, v1);
+            VEC_STORE_NT(d + 32, v2);
+            VEC_STORE_NT(d + 48, v3);
+            d += 64;
+            s += 64;
+            len -= 64;
+        }
+        VEC_NT_FENCE();
+    }
+    else {
+        while(len >= 64) {
+            vec_t v0 = VEC_LOAD(s);
+            vec_t v1 = VEC_LOAD(s + 16);
+            vec_t v2 = VEC_LOAD(s + 32);
+            vec_t v3 = VEC_LOAD(s + 48);
+            VEC_STORE(d, v0);
+            VEC_STORE(d + 16, v1);
+            VEC_STORE(d + 32, v2);
+            VEC_STORE(d + 48, v3);
+            d += 64;
+            s += 64;
+            len -= 64;
+        }
+    }
+
+    while(len >= 16) {
+        VEC_STORE(d, VEC_LOAD(s));
+        d += 16;
+        s += 16;
+        len -= 16;
+    }
+
+    /*Copy the last 16 bytes again overlapping the already copied ones. At least 64 bytes were copied before.*/
+    if(len) VEC_STORE(d + len - 16, VEC_LOAD(s + len - 16));
+
+    return dst;
+}
+
+void _lv_memset_simd(void * dst, uint8_t v, size_t len)
+{
+    uint8_t * d = dst;
+
+    if(len < 16) {
+        set_small(d, v, len);
+        return;
+    }
+
+    vec_t vv = VEC_SPLAT(v);
+    if(len <= 32) {
+        VEC_STORE(d, vv);
+        VEC_STORE(d + len - 16, vv);
+        return;
+    }
+    if(len <= 64) {
+        VEC_STORE(d, vv);
+        VEC_STORE(d + 16, vv);
+        VEC_STORE(d + len - 32, vv);
+        VEC_STORE(d + len - 16, vv);
+        return;
+    }
+
+    /*Write the first 16 bytes unaligned and continue from the next 16 byte aligned address*/
+    VEC_STORE(d, vv);
+    size_t head = 16 - ((uintptr_t)d & 0xF);
+    d += head;
+    len -= head;
+
+    if(len >= LV_MEMCPY_SIMD_NT_SIZE) {
+        while(len >= 64) {
+            VEC_STORE_NT(d, vv);
+            VEC_STORE_NT(d + 16, vv);
+            VEC_STORE_NT(d + 32, vv);
+            VEC_STORE_NT(d + 48, vv);
+            d += 64;
+            len -= 64;
+        }
+        VEC_NT_FENCE();
+    }
+    else {
+        while(len >= 64) {
+            VEC_STORE(d, vv);
+            VEC_STORE(d + 16, vv);
+            VEC_STORE(d + 32, vv);
+            VEC_STORE(d + 48, vv);
+            d += 64;
+            len -= 64;
+        }
+    }
+
+    while(len >= 16) {
+        VEC_STORE(d, vv);
+        d += 16;
+        len -= 16;
+    }
+
+    if(len) VEC_STORE(d + len - 16, vv);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Copy less than 16 bytes with two overlapping (possibly unaligned) reads and writes
+ */
+static inline void copy_small(uint8_t * d, const uint8_t * s, size_t len)
+{
+    if(len >= 8) {
+        uint64_t v0 = *(const u64_unaligned_t *)s;
+        uint64_t v1 = *(const u64_unaligned_t *)(s + len - 8);
+        *(u64_unaligned_t *)d = v0;
+        *(u64_unaligned_t *)(d + len - 8) = v1;
+    }
+    else if(len >= 4) {
+        uint32_t v0 = *(const u32_unaligned_t *)s;
+        uint32_t v1 = *(const u32_unaligned_t *)(s + len - 4);
+        *(u32_unaligned_t *)d = v0;
+        *(u32_unaligned_t *)(d + len - 4) = v1;
+    }
+    else if(len) {
+        /*1..3 bytes*/
+        uint8_t b0 = s[0];
+        uint8_t b1 = s[len / 2];
+        uint8_t b2 = s[len - 1];
+        d[0] = b0;
+        d[len / 2] = b1;
+        d[len - 1] = b2;
+    }
+}
+
+/**
+ * Set less than 16 bytes with two overlapping (possibly unaligned) writes
+ */
+static inline void set_small(uint8_t * d, uint8_t v, size_t len)
+{
+    if(len >= 8) {
+        uint64_t v64 = v * 0x0101010101010101ULL;
+        *(u64_unaligned_t *)d = v64;
+        *(u64_unaligned_t *)(d + len - 8) = v64;
+    }
+    else if(len >= 4) {
+        uint32_t v32 = v * 0x01010101U;
+        *(u32_unaligned_t *)d = v32;
+        *(u32_unaligned_t *)(d + len - 4) = v32;
+    }
+    else if(len) {
+        d[0] = v;
+        d[len / 2] = v;
+        d[len - 1] = v;
+    }
+}
+
+#endif /*_LV_MEM_SIMD*/
@@ -0,0 +1,73 @@
+/**
+ * @file lv_mem_simd.h
+ * `memcpy` and `memset` with NEON or SSE2. Used by `lv_memcpy` and `lv_memset`.
+ */
+
+#ifndef LV_MEM_SIMD_H
+#define LV_MEM_SIMD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/*1: a SIMD implementation is compiled in*/
+#if LV_USE_MEMCPY_SIMD && LV_MEMCPY_MEMSET_STD == 0 && \
+    (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(__SSE2__))
+    #define _LV_MEM_SIMD    1
+#else
+    #define _LV_MEM_SIMD    0
+#endif
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+#if _LV_MEM_SIMD
+
+/**
+ * Check if the CPU running the program supports the compiled in SIMD instructions
+ * @return true: `_lv_memcpy_simd` and `_lv_memset_simd` can be used
+ */
+bool _lv_mem_simd_supported(void);
+
+/**
+ * Name of the compiled in SIMD instruction set
+ * @return "NEON" or "SSE2"
+ */
+const char * _lv_mem_simd_name(void);
+
+/**
+ * `memcpy` with 16 byte vectors. The source and destination must not overlap.
+ * @param dst pointer to the destination buffer
+ * @param src pointer to the source buffer
+ * @param len number of byte to copy
+ * @return `dst`
+ */
+void * _lv_memcpy_simd(void * dst, const void * src, size_t len);
+
+/**
+ * `memset` with 16 byte vectors
+ * @param dst pointer to the destination buffer
+ * @param v value to set [0..255]
+ * @param len number of byte to set
+ */
+void _lv_memset_simd(void * dst, uint8_t v, size_t len);
+
+#endif /*_LV_MEM_SIMD*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_MEM_SIMD_H*/
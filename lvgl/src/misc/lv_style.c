@@ -19,10 +19,15 @@
 /**********************
  *      TYPEDEFS
  **********************/
+typedef struct {
+    lv_style_t style;       /*Constant style pointing to a copy of the properties*/
+    uint32_t hash;
+} shared_style_t;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static uintptr_t get_value_key(lv_style_prop_t prop, lv_style_value_t value);
 
 static void lv_style_set_prop_internal(lv_style_t * style, lv_style_prop_t prop_and_meta, lv_style_value_t value,
                                        void (*value_adjustment_helper)(lv_style_prop_t, lv_style_value_t, uint16_t *, lv_style_value_t *));
@@ -139,6 +144,7 @@ uint32_t _lv_style_custom_prop_flag_lookup_table_size = 0;
 
 static uint16_t last_custom_prop_id = (uint16_t)_LV_STYLE_LAST_BUILT_IN_PROP;
 static const lv_style_value_t null_style_value = { .num = 0 };
+static uint32_t change_cnt;
 
 /**********************
  *      MACROS
@@ -171,6 +177,8 @@ void lv_style_reset(lv_style_t * style)
         return;
     }
 
+    change_cnt++;
+
     if(style->prop_cnt > 1) lv_mem_free(style->v_p.values_and_props);
     lv_memset_00(style, sizeof(lv_style_t));
 #if LV_USE_ASSERT_STYLE
@@ -230,6 +238,8 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
 
     if(style->prop_cnt == 0)  return false;
 
+    change_cnt++;
+
     if(style->prop_cnt == 1) {
         if(LV_STYLE_PROP_ID_MASK(style->prop1) == prop) {
             style->prop1 = LV_STYLE_PROP_INV;
@@ -378,6 +388,74 @@ uint8_t _lv_style_get_prop_group(lv_style_prop_t prop)
     return (uint8_t)group;
 }
 
+uint32_t _lv_style_get_change_cnt(void)
+{
+    return change_cnt;
+}
+
+void _lv_style_shared_init(void)
+{
+    _lv_ll_init(&LV_GC_ROOT(_lv_style_shared_ll), sizeof(shared_style_t));
+}
+
+lv_style_t * lv_style_get_shared(const lv_style_const_prop_t * props)
+{
+    uint32_t hash = 5381;
+    uint32_t cnt;
+    uint8_t has_group = 0;
+    for(cnt = 0; props[cnt].prop != LV_STYLE_PROP_INV; cnt++) {
+        hash = (hash * 33) ^ props[cnt].prop;
+        hash = (hash * 33) ^ (uint32_t)get_value_key(props[cnt].prop, props[cnt].value);
+        has_group |= 1 << _lv_style_get_prop_group(LV_STYLE_PROP_ID_MASK(props[cnt].prop));
+    }
+    LV_ASSERT_MSG(cnt <= UINT8_MAX, "Too many properties in a shared style");
+
+    shared_style_t * shared;
+    _LV_LL_READ(&LV_GC_ROOT(_lv_style_shared_ll), shared) {
+        if(shared->hash != hash || shared->style.prop_cnt != cnt) continue;
+
+        uint32_t i;
+        for(i = 0; i < cnt; i++) {
+            const lv_style_const_prop_t * p = &shared->style.v_p.const_props[i];
+            if(p->prop != props[i].prop) break;
+            if(get_value_key(p->prop, p->value) != get_value_key(props[i].prop, props[i].value)) break;
+        }
+        if(i == cnt) return &shared->style;
+    }
+
+    /*The shared styles are never freed, don't put them into the arena of a screen*/
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    lv_mem_arena_begin(NULL);
+#endif
+    lv_style_const_prop_t * props_copy = lv_mem_alloc((cnt + 1) * sizeof(lv_style_const_prop_t));
+    shared = props_copy ? _lv_ll_ins_head(&LV_GC_ROOT(_lv_style_shared_ll)) : NULL;
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    lv_mem_arena_end();
+#endif
+    LV_ASSERT_MALLOC(props_copy);
+    if(props_copy == NULL) return NULL;
+    lv_memcpy(props_copy, props, (cnt + 1) * sizeof(lv_style_const_prop_t));
+
+    LV_ASSERT_MALLOC(shared);
+    if(shared == NULL) {
+        lv_mem_free(props_copy);
+        return NULL;
+    }
+
+    /*The same as `LV_STYLE_CONST_INIT` but with the real groups to skip the style quickly*/
+    lv_memset_00(shared, sizeof(shared_style_t));
+#if LV_USE_ASSERT_STYLE
+    shared->style.sentinel = LV_STYLE_SENTINEL_VALUE;
+#endif
+    shared->style.v_p.const_props = props_copy;
+    shared->style.has_group = has_group;
+    shared->style.prop1 = LV_STYLE_PROP_ANY;
+    shared->style.prop_cnt = cnt;
+    shared->hash = hash;
+
+    return &shared->style;
+}
+
 uint8_t _lv_style_prop_lookup_flags(lv_style_prop_t prop)
 {
     extern const uint8_t _lv_style_builtin_prop_flag_lookup_table[];
@@ -397,6 +475,44 @@ uint8_t _lv_style_prop_lookup_flags(lv_style_prop_t prop)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get the meaningful part of a property's value to hash and compare it.
+ * The rest of the value's bytes might be uninitialized.
+ * @param prop      a style property with its meta flags
+ * @param value     the value of the property
+ * @return          the meaningful part of the value
+ */
+static uintptr_t get_value_key(lv_style_prop_t prop, lv_style_value_t value)
+{
+    if(prop & LV_STYLE_PROP_META_MASK) return 0;
+
+    switch(prop) {
+        case LV_STYLE_BG_COLOR:
+        case LV_STYLE_BG_GRAD_COLOR:
+        case LV_STYLE_BG_IMG_RECOLOR:
+        case LV_STYLE_BORDER_COLOR:
+        case LV_STYLE_SHADOW_COLOR:
+        case LV_STYLE_OUTLINE_COLOR:
+        case LV_STYLE_ARC_COLOR:
+        case LV_STYLE_LINE_COLOR:
+        case LV_STYLE_TEXT_COLOR:
+        case LV_STYLE_IMG_RECOLOR:
+            return value.color.full;
+        case LV_STYLE_BG_GRAD:
+        case LV_STYLE_BG_IMG_SRC:
+        case LV_STYLE_ARC_IMG_SRC:
+        case LV_STYLE_TEXT_FONT:
+        case LV_STYLE_COLOR_FILTER_DSC:
+        case LV_STYLE_ANIM:
+        case LV_STYLE_TRANSITION:
+            return (uintptr_t)value.ptr;
+        default:
+            /*The type of the custom properties is unknown so use the widest field*/
+            if(prop >= _LV_STYLE_LAST_BUILT_IN_PROP) return (uintptr_t)value.ptr;
+            return (uint32_t)value.num;
+    }
+}
+
 static void lv_style_set_prop_helper(lv_style_prop_t prop, lv_style_value_t value, uint16_t * prop_storage,
                                      lv_style_value_t * value_storage)
 {
@@ -422,6 +538,8 @@ static void lv_style_set_prop_internal(lv_style_t * style, lv_style_prop_t prop_
         return;
     }
 
+    change_cnt++;
+
     lv_style_prop_t prop_id = LV_STYLE_PROP_ID_MASK(prop_and_meta);
 
     if(style->prop_cnt > 1) {
@@ -502,6 +502,22 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
  */
 bool lv_style_is_empty(const lv_style_t * style);
 
+/**
+ * Get a constant style with the given properties.
+ * Styles with equal properties are shared: the first call allocates the style and copies the properties,
+ * the later calls with the same properties return the same style. The shared styles are never freed.
+ * @param props     array of properties closed by an element with `LV_STYLE_PROP_INV` property.
+ *                  It can be a temporary array.
+ * @return          pointer to the shared style. It can't be modified.
+ * @example
+ * lv_obj_add_style(btn, lv_style_get_shared((lv_style_const_prop_t []) {
+ *                      LV_STYLE_CONST_BG_COLOR(lv_color_hex(0x3498DB)),
+ *                      LV_STYLE_CONST_RADIUS(5),
+ *                      {.prop = LV_STYLE_PROP_INV}
+ *                  }), LV_PART_MAIN);
+ */
+lv_style_t * lv_style_get_shared(const lv_style_const_prop_t * props);
+
 /**
  * Tell the group of a property. If the a property from a group is set in a style the (1 << group) bit of style->has_group is set.
  * It allows early skipping the style if the property is not exists in the style at all.
@@ -510,6 +526,18 @@ bool lv_style_is_empty(const lv_style_t * style);
  */
 uint8_t _lv_style_get_prop_group(lv_style_prop_t prop);
 
+/**
+ * Get a counter which is incremented when a property of any style is set or removed, or a style is reset.
+ * It tells if the values read from the styles earlier might be outdated.
+ * @return the change counter
+ */
+uint32_t _lv_style_get_change_cnt(void);
+
+/**
+ * Initialize the list of the shared styles. Called by LVGL in `lv_init()`
+ */
+void _lv_style_shared_init(void);
+
 /**
  * Get the flags of a built-in or custom property.
  *
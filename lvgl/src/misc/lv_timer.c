@@ -18,6 +18,8 @@
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
 
+#define NOT_IN_HEAP UINT32_MAX
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -25,16 +27,32 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bool lv_timer_exec(lv_timer_t * timer);
-static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+static void lv_timer_exec(lv_timer_t * timer);
+static uint32_t lv_timer_time_remaining(lv_timer_t * timer, uint32_t now);
+static inline uint32_t timer_deadline(const lv_timer_t * timer);
+static inline bool timer_before(const lv_timer_t * a, const lv_timer_t * b);
+static bool heap_reserve(uint32_t cnt);
+static void heap_insert(lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_update(lv_timer_t * timer);
+static void heap_sift_up(uint32_t idx);
+static void heap_sift_down(uint32_t idx);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static bool lv_timer_run = false;
 static uint8_t idle_last = 0;
-static bool timer_deleted;
-static bool timer_created;
+
+/*The not paused timers in a binary min-heap ordered by their deadline.
+ *The array is `LV_GC_ROOT(_lv_timer_heap)`. While `lv_timer_handler` runs, the timers which
+ *already ran are stored right after the heap and they are put back only at the end.
+ *The array is grown when a timer is created, so it always has room for every timer
+ *and resuming a timer can't fail.*/
+static uint32_t heap_cnt;
+static uint32_t ran_cnt;
+static uint32_t heap_size;
+static uint32_t timer_cnt;
 
 /**********************
  *      MACROS
@@ -55,6 +73,11 @@ static bool timer_created;
 void _lv_timer_core_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_timer_ll), sizeof(lv_timer_t));
+    LV_GC_ROOT(_lv_timer_heap) = NULL;
+    heap_cnt = 0;
+    ran_cnt = 0;
+    heap_size = 0;
+    timer_cnt = 0;
 
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
@@ -95,41 +118,26 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    do {
-        timer_deleted             = false;
-        timer_created             = false;
-        LV_GC_ROOT(_lv_timer_act) = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-        while(LV_GC_ROOT(_lv_timer_act)) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), LV_GC_ROOT(_lv_timer_act));
-
-            if(lv_timer_exec(LV_GC_ROOT(_lv_timer_act))) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(timer_created || timer_deleted) {
-                    TIMER_TRACE("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            LV_GC_ROOT(_lv_timer_act) = next; /*Load the next timer*/
-        }
-    } while(LV_GC_ROOT(_lv_timer_act));
+    /*Run the expired timers in the order of their deadlines. The timers which ran are moved out
+     *of the heap for the rest of the call, so every timer runs at most once.*/
+    while(heap_cnt > 0) {
+        lv_timer_t * timer = LV_GC_ROOT(_lv_timer_heap)[0];
+        if((int32_t)(handler_start - timer_deadline(timer)) < 0) break;
 
-    uint32_t time_till_next = LV_NO_TIMER_READY;
-    next = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_till_next)
-                time_till_next = delay;
-        }
+        lv_timer_exec(timer);
+    }
 
-        next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), next); /*Find the next timer*/
+    /*Schedule the timers which ran. They are stored right after the heap.*/
+    while(ran_cnt > 0) {
+        ran_cnt--;
+        heap_cnt++;
+        heap_sift_up(heap_cnt - 1);
     }
 
+    /*The nearest deadline is at the top of the heap*/
+    uint32_t time_till_next = LV_NO_TIMER_READY;
+    if(heap_cnt > 0) time_till_next = lv_timer_time_remaining(LV_GC_ROOT(_lv_timer_heap)[0], lv_tick_get());
+
     busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(idle_period_start);
     if(idle_period_time >= IDLE_MEAS_PERIOD) {
@@ -162,15 +170,19 @@ lv_timer_t * lv_timer_create_basic(void)
  *                  the `func_name(object, callback, ...)` convention)
  * @param period call period in ms unit
  * @param user_data custom parameter
- * @return pointer to the new timer
+ * @return pointer to the new timer or NULL if out of memory
  */
 lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * user_data)
 {
     lv_timer_t * new_timer = NULL;
 
+    /*Be sure the new timer will fit into the heap*/
+    if(!heap_reserve(timer_cnt + 1)) return NULL;
+
     new_timer = _lv_ll_ins_head(&LV_GC_ROOT(_lv_timer_ll));
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
+    timer_cnt++;
 
     new_timer->period = period;
     new_timer->timer_cb = timer_xcb;
@@ -178,8 +190,9 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->paused = 0;
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
+    new_timer->heap_idx = NOT_IN_HEAP;
 
-    timer_created = true;
+    heap_insert(new_timer);
 
     return new_timer;
 }
@@ -201,7 +214,11 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 void lv_timer_del(lv_timer_t * timer)
 {
     _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), timer);
-    timer_deleted = true;
+    heap_remove(timer);
+    timer_cnt--;
+
+    /*Let `lv_timer_exec` know that the running timer was deleted*/
+    if(LV_GC_ROOT(_lv_timer_act) == timer) LV_GC_ROOT(_lv_timer_act) = NULL;
 
     lv_mem_free(timer);
 }
@@ -213,11 +230,13 @@ void lv_timer_del(lv_timer_t * timer)
 void lv_timer_pause(lv_timer_t * timer)
 {
     timer->paused = true;
+    heap_remove(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     timer->paused = false;
+    if(timer->heap_idx == NOT_IN_HEAP) heap_insert(timer);
 }
 
 /**
@@ -228,6 +247,7 @@ void lv_timer_resume(lv_timer_t * timer)
 void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     timer->period = period;
+    heap_update(timer);
 }
 
 /**
@@ -237,6 +257,7 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 void lv_timer_ready(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get() - timer->period - 1;
+    heap_update(timer);
 }
 
 /**
@@ -247,6 +268,9 @@ void lv_timer_ready(lv_timer_t * timer)
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     timer->repeat_count = repeat_count;
+
+    /*Let the next `lv_timer_handler` delete it*/
+    if(repeat_count == 0) lv_timer_ready(timer);
 }
 
 /**
@@ -257,6 +281,7 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 void lv_timer_reset(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get();
+    heap_update(timer);
 }
 
 /**
@@ -293,49 +318,200 @@ lv_timer_t * lv_timer_get_next(lv_timer_t * timer)
  **********************/
 
 /**
- * Execute timer if its remaining time is zero
+ * Execute an expired timer and schedule its next run
  * @param timer pointer to lv_timer
- * @return true: execute, false: not executed
  */
-static bool lv_timer_exec(lv_timer_t * timer)
+static void lv_timer_exec(lv_timer_t * timer)
 {
-    if(timer->paused) return false;
-
-    bool exec = false;
-    if(lv_timer_time_remaining(timer) == 0) {
-        /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
-        int32_t original_repeat_count = timer->repeat_count;
-        if(timer->repeat_count > 0) timer->repeat_count--;
-        timer->last_run = lv_tick_get();
-        TIMER_TRACE("calling timer callback: %p", *((void **)&timer->timer_cb));
-        if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
-        TIMER_TRACE("timer callback %p finished", *((void **)&timer->timer_cb));
-        LV_ASSERT_MEM_INTEGRITY();
-        exec = true;
-    }
+    /*Move the timer after the heap until the end of `lv_timer_handler`*/
+    heap_remove(timer);
+    LV_GC_ROOT(_lv_timer_heap)[heap_cnt + ran_cnt] = timer;
+    timer->heap_idx = heap_cnt + ran_cnt;
+    ran_cnt++;
+
+    /* Decrement the repeat count before executing the timer_cb.
+     * If the timer is deleted by the callback `if(timer->repeat_count == 0)` is not executed below*/
+    int32_t original_repeat_count = timer->repeat_count;
+    if(timer->repeat_count > 0) timer->repeat_count--;
+    timer->last_run = lv_tick_get();
 
-    if(timer_deleted == false) { /*The timer might be deleted by itself as well*/
+    LV_GC_ROOT(_lv_timer_act) = timer;
+    TIMER_TRACE("calling timer callback: %p", *((void **)&timer->timer_cb));
+    if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
+    TIMER_TRACE("timer callback %p finished", *((void **)&timer->timer_cb));
+    LV_ASSERT_MEM_INTEGRITY();
+
+    /*`lv_timer_del` clears `_lv_timer_act` if the timer deleted itself*/
+    if(LV_GC_ROOT(_lv_timer_act) == timer) {
+        LV_GC_ROOT(_lv_timer_act) = NULL;
         if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
             TIMER_TRACE("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
             lv_timer_del(timer);
         }
     }
-
-    return exec;
 }
 
 /**
  * Find out how much time remains before a timer must be run.
  * @param timer pointer to lv_timer
+ * @param now the current tick
  * @return the time remaining, or 0 if it needs to be run again
  */
-static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
+static uint32_t lv_timer_time_remaining(lv_timer_t * timer, uint32_t now)
+{
+    int32_t remaining = (int32_t)(timer_deadline(timer) - now);
+    return remaining > 0 ? (uint32_t)remaining : 0;
+}
+
+/**
+ * Get the tick when a timer expires.
+ * The deadlines are compared as signed differences to survive the tick overflow
+ * so periods longer than `INT32_MAX` ms are handled as `INT32_MAX`.
+ * @param timer pointer to lv_timer
+ * @return the tick of the next run
+ */
+static inline uint32_t timer_deadline(const lv_timer_t * timer)
+{
+    return timer->last_run + LV_MIN(timer->period, (uint32_t)INT32_MAX);
+}
+
+static inline bool timer_before(const lv_timer_t * a, const lv_timer_t * b)
+{
+    return (int32_t)(timer_deadline(a) - timer_deadline(b)) < 0;
+}
+
+/**
+ * Grow the array of the heap to hold at least `cnt` timers
+ * @param cnt       number of timers
+ * @return          false: out of memory
+ */
+static bool heap_reserve(uint32_t cnt)
+{
+    if(cnt <= heap_size) return true;
+
+    uint32_t new_size = heap_size ? heap_size * 2 : 16;
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    /*The heap lives as long as LVGL, don't put it into the arena of a screen*/
+    lv_mem_arena_begin(NULL);
+#endif
+    lv_timer_t ** new_heap = lv_mem_realloc(LV_GC_ROOT(_lv_timer_heap), new_size * sizeof(lv_timer_t *));
+#if LV_MEM_CUSTOM == 0 && LV_USE_MEM_ARENA
+    lv_mem_arena_end();
+#endif
+    LV_ASSERT_MALLOC(new_heap);
+    if(new_heap == NULL) return false;
+    LV_GC_ROOT(_lv_timer_heap) = new_heap;
+    heap_size = new_size;
+    return true;
+}
+
+/**
+ * Add a timer to the heap of the running timers
+ * @param timer pointer to lv_timer, not in the heap yet
+ */
+static void heap_insert(lv_timer_t * timer)
 {
-    /*Check if at least 'period' time elapsed*/
-    uint32_t elp = lv_tick_elaps(timer->last_run);
-    if(elp >= timer->period)
-        return 0;
-    return timer->period - elp;
+    /*`heap_reserve` in `lv_timer_create` made room for every timer*/
+    LV_ASSERT(heap_cnt + ran_cnt < heap_size);
+
+    /*Make room for the new timer by moving the first already ran timer to the end*/
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    if(ran_cnt > 0) {
+        heap[heap_cnt + ran_cnt] = heap[heap_cnt];
+        heap[heap_cnt + ran_cnt]->heap_idx = heap_cnt + ran_cnt;
+    }
+
+    heap[heap_cnt] = timer;
+    timer->heap_idx = heap_cnt;
+    heap_cnt++;
+    heap_sift_up(timer->heap_idx);
+}
+
+/**
+ * Remove a timer from the heap of the running timers
+ * @param timer pointer to lv_timer. Nothing happens if it's not in the heap.
+ */
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t idx = timer->heap_idx;
+    if(idx == NOT_IN_HEAP) return;
+    timer->heap_idx = NOT_IN_HEAP;
+
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+
+    /*An already ran timer: just fill its place with the last one*/
+    if(idx >= heap_cnt) {
+        ran_cnt--;
+        uint32_t last = heap_cnt + ran_cnt;
+        if(idx != last) {
+            heap[idx] = heap[last];
+            heap[idx]->heap_idx = idx;
+        }
+        return;
+    }
+
+    /*Move the last timer of the heap to the free place*/
+    heap_cnt--;
+    bool moved = idx != heap_cnt;
+    if(moved) {
+        heap[idx] = heap[heap_cnt];
+        heap[idx]->heap_idx = idx;
+    }
+
+    /*Keep the already ran timers right after the heap*/
+    if(ran_cnt > 0) {
+        heap[heap_cnt] = heap[heap_cnt + ran_cnt];
+        heap[heap_cnt]->heap_idx = heap_cnt;
+    }
+
+    /*Restore the heap order*/
+    if(moved) {
+        heap_sift_up(idx);
+        heap_sift_down(heap[idx]->heap_idx);
+    }
+}
+
+/**
+ * Restore the heap order after the deadline of a timer has changed
+ * @param timer pointer to lv_timer. Nothing happens if it's not in the heap.
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    /*The already ran timers are scheduled at the end of `lv_timer_handler`*/
+    if(timer->heap_idx == NOT_IN_HEAP || timer->heap_idx >= heap_cnt) return;
+
+    heap_sift_up(timer->heap_idx);
+    heap_sift_down(timer->heap_idx);
+}
+
+static void heap_sift_up(uint32_t idx)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[idx];
+    while(idx > 0) {
+        uint32_t parent = (idx - 1) / 2;
+        if(!timer_before(timer, heap[parent])) break;
+        heap[idx] = heap[parent];
+        heap[idx]->heap_idx = idx;
+        idx = parent;
+    }
+    heap[idx] = timer;
+    timer->heap_idx = idx;
+}
+
+static void heap_sift_down(uint32_t idx)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[idx];
+    while(1) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= heap_cnt) break;
+        if(child + 1 < heap_cnt && timer_before(heap[child + 1], heap[child])) child++;
+        if(!timer_before(heap[child], timer)) break;
+        heap[idx] = heap[child];
+        heap[idx]->heap_idx = idx;
+        idx = child;
+    }
+    heap[idx] = timer;
+    timer->heap_idx = idx;
 }
@@ -47,6 +47,7 @@ typedef struct _lv_timer_t {
     lv_timer_cb_t timer_cb; /**< Timer function*/
     void * user_data; /**< Custom user data*/
     int32_t repeat_count; /**< 1: One time;  -1 : infinity;  n>0: residual times*/
+    uint32_t heap_idx; /**< Index in the heap of the running timers. Used internally*/
     uint32_t paused : 1;
 } lv_timer_t;
 
@@ -63,7 +64,8 @@ void _lv_timer_core_init(void);
 
 /**
  * Call it periodically to handle lv_timers.
- * @return time till it needs to be run next (in ms)
+ * @return time till it needs to be run next (in ms), or `LV_NO_TIMER_READY` if all timers are paused.
+ *         The time is exact, the caller can sleep for this long unless something creates or resumes a timer.
  */
 uint32_t /* LV_ATTRIBUTE_TIMER_HANDLER */ lv_timer_handler(void);
 
@@ -101,7 +103,7 @@ lv_timer_t * lv_timer_create_basic(void);
  *                  the `func_name(object, callback, ...)` convention)
  * @param period call period in ms unit
  * @param user_data custom parameter
- * @return pointer to the new timer
+ * @return pointer to the new timer or NULL if out of memory
  */
 lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * user_data);
 
@@ -294,6 +294,14 @@ void lv_img_set_antialias(lv_obj_t * obj, bool antialias)
     lv_obj_invalidate(obj);
 }
 
+void lv_img_set_transform_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_img_t * img = (lv_img_t *)obj;
+    img->transform_cache = en ? 1 : 0;
+}
+
 void lv_img_set_size_mode(lv_obj_t * obj, lv_img_size_mode_t mode)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -371,6 +379,15 @@ bool lv_img_get_antialias(lv_obj_t * obj)
     return img->antialias ? true : false;
 }
 
+bool lv_img_get_transform_cache(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_img_t * img = (lv_img_t *)obj;
+
+    return img->transform_cache ? true : false;
+}
+
 lv_img_size_mode_t lv_img_get_size_mode(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -402,6 +419,7 @@ static void lv_img_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     img->pivot.x = 0;
     img->pivot.y = 0;
     img->obj_size_mode = LV_IMG_SIZE_MODE_VIRTUAL;
+    img->transform_cache = 0;
 
     lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_add_flag(obj, LV_OBJ_FLAG_ADV_HITTEST);
@@ -643,6 +661,7 @@ static void draw_img(lv_event_t * e)
                 img_dsc.pivot.x = img->pivot.x;
                 img_dsc.pivot.y = img->pivot.y;
                 img_dsc.antialias = img->antialias;
+                img_dsc.transform_cache = img->transform_cache;
 
                 lv_area_t img_clip_area;
                 img_clip_area.x1 = bg_coords.x1 + pleft;
@@ -50,6 +50,7 @@ typedef struct {
     uint8_t cf : 5;        /*Color format from `lv_img_color_format_t`*/
     uint8_t antialias : 1; /*Apply anti-aliasing in transformations (rotate, zoom)*/
     uint8_t obj_size_mode: 2; /*Image size mode when image size and object size is different.*/
+    uint8_t transform_cache : 1; /*Keep the transformed (rotated, zoomed) images in the transformation cache*/
 } lv_img_t;
 
 extern const lv_obj_class_t lv_img_class;
@@ -149,6 +150,18 @@ void lv_img_set_zoom(lv_obj_t * obj, uint16_t zoom);
  */
 void lv_img_set_antialias(lv_obj_t * obj, bool antialias);
 
+/**
+ * Enable/disable caching the transformed (rotated, zoomed) image.
+ * Useful if the image is periodically transformed to the same few angles (e.g. a clock hand)
+ * as the cached angles are simply copied instead of transformed again.
+ * Not worth it for images drawn only once or twice per angle (e.g. a second hand): they would
+ * evict the others, so the cache stops storing them after a few misses.
+ * Requires `LV_IMG_TRANSFORM_CACHE_SIZE > 0`.
+ * @param obj       pointer to an image object
+ * @param en        true: cache the transformed image; false: transform it on every draw
+ */
+void lv_img_set_transform_cache(lv_obj_t * obj, bool en);
+
 /**
  * Set the image object size mode.
  *
@@ -209,6 +222,13 @@ uint16_t lv_img_get_zoom(lv_obj_t * obj);
  */
 bool lv_img_get_antialias(lv_obj_t * obj);
 
+/**
+ * Get whether the transformed image is cached or not
+ * @param obj       pointer to an image object
+ * @return          true: the transformed image is cached; false: it's transformed on every draw
+ */
+bool lv_img_get_transform_cache(lv_obj_t * obj);
+
 /**
  * Get the size mode of the image
  * @param obj       pointer to an image object
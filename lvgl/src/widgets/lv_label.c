@@ -46,6 +46,7 @@ static void lv_label_revert_dots(lv_obj_t * label);
 static bool lv_label_set_dot_tmp(lv_obj_t * label, char * data, uint32_t len);
 static char * lv_label_get_dot_tmp(lv_obj_t * label);
 static void lv_label_dot_tmp_free(lv_obj_t * label);
+static lv_res_t text_copy_on_write(lv_label_t * label, size_t len, size_t size);
 static void set_ofs_x_anim(void * obj, int32_t v);
 static void set_ofs_y_anim(void * obj, int32_t v);
 
@@ -92,6 +93,12 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
     /*If text is NULL then just refresh with the current text*/
     if(text == NULL) text = label->text;
 
+    /*Keep a static text static, it's copied only when modified*/
+    if(label->text == text && label->static_txt != 0) {
+        lv_label_refr_text(obj);
+        return;
+    }
+
     if(label->text == text && label->static_txt == 0) {
         /*If set its own text then reallocate it (maybe its size changed)*/
 #if LV_USE_ARABIC_PERSIAN_CHARS
@@ -642,18 +649,20 @@ void lv_label_ins_text(lv_obj_t * obj, uint32_t pos, const char * txt)
 
     lv_label_t * label = (lv_label_t *)obj;
 
-    /*Can not append to static text*/
-    if(label->static_txt != 0) return;
-
     lv_obj_invalidate(obj);
 
     /*Allocate space for the new text*/
     size_t old_len = strlen(label->text);
     size_t ins_len = strlen(txt);
     size_t new_len = ins_len + old_len;
-    label->text        = lv_mem_realloc(label->text, new_len + 1);
-    LV_ASSERT_MALLOC(label->text);
-    if(label->text == NULL) return;
+    if(label->static_txt != 0) {
+        if(text_copy_on_write(label, old_len + 1, new_len + 1) != LV_RES_OK) return;
+    }
+    else {
+        label->text = lv_mem_realloc(label->text, new_len + 1);
+        LV_ASSERT_MALLOC(label->text);
+        if(label->text == NULL) return;
+    }
 
     if(pos == LV_LABEL_POS_LAST) {
         pos = _lv_txt_get_encoded_length(label->text);
@@ -668,8 +677,10 @@ void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     lv_label_t * label = (lv_label_t *)obj;
 
-    /*Can not append to static text*/
-    if(label->static_txt != 0) return;
+    if(label->static_txt != 0) {
+        size_t len = strlen(label->text) + 1;
+        if(text_copy_on_write(label, len, len) != LV_RES_OK) return;
+    }
 
     lv_obj_invalidate(obj);
 
@@ -1150,7 +1161,11 @@ static void lv_label_refr_text(lv_obj_t * obj)
                 }
             }
 
-            if(lv_label_set_dot_tmp(obj, &label->text[byte_id_ori], len)) {
+            /*Don't write the dots into a static text*/
+            if(label->static_txt != 0 && text_copy_on_write(label, txt_len + 1, txt_len + 1) != LV_RES_OK) {
+                label->dot_end = LV_LABEL_DOT_END_INV;
+            }
+            else if(lv_label_set_dot_tmp(obj, &label->text[byte_id_ori], len)) {
                 for(i = 0; i < LV_LABEL_DOT_NUM; i++) {
                     label->text[byte_id_ori + i] = '.';
                 }
@@ -1252,6 +1267,25 @@ static void lv_label_dot_tmp_free(lv_obj_t * obj)
     label->dot.tmp_ptr   = NULL;
 }
 
+/**
+ * Replace the static text of a label with an own copy to modify it (copy-on-write)
+ * @param label     pointer to a label object with static text
+ * @param len       length of the text including the closing '\0'
+ * @param size      size of the new buffer, at least `len`
+ * @return          LV_RES_OK: the label has its own text; LV_RES_INV: out of memory, the text is still static
+ */
+static lv_res_t text_copy_on_write(lv_label_t * label, size_t len, size_t size)
+{
+    char * own_txt = lv_mem_alloc(size);
+    LV_ASSERT_MALLOC(own_txt);
+    if(own_txt == NULL) return LV_RES_INV;
+
+    lv_memcpy(own_txt, label->text, len);
+    label->text = own_txt;
+    label->static_txt = 0;
+    return LV_RES_OK;
+}
+
 static void set_ofs_x_anim(void * obj, int32_t v)
 {
     lv_label_t * label = (lv_label_t *)obj;
@@ -111,6 +111,8 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...) LV_FORMAT_ATTR
 /**
  * Set a static text. It will not be saved by the label so the 'text' variable
  * has to be 'alive' while the label exists.
+ * The text is not modified by the label: `lv_label_ins_text` and `lv_label_cut_text`
+ * copy it first (copy-on-write).
  * @param obj           pointer to a label object
  * @param text          pointer to a text. NULL to refresh with the current text.
  */
@@ -216,7 +218,7 @@ uint32_t lv_label_get_text_selection_end(const lv_obj_t * obj);
  *====================*/
 
 /**
- * Insert a text to a label. The label text can not be static.
+ * Insert a text to a label. A static text is copied first.
  * @param obj       pointer to a label object
  * @param pos       character index to insert. Expressed in character index and not byte index.
  *                  0: before first char. LV_LABEL_POS_LAST: after last char.
@@ -225,7 +227,7 @@ uint32_t lv_label_get_text_selection_end(const lv_obj_t * obj);
 void lv_label_ins_text(lv_obj_t * obj, uint32_t pos, const char * txt);
 
 /**
- * Delete characters from a label. The label text can not be static.
+ * Delete characters from a label. A static text is copied first.
  * @param obj       pointer to a label object
  * @param pos       character index from where to cut. Expressed in character index and not byte index.
  *                  0: start in from of the first character
@@ -52,6 +52,7 @@ static void pwd_char_hider_anim(void * obj, int32_t x);
 static void pwd_char_hider_anim_ready(lv_anim_t * a);
 static void pwd_char_hider(lv_obj_t * obj);
 static bool char_is_accepted(lv_obj_t * obj, uint32_t c);
+static bool text_is_accepted(lv_obj_t * obj, const char * txt);
 static void start_cursor_blink(lv_obj_t * obj);
 static void refr_cursor_area(lv_obj_t * obj);
 static void update_cursor_position_on_click(lv_event_t * e);
@@ -71,6 +72,7 @@ const lv_obj_class_t lv_textarea_class = {
     .group_def = LV_OBJ_CLASS_GROUP_DEF_TRUE,
     .width_def = LV_DPI_DEF * 2,
     .height_def = LV_DPI_DEF,
+    .scroll_copy = 1,
     .instance_size = sizeof(lv_textarea_t),
     .base_class = &lv_obj_class
 };
@@ -222,13 +224,8 @@ void lv_textarea_del_char(lv_obj_t * obj)
     lv_res_t res = insert_handler(obj, del_buf);
     if(res != LV_RES_OK) return;
 
-    char * label_txt = lv_label_get_text(ta->label);
-
-    /*Delete a character*/
-    _lv_txt_cut(label_txt, ta->cursor.pos - 1, 1);
-
-    /*Refresh the label*/
-    lv_label_set_text(ta->label, label_txt);
+    /*Delete a character. A static text is copied first.*/
+    lv_label_cut_text(ta->label, ta->cursor.pos - 1, 1);
     lv_textarea_clear_selection(obj);
 
     /*If the textarea became empty, invalidate it to hide the placeholder*/
@@ -312,6 +309,31 @@ void lv_textarea_set_text(lv_obj_t * obj, const char * txt)
     lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
 }
 
+void lv_textarea_set_text_static(lv_obj_t * obj, const char * txt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(txt);
+
+    lv_textarea_t * ta = (lv_textarea_t *)obj;
+
+    /*The password mode keeps an own copy anyway and rejected characters need to be filtered out*/
+    if(ta->pwd_mode || !text_is_accepted(obj, txt)) {
+        lv_textarea_set_text(obj, txt);
+        return;
+    }
+
+    /*Clear the existing selection*/
+    lv_textarea_clear_selection(obj);
+
+    lv_label_set_text_static(ta->label, txt);
+    lv_textarea_set_cursor_pos(obj, LV_TEXTAREA_CURSOR_LAST);
+
+    /*If the textarea is empty, invalidate it to hide the placeholder*/
+    if(ta->placeholder_txt && txt[0] == '\0') lv_obj_invalidate(obj);
+
+    lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
+}
+
 void lv_textarea_set_placeholder_text(lv_obj_t * obj, const char * txt)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -901,6 +923,12 @@ static void lv_textarea_event(const lv_obj_class_t * class_p, lv_event_t * e)
             code == LV_EVENT_RELEASED) {
         update_cursor_position_on_click(e);
     }
+    else if(code == LV_EVENT_SCROLL) {
+        /*The placeholder is not scrolled so the moved pixels of it need to be redrawn*/
+        if(lv_textarea_get_text(obj)[0] == '\0' && lv_textarea_get_placeholder_text(obj)[0] != '\0') {
+            lv_obj_invalidate(obj);
+        }
+    }
     else if(code == LV_EVENT_DRAW_MAIN) {
         draw_placeholder(e);
     }
@@ -1024,6 +1052,39 @@ static bool char_is_accepted(lv_obj_t * obj, uint32_t c)
     return false; /*The character wasn't in the list*/
 }
 
+/**
+ * Check if `lv_textarea_set_text` would add all characters of a text
+ * @param obj   pointer to a text area object
+ * @param txt   the text to check
+ * @return      true: no character is filtered out (accepted characters, max length, one line mode)
+ */
+static bool text_is_accepted(lv_obj_t * obj, const char * txt)
+{
+    lv_textarea_t * ta = (lv_textarea_t *)obj;
+    bool check_chars = ta->accepted_chars != NULL && ta->accepted_chars[0] != '\0';
+    uint32_t cnt = 0;
+    uint32_t i = 0;
+
+    while(txt[i] != '\0') {
+        uint32_t c = _lv_txt_encoded_next(txt, &i);
+        cnt++;
+
+        if(ta->one_line && (c == '\n' || c == '\r')) return false;
+
+        if(check_chars) {
+            uint32_t j = 0;
+            uint32_t a = 0;
+            while(ta->accepted_chars[j] != '\0') {
+                a = _lv_txt_encoded_next(ta->accepted_chars, &j);
+                if(a == c) break;
+            }
+            if(a != c) return false;
+        }
+    }
+
+    return ta->max_length == 0 || cnt <= ta->max_length;
+}
+
 static void start_cursor_blink(lv_obj_t * obj)
 {
     lv_textarea_t * ta = (lv_textarea_t *)obj;
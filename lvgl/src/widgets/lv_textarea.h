@@ -125,6 +125,15 @@ void lv_textarea_del_char_forward(lv_obj_t * obj);
  */
 void lv_textarea_set_text(lv_obj_t * obj, const char * txt);
 
+/**
+ * Set a static text of a text area. It's not copied until the text is edited (copy-on-write)
+ * so `txt` has to be 'alive' and unchanged while the text area shows it.
+ * Copied like `lv_textarea_set_text` in password mode or if the accepted characters or max length filter it.
+ * @param obj       pointer to a text area object
+ * @param txt       pointer to the text
+ */
+void lv_textarea_set_text_static(lv_obj_t * obj, const char * txt);
+
 /**
  * Set the placeholder text of a text area
  * @param obj       pointer to a text area object
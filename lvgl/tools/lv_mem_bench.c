@@ -0,0 +1,143 @@
+/**
+ * @file lv_mem_bench.c
+ * Compare the implementations of `lv_memcpy` and `lv_memset`: LVGL's loops, the standard functions and SIMD.
+ * Usage: lv_mem_bench [total MB per measurement, default 64]
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lvgl.h"
+
+#if LV_MEMCPY_MEMSET_STD == 0 && LV_USE_MEMCPY_SIMD
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BUF_SIZE    (2 * 1024 * 1024 + 64)
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const size_t sizes[] = {8, 15, 32, 48, 64, 100, 256, 1024, 4096, 16 * 1024, 64 * 1024, 256 * 1024, 2 * 1024 * 1024};
+static const lv_memcpy_impl_t impls[] = {LV_MEMCPY_IMPL_LOOP, LV_MEMCPY_IMPL_STD, LV_MEMCPY_IMPL_SIMD};
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * Compare the current implementation with `memcpy`/`memset` on all sizes up to 300 bytes and all alignments
+ * @return true: no difference
+ */
+static bool check(uint8_t * dst, uint8_t * ref, const uint8_t * src)
+{
+    for(size_t len = 0; len < 300; len++) {
+        for(size_t da = 0; da < 16; da++) {
+            for(size_t sa = 0; sa < 16; sa++) {
+                memset(dst, 0x5a, 400);
+                memset(ref, 0x5a, 400);
+                lv_memcpy(dst + 32 + da, src + sa, len);
+                memcpy(ref + 32 + da, src + sa, len);
+                if(memcmp(dst, ref, 400)) return false;
+            }
+            lv_memset(dst + 32 + da, (uint8_t)len, len);
+            memset(ref + 32 + da, (uint8_t)len, len);
+            lv_memset_00(dst + 48 + da, len / 2);
+            memset(ref + 48 + da, 0x00, len / 2);
+            lv_memset_ff(dst + 64 + da, len / 3);
+            memset(ref + 64 + da, 0xFF, len / 3);
+            if(memcmp(dst, ref, 400)) return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Measure the speed of the current implementation
+ * @return MB/s
+ */
+static double bench(uint8_t * dst, const uint8_t * src, size_t len, size_t misalign, bool set, size_t total)
+{
+    size_t rep = total / len;
+    if(rep == 0) rep = 1;
+
+    double t = now_s();
+    for(size_t i = 0; i < rep; i++) {
+        if(set) lv_memset(dst + misalign, (uint8_t)i, len);
+        else lv_memcpy(dst + misalign, src + 3 * misalign, len);
+        __asm__ volatile("" ::: "memory");   /*Don't let the compiler drop or merge the calls*/
+    }
+    t = now_s() - t;
+
+    return (double)rep * len / t / (1024 * 1024);
+}
+
+int main(int argc, char * argv[])
+{
+    size_t total = (argc > 1 ? atoi(argv[1]) : 64) * 1024 * 1024;
+
+    lv_init();
+
+    uint8_t * src = malloc(BUF_SIZE);
+    uint8_t * dst = malloc(BUF_SIZE);
+    uint8_t * ref = malloc(BUF_SIZE);
+    if(src == NULL || dst == NULL || ref == NULL) {
+        printf("out of memory\n");
+        return 1;
+    }
+    for(size_t i = 0; i < BUF_SIZE; i++) src[i] = rand();
+    memset(dst, 0, BUF_SIZE);
+
+    printf("lv_memcpy default: %s\n\n", lv_memcpy_get_impl_name());
+    printf("%-8s %9s %9s", "", "size", "align");
+    for(size_t i = 0; i < sizeof(impls) / sizeof(impls[0]); i++) {
+        if(!lv_memcpy_set_impl(impls[i])) continue;
+        if(!check(dst, ref, src)) {
+            printf("\n%s: result differs from memcpy/memset\n", lv_memcpy_get_impl_name());
+            return 1;
+        }
+        printf(" %8s MB/s", lv_memcpy_get_impl_name());
+    }
+    printf("\n");
+
+    for(int set = 0; set <= 1; set++) {
+        for(size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            for(size_t misalign = 0; misalign <= 1; misalign++) {
+                printf("%-8s %9u %9s", set ? "memset" : "memcpy", (unsigned)sizes[s], misalign ? "unaligned" : "aligned");
+                for(size_t i = 0; i < sizeof(impls) / sizeof(impls[0]); i++) {
+                    if(!lv_memcpy_set_impl(impls[i])) continue;
+                    printf(" %13.0f", bench(dst, src, sizes[s], misalign, set, total));
+                }
+                printf("\n");
+            }
+        }
+    }
+
+    lv_memcpy_set_impl(LV_MEMCPY_IMPL_AUTO);
+    free(src);
+    free(dst);
+    free(ref);
+    return 0;
+}
+
+#else
+
+int main(void)
+{
+    printf("lv_mem_bench needs LV_MEMCPY_MEMSET_STD == 0 and LV_USE_MEMCPY_SIMD == 1\n");
+    return 0;
+}
+
+#endif
@@ -0,0 +1,1428 @@
+/**
+ * @file lv_perf_test.c
+ * Headless checks and timings of the rendering, style, timer and memory optimizations.
+ * Renders into a memory frame buffer, so it runs without a display.
+ * Usage: lv_perf_test [section ...]   (all sections by default)
+ * Returns 1 if a check fails.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "src/draw/sw/lv_draw_sw.h"
+#if LV_IMG_CACHE_ASYNC
+    #include <pthread.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES     480
+#define VER_RES     272
+
+/*Fail the current section if `expr` is false*/
+#define CHECK(expr)                                                         \
+    do {                                                                    \
+        if(!(expr)) {                                                       \
+            printf("  %s:%d: check failed: %s\n", __FILE__, __LINE__, #expr); \
+            return false;                                                   \
+        }                                                                   \
+    } while(0)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const char * name;
+    bool (*run)(void);
+} section_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_ARC
+    static bool test_arc(void);
+#endif
+#if LV_USE_REFR_OCCLUSION
+    static bool test_occlusion(void);
+#endif
+#if LV_USE_LIST && LV_USE_TEXTAREA
+    static bool test_scroll_copy(void);
+#endif
+#if LV_USE_LABEL
+    static bool test_style_cache(void);
+#endif
+static bool test_timer(void);
+#if LV_USE_FLEX
+    static bool test_refr_idle(void);
+    static bool test_layout(void);
+#endif
+#if LV_MEM_CUSTOM == 0
+    static bool test_mem(void);
+#endif
+#if LV_IMG_CACHE_DEF_SIZE
+    static bool test_img_cache(void);
+    static bool test_img_prefetch(void);
+#endif
+#if LV_IMG_CACHE_ASYNC && LV_USE_IMG
+    static bool test_img_async(void);
+#endif
+#if LV_IMG_TRANSFORM_CACHE_SIZE && LV_USE_IMG
+    static bool test_transform_cache(void);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_color_t fb[HOR_RES * VER_RES];
+static lv_color_t draw_buf[HOR_RES * VER_RES];
+static lv_color_t fb_saved[HOR_RES * VER_RES];
+static lv_disp_t * disp;
+static uint32_t flush_cnt;
+
+static const section_t sections[] = {
+#if LV_USE_ARC
+    {"arc", test_arc},
+#endif
+#if LV_USE_REFR_OCCLUSION
+    {"occlusion", test_occlusion},
+#endif
+#if LV_USE_LIST && LV_USE_TEXTAREA
+    {"scroll_copy", test_scroll_copy},
+#endif
+#if LV_USE_LABEL
+    {"style_cache", test_style_cache},
+#endif
+    {"timer", test_timer},
+#if LV_USE_FLEX
+    {"refr_idle", test_refr_idle},
+    {"layout", test_layout},
+#endif
+#if LV_MEM_CUSTOM == 0
+    {"mem", test_mem},
+#endif
+#if LV_IMG_CACHE_DEF_SIZE
+    {"img_cache", test_img_cache},
+    {"img_prefetch", test_img_prefetch},
+#endif
+#if LV_IMG_CACHE_ASYNC && LV_USE_IMG
+    {"img_async", test_img_async},
+#endif
+#if LV_IMG_TRANSFORM_CACHE_SIZE && LV_USE_IMG
+    {"transform_cache", test_transform_cache},
+#endif
+};
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        memcpy(&fb[y * HOR_RES + area->x1], color_p, w * sizeof(lv_color_t));
+        color_p += w;
+    }
+    flush_cnt++;
+    lv_disp_flush_ready(drv);
+}
+
+static void disp_init(void)
+{
+    static lv_disp_draw_buf_t disp_buf;
+    lv_disp_draw_buf_init(&disp_buf, draw_buf, NULL, HOR_RES * VER_RES);
+
+    static lv_disp_drv_t disp_drv;
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.draw_buf = &disp_buf;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.hor_res = HOR_RES;
+    disp_drv.ver_res = VER_RES;
+    disp = lv_disp_drv_register(&disp_drv);
+}
+
+/**
+ * Create a new, white screen and load it
+ */
+static lv_obj_t * scr_new(void)
+{
+    lv_obj_t * old = lv_scr_act();
+    lv_obj_t * scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+    lv_scr_load(scr);
+    lv_obj_del(old);
+    return scr;
+}
+
+/**
+ * Redraw the whole screen `cnt` times
+ * @return average time of a frame in ms
+ */
+static double render(uint32_t cnt)
+{
+    double t = now_ms();
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(disp);
+    }
+    return (now_ms() - t) / cnt;
+}
+
+/**
+ * Let the time pass and run the timers meanwhile
+ */
+static void wait_ms(uint32_t ms)
+{
+    double end = now_ms() + ms;
+    while(now_ms() < end) {
+        usleep(1000);
+#if LV_TICK_CUSTOM == 0
+        lv_tick_inc(1);
+#endif
+        lv_timer_handler();
+    }
+}
+
+static lv_color_t px(lv_coord_t x, lv_coord_t y)
+{
+    return fb[y * HOR_RES + x];
+}
+
+static bool area_eq(const lv_area_t * a1, const lv_area_t * a2)
+{
+    return a1->x1 == a2->x1 && a1->y1 == a2->y1 && a1->x2 == a2->x2 && a1->y2 == a2->y2;
+}
+
+/**
+ * Show/hide the performance and memory monitors (the labels on the system layer)
+ */
+static void monitors_show(bool en)
+{
+    /*The monitors are created by the first refresh*/
+    lv_refr_now(disp);
+
+    lv_obj_t * sys = lv_disp_get_layer_sys(disp);
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(sys); i++) {
+        if(en) lv_obj_clear_flag(lv_obj_get_child(sys, i), LV_OBJ_FLAG_HIDDEN);
+        else lv_obj_add_flag(lv_obj_get_child(sys, i), LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+#if LV_USE_ARC
+
+static lv_obj_t * arc_create(lv_obj_t * parent, lv_coord_t size, lv_coord_t width)
+{
+    lv_obj_t * arc = lv_arc_create(parent);
+    lv_obj_remove_style_all(arc);
+    lv_obj_set_size(arc, size, size);
+    lv_obj_set_style_arc_width(arc, width, LV_PART_MAIN);
+    lv_obj_set_style_arc_color(arc, lv_color_black(), LV_PART_MAIN);
+    lv_obj_set_style_arc_width(arc, width, LV_PART_INDICATOR);
+    lv_obj_set_style_arc_color(arc, lv_palette_main(LV_PALETTE_RED), LV_PART_INDICATOR);
+    lv_obj_set_style_arc_opa(arc, LV_OPA_COVER, LV_PART_MAIN);
+    lv_obj_set_style_arc_opa(arc, LV_OPA_COVER, LV_PART_INDICATOR);
+    return arc;
+}
+
+/**
+ * Draw `cnt` concentric arcs per frame with changing angles
+ * @return average time of a frame in ms
+ */
+static double arc_frames(lv_obj_t * scr, lv_coord_t base_size, uint32_t cnt, uint32_t frames)
+{
+    lv_obj_clean(scr);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * arc = arc_create(scr, base_size + i * 20, 6);
+        lv_obj_center(arc);
+    }
+
+    double t = 0;
+    uint32_t f;
+    for(f = 0; f < frames; f++) {
+        for(i = 0; i < cnt; i++) lv_arc_set_angles(lv_obj_get_child(scr, i), 0, (f * 7 + i * 40) % 360);
+        t += render(1);
+    }
+    return t / frames;
+}
+
+/**
+ * Time an arc scene drawn the generic way and from the ring cache
+ */
+static void arc_bench(const char * name, lv_obj_t * scr, lv_coord_t base_size, uint32_t cnt, uint32_t frames)
+{
+#if LV_DRAW_COMPLEX && LV_ARC_RING_CACHE_SIZE
+    lv_draw_sw_arc_set_ring_cache(false);
+    double t_generic = arc_frames(scr, base_size, cnt, frames);
+    lv_draw_sw_arc_set_ring_cache(true);
+    double t_ring = arc_frames(scr, base_size, cnt, frames);
+    printf("  %s: %.2f ms/frame generic, %.2f ms/frame ring cache\n", name, t_generic, t_ring);
+#else
+    printf("  %s: %.2f ms/frame\n", name, arc_frames(scr, base_size, cnt, frames));
+#endif
+}
+
+/**
+ * Full rings must be symmetric: they are drawn from one cached quarter.
+ * Also time the arc scenes with and without the ring cache; switching to a new set of rings
+ * after a long used one shows whether the ring cache ages out the old entries.
+ */
+static bool test_arc(void)
+{
+    lv_obj_t * scr = scr_new();
+    lv_obj_t * arc = arc_create(scr, 101, 13);
+    lv_arc_set_bg_angles(arc, 0, 360);
+    lv_obj_set_style_arc_opa(arc, LV_OPA_TRANSP, LV_PART_INDICATOR);
+    lv_obj_center(arc);
+    render(1);
+
+    /*Bounding box of the drawn pixels*/
+    lv_coord_t x1 = HOR_RES, y1 = VER_RES, x2 = -1, y2 = -1;
+    lv_coord_t x, y;
+    for(y = 0; y < VER_RES; y++) {
+        for(x = 0; x < HOR_RES; x++) {
+            if(px(x, y).full == lv_color_white().full) continue;
+            if(x < x1) x1 = x;
+            if(x > x2) x2 = x;
+            if(y < y1) y1 = y;
+            if(y > y2) y2 = y;
+        }
+    }
+    CHECK(x2 > x1 && y2 > y1);
+    CHECK(px((x1 + x2) / 2, (y1 + y2) / 2).full == lv_color_white().full);
+    CHECK(px((x1 + x2) / 2, y1 + 6).full == lv_color_black().full);
+    for(y = y1; y <= y2; y++) {
+        for(x = x1; x <= x2; x++) {
+            CHECK(px(x, y).full == px(x2 - (x - x1), y).full);
+            CHECK(px(x, y).full == px(x, y2 - (y - y1)).full);
+        }
+    }
+
+    arc_bench("8 arcs", scr, 100, 8, 200);
+    arc_bench("8 other arcs after them", scr, 110, 8, 200);
+    arc_bench("12 arcs", scr, 30, 12, 100);
+    return true;
+}
+
+#endif /*LV_USE_ARC*/
+
+#if LV_USE_REFR_OCCLUSION
+
+static struct {
+    uint32_t begin_cnt;
+    uint32_t main_cnt;
+    uint32_t end_cnt;
+    lv_area_t begin_clip;
+    lv_area_t end_clip;
+} draw_cnt;
+
+static void draw_cnt_reset(void)
+{
+    lv_memset_00(&draw_cnt, sizeof(draw_cnt));
+}
+
+static void draw_cnt_event_cb(const lv_obj_class_t * class_p, lv_event_t * e);
+
+/*A plain object which counts its main draw events in its class handler,
+ *so it has no user draw callbacks which would turn off the occlusion culling*/
+static const lv_obj_class_t draw_cnt_class = {
+    .base_class = &lv_obj_class,
+    .event_cb = draw_cnt_event_cb,
+    .instance_size = sizeof(lv_obj_t),
+};
+
+static void draw_cnt_event_cb(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+    if(lv_obj_event_base(&draw_cnt_class, e) != LV_RES_OK) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    if(code == LV_EVENT_DRAW_MAIN_BEGIN) {
+        draw_cnt.begin_cnt++;
+        draw_cnt.begin_clip = *lv_event_get_draw_ctx(e)->clip_area;
+    }
+    else if(code == LV_EVENT_DRAW_MAIN) {
+        draw_cnt.main_cnt++;
+    }
+    else if(code == LV_EVENT_DRAW_MAIN_END) {
+        draw_cnt.end_cnt++;
+        draw_cnt.end_clip = *lv_event_get_draw_ctx(e)->clip_area;
+    }
+}
+
+static void draw_main_user_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_cnt.main_cnt++;
+}
+
+static lv_obj_t * rect_create(const lv_obj_class_t * class_p, lv_obj_t * parent, lv_coord_t x, lv_coord_t y,
+                              lv_coord_t w, lv_coord_t h, lv_color_t color)
+{
+    lv_obj_t * obj = lv_obj_class_create_obj(class_p, parent);
+    lv_obj_class_init_obj(obj);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_color(obj, color, 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    return obj;
+}
+
+/**
+ * The parts of a parent covered by its opaque children aren't drawn, but the parent still gets
+ * `LV_EVENT_DRAW_MAIN_BEGIN/END` exactly once with its whole clip area.
+ * Also time a stack of full screen panels.
+ */
+static bool test_occlusion(void)
+{
+    lv_obj_t * scr = scr_new();
+    lv_obj_t * parent = rect_create(&draw_cnt_class, scr, 20, 20, 200, 200, lv_palette_main(LV_PALETTE_RED));
+    lv_obj_t * child = rect_create(&lv_obj_class, parent, 50, 50, 100, 100, lv_palette_main(LV_PALETTE_BLUE));
+
+    /*A hole in the middle: the main drawing is split into the 4 strips around it*/
+    draw_cnt_reset();
+    render(1);
+    CHECK(draw_cnt.begin_cnt == 1 && draw_cnt.end_cnt == 1);
+    CHECK(draw_cnt.main_cnt == 4);
+    CHECK(area_eq(&draw_cnt.begin_clip, &parent->coords));
+    CHECK(area_eq(&draw_cnt.end_clip, &parent->coords));
+    CHECK(px(30, 30).full == lv_palette_main(LV_PALETTE_RED).full);
+    CHECK(px(219, 219).full == lv_palette_main(LV_PALETTE_RED).full);
+    CHECK(px(120, 120).full == lv_palette_main(LV_PALETTE_BLUE).full);
+
+    /*Fully covered: no main drawing but still a begin and an end*/
+    lv_obj_set_pos(child, 0, 0);
+    lv_obj_set_size(child, 200, 200);
+    draw_cnt_reset();
+    render(1);
+    CHECK(draw_cnt.begin_cnt == 1 && draw_cnt.end_cnt == 1);
+    CHECK(draw_cnt.main_cnt == 0);
+    CHECK(px(30, 30).full == lv_palette_main(LV_PALETTE_BLUE).full);
+
+    /*A user draw callback turns off the culling of the object*/
+    lv_obj_add_event_cb(parent, draw_main_user_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_set_pos(child, 50, 50);
+    lv_obj_set_size(child, 100, 100);
+    draw_cnt_reset();
+    render(1);
+    CHECK(draw_cnt.begin_cnt == 1 && draw_cnt.end_cnt == 1);
+    CHECK(draw_cnt.main_cnt == 2);     /*Once by the class and once by the user callback*/
+
+    /*Stacked full screen panels: only the top one should be drawn*/
+    lv_obj_clean(scr);
+    uint32_t i;
+    lv_obj_t * p = scr;
+    for(i = 0; i < 6; i++) {
+        p = rect_create(&lv_obj_class, p, 0, 0, HOR_RES, VER_RES, lv_color_make(i * 40, 0, 0));
+        lv_obj_t * btn = lv_btn_create(p);
+        lv_obj_set_pos(btn, 20 + i * 30, 20 + i * 30);
+    }
+    printf("  6 stacked panels: %.2f ms/frame\n", render(100));
+    return true;
+}
+
+#endif /*LV_USE_REFR_OCCLUSION*/
+
+#if LV_USE_LIST && LV_USE_TEXTAREA
+
+static uint32_t copy_cnt;
+
+/*Move the pixels in the frame buffer like a display driver with a persistent frame buffer*/
+static bool copy_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy)
+{
+    LV_UNUSED(drv);
+    copy_cnt++;
+
+    lv_area_t dest = *area;
+    lv_area_move(&dest, dx, dy);
+    if(!_lv_area_intersect(&dest, &dest, area)) return true;
+
+    lv_coord_t w = lv_area_get_width(&dest);
+    lv_coord_t h = lv_area_get_height(&dest);
+    lv_coord_t i;
+    for(i = 0; i < h; i++) {
+        lv_coord_t y = dy > 0 ? dest.y2 - i : dest.y1 + i;
+        memmove(&fb[y * HOR_RES + dest.x1], &fb[(y - dy) * HOR_RES + dest.x1 - dx], w * sizeof(lv_color_t));
+    }
+    return true;
+}
+
+/**
+ * Refresh the invalidated areas, then compare the result with a full redraw
+ * @return true: the same pixels
+ */
+static bool refr_matches_full_redraw(void)
+{
+    lv_refr_now(disp);
+    memcpy(fb_saved, fb, sizeof(fb));
+    render(1);
+    return memcmp(fb_saved, fb, sizeof(fb)) == 0;
+}
+
+/**
+ * Scrolling by moving the rendered pixels must give the same result as redrawing everything,
+ * and must not be used where a parent's post drawn border is on the moved area.
+ */
+static bool test_scroll_copy(void)
+{
+    /*The monitors would be on the scrolled area which prevents copying*/
+    monitors_show(false);
+    lv_obj_t * scr = scr_new();
+    disp->driver->copy_cb = copy_cb;
+
+    lv_obj_t * list = lv_list_create(scr);
+    lv_obj_set_size(list, 220, VER_RES - 20);
+    lv_obj_set_pos(list, 10, 10);
+    uint32_t i;
+    for(i = 0; i < 40; i++) lv_list_add_btn(list, LV_SYMBOL_WIFI, "network");
+
+    lv_obj_t * ta = lv_textarea_create(scr);
+    lv_obj_set_size(ta, 200, 100);
+    lv_obj_set_pos(ta, 260, 10);
+    for(i = 0; i < 20; i++) lv_textarea_add_text(ta, "line of text\n");
+
+    lv_obj_t * ta_ph = lv_textarea_create(scr);
+    lv_obj_set_size(ta_ph, 200, 100);
+    lv_obj_set_pos(ta_ph, 260, 150);
+    lv_textarea_set_placeholder_text(ta_ph, "placeholder");
+
+    /*Stop the scroll to the cursor and the cursor blinking as they would change the
+     *text areas between the compared frames. Scroll to the cursor at the end without them.*/
+    lv_anim_del(ta, NULL);
+    lv_anim_del(ta_ph, NULL);
+    lv_obj_update_layout(scr);
+    lv_obj_scroll_by(ta, 0, -lv_obj_get_scroll_bottom(ta), LV_ANIM_OFF);
+    render(1);
+
+    static const lv_coord_t steps[] = {-7, -13, -40, 9, -100, 3, -1};
+    copy_cnt = 0;
+    for(i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+        lv_obj_scroll_by(list, 0, steps[i], LV_ANIM_OFF);
+        CHECK(refr_matches_full_redraw());
+    }
+    CHECK(copy_cnt == sizeof(steps) / sizeof(steps[0]));
+
+    lv_obj_scroll_by(ta, 0, -20, LV_ANIM_OFF);
+    CHECK(refr_matches_full_redraw());
+
+    /*The placeholder is not scrolled*/
+    lv_obj_scroll_by(ta_ph, 0, -10, LV_ANIM_OFF);
+    CHECK(refr_matches_full_redraw());
+
+    /*A parent's border drawn after the children is on the list's edge*/
+    lv_obj_t * frame = lv_obj_create(scr);
+    lv_obj_set_style_border_post(frame, true, 0);
+    lv_obj_set_style_border_width(frame, 6, 0);
+    lv_obj_set_style_pad_all(frame, 0, 0);
+    lv_obj_set_size(frame, 220, VER_RES - 20);
+    lv_obj_set_pos(frame, 10, 10);
+    lv_obj_clear_flag(frame, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_parent(list, frame);
+    lv_obj_set_pos(list, -6, -6);
+    render(1);
+    copy_cnt = 0;
+    lv_obj_scroll_by(list, 0, -15, LV_ANIM_OFF);
+    CHECK(refr_matches_full_redraw());
+    CHECK(copy_cnt == 0);
+
+    uint32_t frames = 50;
+    double t = now_ms();
+    for(i = 0; i < frames; i++) {
+        lv_obj_scroll_by(ta, 0, i < frames / 2 ? -4 : 4, LV_ANIM_OFF);
+        lv_refr_now(disp);
+    }
+    printf("  scroll a textarea by 4 px: %.2f ms/frame\n", (now_ms() - t) / frames);
+
+    disp->driver->copy_cb = NULL;
+    monitors_show(true);
+    return true;
+}
+
+#endif /*LV_USE_LIST && LV_USE_TEXTAREA*/
+
+#if LV_USE_LABEL
+
+/**
+ * Changing the style of an object must update its own and its descendants' values
+ * but keep the cached values of the other objects.
+ * Also time frames with a style changing on every frame.
+ */
+static bool test_style_cache(void)
+{
+    lv_obj_t * scr = scr_new();
+    lv_obj_t * cont = lv_obj_create(scr);
+    lv_obj_t * label = lv_label_create(cont);
+    lv_obj_t * other = lv_obj_create(scr);
+    lv_obj_t * leaf = lv_obj_create(scr);
+
+    /*Inherited by the descendants*/
+    lv_obj_set_style_text_color(cont, lv_color_hex(0x112233), 0);
+    CHECK(lv_obj_get_style_text_color(label, 0).full == lv_color_hex(0x112233).full);
+    lv_obj_set_style_text_color(cont, lv_color_hex(0x445566), 0);
+    CHECK(lv_obj_get_style_text_color(label, 0).full == lv_color_hex(0x445566).full);
+
+    /*The other parts fall back to the main part's inherited values*/
+    lv_color_t c = lv_obj_get_style_text_color(leaf, LV_PART_SCROLLBAR);
+    lv_obj_set_style_text_color(leaf, lv_color_hex(0x778899), 0);
+    CHECK(c.full != lv_color_hex(0x778899).full);
+    CHECK(lv_obj_get_style_text_color(leaf, LV_PART_SCROLLBAR).full == lv_color_hex(0x778899).full);
+
+    /*The parent's state can change the inherited values*/
+    lv_obj_set_style_text_color(cont, lv_color_hex(0xaabbcc), LV_STATE_CHECKED);
+    lv_obj_add_state(cont, LV_STATE_CHECKED);
+    CHECK(lv_obj_get_style_text_color(label, 0).full == lv_color_hex(0xaabbcc).full);
+
+    /*A moved object inherits from its new parent*/
+    lv_obj_set_parent(label, other);
+    CHECK(lv_obj_get_style_text_color(label, 0).full != lv_color_hex(0xaabbcc).full);
+
+    /*Local style changes of a leaf keep the values of the other objects*/
+    lv_obj_set_style_bg_opa(other, LV_OPA_50, 0);
+    CHECK(lv_obj_get_style_bg_opa(other, 0) == LV_OPA_50);
+    lv_obj_get_style_radius(other, 0);
+#if LV_USE_STYLE_CACHE
+    lv_obj_style_cache_info_t info1;
+    lv_obj_style_cache_info_t info2;
+    lv_obj_get_style_cache_info(&info1);
+#endif
+    lv_obj_set_style_bg_opa(leaf, LV_OPA_40, 0);
+    CHECK(lv_obj_get_style_bg_opa(leaf, 0) == LV_OPA_40);
+    CHECK(lv_obj_get_style_bg_opa(other, 0) == LV_OPA_50);
+    lv_obj_get_style_radius(other, 0);
+#if LV_USE_STYLE_CACHE
+    lv_obj_get_style_cache_info(&info2);
+    CHECK(info2.invalidate_cnt == info1.invalidate_cnt);
+    CHECK(info2.hit_cnt - info1.hit_cnt == 2);
+#endif
+
+    /*A screen of widgets with one of them animated*/
+    lv_obj_clean(scr);
+    uint32_t i;
+    for(i = 0; i < 24; i++) {
+        lv_obj_t * btn = lv_btn_create(scr);
+        lv_obj_set_pos(btn, (i % 6) * 78 + 4, (i / 6) * 66 + 4);
+        lv_obj_set_size(btn, 72, 60);
+        lv_label_set_text(lv_label_create(btn), "Button");
+    }
+    lv_obj_t * anim_obj = lv_obj_get_child(scr, 0);
+#if LV_USE_STYLE_CACHE
+    lv_obj_get_style_cache_info(&info1);
+#endif
+    uint32_t frames = 100;
+    double t = 0;
+    for(i = 0; i < frames; i++) {
+        lv_obj_set_style_bg_opa(anim_obj, i % 256, 0);
+        t += render(1);
+    }
+    printf("  24 buttons, one with changing opacity: %.2f ms/frame\n", t / frames);
+#if LV_USE_STYLE_CACHE
+    lv_obj_get_style_cache_info(&info2);
+    uint32_t hit = info2.hit_cnt - info1.hit_cnt;
+    uint32_t miss = info2.miss_cnt - info1.miss_cnt;
+    printf("  hit rate: %u%%, full invalidations: %u\n", (unsigned)(hit * 100 / (hit + miss)),
+           (unsigned)(info2.invalidate_cnt - info1.invalidate_cnt));
+#endif
+    return true;
+}
+
+#endif /*LV_USE_LABEL*/
+
+#define TEST_TIMER_CNT  40
+
+static uint32_t timer_run_cnt[TEST_TIMER_CNT];
+static uint32_t timer_del_cnt;
+
+static void test_timer_cb(lv_timer_t * timer)
+{
+    timer_run_cnt[(uintptr_t)timer->user_data]++;
+}
+
+static void test_timer_del_cb(lv_timer_t * timer)
+{
+    timer_del_cnt++;
+    lv_timer_del(timer);
+}
+
+/**
+ * The timers must run with their periods, paused timers must not run and resuming must put them back.
+ * Also time `lv_timer_handler` with many timers waiting.
+ */
+static bool test_timer(void)
+{
+    lv_timer_t * timers[TEST_TIMER_CNT];
+    uint32_t i;
+    for(i = 0; i < TEST_TIMER_CNT; i++) {
+        timer_run_cnt[i] = 0;
+        timers[i] = lv_timer_create(test_timer_cb, 20 + (i % 8) * 10, (void *)(uintptr_t)i);
+        CHECK(timers[i] != NULL);
+    }
+    for(i = 0; i < 5; i++) lv_timer_create(test_timer_del_cb, 30, NULL);
+    timer_del_cnt = 0;
+
+    /*Pause every 3rd timer*/
+    for(i = 0; i < TEST_TIMER_CNT; i += 3) lv_timer_pause(timers[i]);
+
+    /*The tick might lag behind the real time if `usleep` oversleeps*/
+    uint32_t start = lv_tick_get();
+    wait_ms(400);
+    uint32_t duration = lv_tick_elaps(start);
+    CHECK(timer_del_cnt == 5);
+    for(i = 0; i < TEST_TIMER_CNT; i++) {
+        uint32_t expected = duration / timers[i]->period;
+        if(i % 3 == 0) CHECK(timer_run_cnt[i] == 0);
+        else CHECK(timer_run_cnt[i] + 2 >= expected && timer_run_cnt[i] <= expected + 1);
+    }
+
+    for(i = 0; i < TEST_TIMER_CNT; i += 3) lv_timer_resume(timers[i]);
+    wait_ms(100);
+    for(i = 0; i < TEST_TIMER_CNT; i += 3) CHECK(timer_run_cnt[i] > 0);
+
+    for(i = 0; i < TEST_TIMER_CNT; i++) lv_timer_del(timers[i]);
+
+    /*Many timers but none of them is due*/
+    lv_timer_t * many[500];
+    for(i = 0; i < 500; i++) {
+        many[i] = lv_timer_create(test_timer_cb, 100000, (void *)(uintptr_t)0);
+        CHECK(many[i] != NULL);
+    }
+    uint32_t calls = 10000;
+    double t = now_ms();
+    for(i = 0; i < calls; i++) lv_timer_handler();
+    printf("  lv_timer_handler with 500 waiting timers: %.2f us/call\n", (now_ms() - t) * 1000 / calls);
+    for(i = 0; i < 500; i++) lv_timer_del(many[i]);
+
+    return true;
+}
+
+#if LV_USE_FLEX
+
+/**
+ * Run the timers until the next frame is flushed
+ */
+static void wait_flush(void)
+{
+    flush_cnt = 0;
+    while(flush_cnt == 0) {
+        usleep(1000);
+#if LV_TICK_CUSTOM == 0
+        lv_tick_inc(1);
+#endif
+        lv_timer_handler();
+    }
+}
+
+/**
+ * The refresh timer must be paused right after the frame which drew everything,
+ * also if the layout update of that frame invalidated areas, and resumed by the next invalidation.
+ * A shown monitor keeps it running to update itself.
+ */
+static bool test_refr_idle(void)
+{
+    monitors_show(false);
+    lv_obj_t * scr = scr_new();
+    lv_obj_t * cont = lv_obj_create(scr);
+    lv_obj_set_size(cont, 300, 100);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    uint32_t i;
+    for(i = 0; i < 6; i++) lv_obj_set_size(lv_obj_create(cont), 60, 30);
+
+    wait_flush();
+    CHECK(disp->refr_timer->paused);
+
+    /*The children are moved by the layout update of the refresh*/
+    lv_obj_set_width(cont, 200);
+    CHECK(!disp->refr_timer->paused);
+    wait_flush();
+    CHECK(disp->refr_timer->paused);
+    CHECK(disp->inv_p == 0);
+
+    lv_obj_invalidate(cont);
+    CHECK(!disp->refr_timer->paused);
+    wait_flush();
+    CHECK(disp->refr_timer->paused);
+
+#if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
+    monitors_show(true);
+    wait_flush();
+    CHECK(!disp->refr_timer->paused);
+    wait_ms(100);
+    CHECK(!disp->refr_timer->paused);
+#endif
+
+    return true;
+}
+
+/**
+ * Update the layouts of the active screen
+ * @return number of layout runs
+ */
+static uint32_t layout_runs(void)
+{
+    lv_obj_layout_info_t info;
+    lv_obj_get_layout_info(&info);
+    uint32_t cnt = info.update_cnt;
+    lv_obj_update_layout(lv_scr_act());
+    lv_obj_get_layout_info(&info);
+    return info.update_cnt - cnt;
+}
+
+/**
+ * A flex container must be laid out again if a child changes or if it's explicitly marked dirty,
+ * but with `LV_USE_LAYOUT_CACHE` not if it's only notified about a change which doesn't affect the layout.
+ */
+static bool test_layout(void)
+{
+    lv_obj_t * scr = scr_new();
+    lv_obj_t * cont = lv_obj_create(scr);
+    lv_obj_set_size(cont, 300, 200);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    uint32_t i;
+    for(i = 0; i < 10; i++) lv_obj_set_size(lv_obj_create(cont), 60, 30);
+    lv_obj_t * first = lv_obj_get_child(cont, 0);
+    lv_obj_t * second = lv_obj_get_child(cont, 1);
+    lv_obj_update_layout(scr);
+
+    /*A child is resized: the next one is moved*/
+    lv_coord_t x = lv_obj_get_x(second);
+    lv_obj_set_width(first, 100);
+    CHECK(layout_runs() >= 1);
+    CHECK(lv_obj_get_x(second) == x + 40);
+
+    /*A child is hidden: the next one takes its place*/
+    x = lv_obj_get_x(first);
+    lv_obj_add_flag(first, LV_OBJ_FLAG_HIDDEN);
+    CHECK(layout_runs() >= 1);
+    CHECK(lv_obj_get_x(second) == x);
+    lv_obj_clear_flag(first, LV_OBJ_FLAG_HIDDEN);
+    CHECK(layout_runs() >= 1);
+
+    /*Explicitly marked dirty: laid out although nothing changed*/
+    lv_obj_mark_layout_as_dirty(cont);
+    CHECK(layout_runs() == 1);
+
+#if LV_USE_LAYOUT_CACHE
+    /*Notified about a child which didn't change*/
+    lv_obj_layout_info_t info;
+    lv_obj_get_layout_info(&info);
+    uint32_t skip_cnt = info.skip_cnt;
+    lv_event_send(cont, LV_EVENT_CHILD_CHANGED, first);
+    CHECK(layout_runs() == 0);
+    lv_obj_get_layout_info(&info);
+    CHECK(info.skip_cnt == skip_cnt + 1);
+#endif
+
+    return true;
+}
+
+#endif /*LV_USE_FLEX*/
+
+#if LV_MEM_CUSTOM == 0
+
+static uint32_t mem_cur_used(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.cur_used;
+}
+
+/**
+ * The used size must be the same after freeing everything, whichever allocator served the blocks,
+ * and reallocating must keep the content.
+ */
+static bool test_mem(void)
+{
+    static void * blocks[2000];
+    uint32_t used_start = mem_cur_used();
+    uint32_t i;
+
+#if LV_USE_MEM_SLAB
+    /*17 bytes are served from the 32 bytes class*/
+    for(i = 0; i < 100; i++) blocks[i] = lv_mem_alloc(17);
+    CHECK(mem_cur_used() == used_start + 100 * 32);
+    for(i = 0; i < 100; i++) lv_mem_free(blocks[i]);
+    CHECK(mem_cur_used() == used_start);
+#endif
+
+    /*Mixed sizes from the slab region and TLSF, freed in a different order*/
+    for(i = 0; i < 2000; i++) {
+        blocks[i] = lv_mem_alloc(1 + (i * 37) % 3000);
+        CHECK(blocks[i] != NULL);
+    }
+    for(i = 0; i < 2000; i += 2) lv_mem_free(blocks[i]);
+    for(i = 1; i < 2000; i += 2) lv_mem_free(blocks[i]);
+    CHECK(mem_cur_used() == used_start);
+
+    /*Grow and shrink while keeping the content. Crosses the slab and TLSF sizes.*/
+    uint8_t * p = lv_mem_alloc(10);
+    for(i = 0; i < 10; i++) p[i] = i;
+    size_t sizes[] = {40, 200, 300, 5000, 100, 20};
+    for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        p = lv_mem_realloc(p, sizes[i]);
+        CHECK(p != NULL);
+        uint32_t j;
+        for(j = 0; j < 10; j++) CHECK(p[j] == j);
+    }
+    lv_mem_free(p);
+    CHECK(mem_cur_used() == used_start);
+
+#if LV_USE_MEM_ARENA
+    static const char owner[] = "arena";
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    uint32_t arena_alloc_start = mon.arena_alloc_cnt;
+
+    lv_mem_arena_begin(owner);
+    /*The last block grows in place, the others are moved*/
+    p = lv_mem_alloc(100);
+    for(i = 0; i < 100; i++) p[i] = i;
+    CHECK(lv_mem_realloc(p, 200) == p);
+    uint8_t * p2 = lv_mem_alloc(50);
+    uint8_t * p_moved = lv_mem_realloc(p, 300);
+    CHECK(p_moved != p);
+    for(i = 0; i < 100; i++) CHECK(p_moved[i] == i);
+    CHECK(lv_mem_realloc(p2, 40) == p2);
+    CHECK(lv_mem_realloc(p_moved, 500) == p_moved);
+
+    /*No owner: allocate from the heap. The shared styles never go to an arena.*/
+    lv_mem_arena_begin(NULL);
+    void * heap_p = lv_mem_alloc(32);
+    lv_mem_arena_end();
+    static const lv_style_const_prop_t shared_props[] = {
+        LV_STYLE_CONST_BG_OPA(LV_OPA_30),
+        LV_STYLE_CONST_RADIUS(13),
+        {.prop = LV_STYLE_PROP_INV}
+    };
+    CHECK(lv_style_get_shared(shared_props) != NULL);
+    lv_mem_arena_end();
+
+    lv_mem_monitor(&mon);
+    CHECK(mon.arena_alloc_cnt == arena_alloc_start + 3);
+
+    lv_mem_free(heap_p);
+    lv_mem_free(p_moved);
+    lv_mem_free(p2);
+    lv_mem_arena_release(owner);
+    lv_mem_monitor(&mon);
+    CHECK(mon.arena_chunk_cnt == 0);
+#endif
+
+    uint32_t rounds = 200;
+    double t = now_ms();
+    uint32_t r;
+    for(r = 0; r < rounds; r++) {
+        for(i = 0; i < 1000; i++) blocks[i] = lv_mem_alloc(8 + (i * 13) % 120);
+        for(i = 0; i < 1000; i++) lv_mem_free(blocks[i]);
+    }
+    printf("  small alloc + free: %.1f ns/pair\n", (now_ms() - t) * 1e6 / (rounds * 1000));
+
+    return true;
+}
+
+#endif /*LV_MEM_CUSTOM == 0*/
+
+#if LV_IMG_CACHE_DEF_SIZE
+
+/*The test decoder opens "T:<w>x<h>/<name>" paths as blank ARGB images.
+ *"T:<w>x<h>/mapped<name>" images (at most 32x32) aren't allocated, like images in a memory mapped file.*/
+static lv_img_decoder_t * test_dec;
+static uint8_t test_dec_mapped[32 * 32 * LV_IMG_PX_SIZE_ALPHA_BYTE];
+static uint32_t test_dec_open_cnt;
+static uint32_t test_dec_close_cnt;
+static uint32_t test_dec_delay_ms;     /*Slow down the opening*/
+#if LV_IMG_CACHE_ASYNC
+    static pthread_t test_dec_lvgl_thread;
+    static uint32_t test_dec_info_bg_cnt;  /*`info_cb` calls from other threads than LVGL's*/
+#endif
+
+static lv_res_t test_dec_parse(const void * src, lv_img_header_t * header)
+{
+    if(lv_img_src_get_type(src) != LV_IMG_SRC_FILE || strncmp(src, "T:", 2) != 0) return LV_RES_INV;
+
+    unsigned w, h;
+    if(sscanf((const char *)src + 2, "%ux%u", &w, &h) != 2) return LV_RES_INV;
+    header->always_zero = 0;
+    header->w = w;
+    header->h = h;
+    header->cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    return LV_RES_OK;
+}
+
+static lv_res_t test_dec_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(decoder);
+#if LV_IMG_CACHE_ASYNC
+    if(!pthread_equal(pthread_self(), test_dec_lvgl_thread)) {
+        __atomic_fetch_add(&test_dec_info_bg_cnt, 1, __ATOMIC_RELAXED);
+    }
+#endif
+    return test_dec_parse(src, header);
+}
+
+static lv_res_t test_dec_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    if(test_dec_parse(dsc->src, &dsc->header) != LV_RES_OK) return LV_RES_INV;
+    if(test_dec_delay_ms) usleep(test_dec_delay_ms * 1000);
+
+    uint32_t size = lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, dsc->header.cf);
+    if(strstr(dsc->src, "/mapped") && size <= sizeof(test_dec_mapped)) {
+        dsc->img_data = test_dec_mapped;
+        dsc->img_data_not_owned = 1;
+        __atomic_fetch_add(&test_dec_open_cnt, 1, __ATOMIC_RELAXED);
+        return LV_RES_OK;
+    }
+
+    uint8_t * data = lv_mem_alloc(size);
+    if(data == NULL) return LV_RES_INV;
+    lv_memset_00(data, size);
+    dsc->img_data = data;
+    __atomic_fetch_add(&test_dec_open_cnt, 1, __ATOMIC_RELAXED);
+    return LV_RES_OK;
+}
+
+static void test_dec_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    if(!dsc->img_data_not_owned) lv_mem_free((void *)dsc->img_data);
+    dsc->img_data = NULL;
+    __atomic_fetch_add(&test_dec_close_cnt, 1, __ATOMIC_RELAXED);
+}
+
+static void test_dec_init(void)
+{
+    if(test_dec) return;
+    test_dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(test_dec, test_dec_info);
+    lv_img_decoder_set_open_cb(test_dec, test_dec_open);
+    lv_img_decoder_set_close_cb(test_dec, test_dec_close);
+#if LV_IMG_CACHE_ASYNC
+    test_dec_lvgl_thread = pthread_self();
+#endif
+}
+
+static uint32_t test_dec_opened(void)
+{
+    return __atomic_load_n(&test_dec_open_cnt, __ATOMIC_RELAXED) - __atomic_load_n(&test_dec_close_cnt, __ATOMIC_RELAXED);
+}
+
+#if LV_IMG_CACHE_ASYNC
+/**
+ * Run the timers until no image is waiting for decoding or redrawing
+ * @return false on timeout
+ */
+static bool wait_decoded(void)
+{
+    lv_img_cache_stat_t stat;
+    double end = now_ms() + 2000;
+    do {
+        wait_ms(1);
+        lv_img_cache_get_stat(&stat);
+    } while(stat.pending_cnt && now_ms() < end);
+
+    return stat.pending_cnt == 0;
+}
+#endif
+
+/**
+ * The cache must keep to its memory budget, keep the often used and the pinned images
+ * and close everything it opened.
+ */
+static bool test_img_cache(void)
+{
+    test_dec_init();
+    lv_img_cache_invalidate_src(NULL);
+    uint32_t img_size = lv_img_buf_get_img_size(32, 32, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    lv_img_cache_set_max_size(10 * img_size);
+
+    char path[32];
+    uint32_t i;
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat);
+    uint32_t evict_start = stat.evict_cnt;
+
+    /*Keep a pinned and an often used image while many others pass through the cache*/
+    CHECK(lv_img_cache_pin("T:32x32/pinned") == LV_RES_OK);
+    for(i = 0; i < 100; i++) {
+        CHECK(_lv_img_cache_open("T:32x32/hot", lv_color_black(), 0) != NULL);
+        lv_snprintf(path, sizeof(path), "T:32x32/%u", (unsigned)i);
+        CHECK(_lv_img_cache_open(path, lv_color_black(), 0) != NULL);
+
+        lv_img_cache_get_stat(&stat);
+        CHECK(stat.used_size <= 10 * img_size);
+        CHECK(test_dec_opened() <= 11);   /*+1 for the uncached image*/
+    }
+    CHECK(stat.evict_cnt - evict_start >= 90);
+    CHECK(stat.used_size == stat.entry_cnt * img_size);
+
+    uint32_t open_cnt = test_dec_open_cnt;
+    CHECK(_lv_img_cache_open("T:32x32/pinned", lv_color_black(), 0) != NULL);
+    CHECK(_lv_img_cache_open("T:32x32/hot", lv_color_black(), 0) != NULL);
+    CHECK(test_dec_open_cnt == open_cnt);
+
+    /*Larger than the budget: opened but not cached*/
+    CHECK(_lv_img_cache_open("T:100x100/large", lv_color_black(), 0) != NULL);
+    lv_img_cache_get_stat(&stat);
+    CHECK(stat.used_size <= 10 * img_size);
+
+    /*A smaller budget evicts but keeps the pinned image*/
+    lv_img_cache_set_max_size(2 * img_size);
+    lv_img_cache_get_stat(&stat);
+    CHECK(stat.used_size <= 2 * img_size);
+    CHECK(stat.pinned_cnt == 1);
+
+    lv_img_cache_unpin("T:32x32/pinned");
+    lv_img_cache_set_max_size(LV_IMG_CACHE_MEM_SIZE);
+    lv_img_cache_invalidate_src(NULL);
+    CHECK(test_dec_opened() == 0);
+
+    /*Data not allocated by the decoder takes no room*/
+    CHECK(_lv_img_cache_open("T:32x32/mapped_0", lv_color_black(), 0) != NULL);
+    CHECK(_lv_img_cache_open("T:32x32/mapped_1", lv_color_black(), 0) != NULL);
+    lv_img_cache_get_stat(&stat);
+    CHECK(stat.entry_cnt == 2);
+    CHECK(stat.used_size == 0);
+    lv_img_cache_invalidate_src(NULL);
+    CHECK(test_dec_opened() == 0);
+
+    /*Hits with as many file paths as entries*/
+    uint32_t cnt = LV_IMG_CACHE_DEF_SIZE;
+    for(i = 0; i < cnt; i++) {
+        lv_snprintf(path, sizeof(path), "T:8x8/image_with_a_longer_name_%u", (unsigned)i);
+        _lv_img_cache_open(path, lv_color_black(), 0);
+    }
+    uint32_t rounds = 2000;
+    double t = now_ms();
+    uint32_t r;
+    for(r = 0; r < rounds; r++) {
+        for(i = 0; i < cnt; i++) {
+            lv_snprintf(path, sizeof(path), "T:8x8/image_with_a_longer_name_%u", (unsigned)i);
+            _lv_img_cache_open(path, lv_color_black(), 0);
+        }
+    }
+    printf("  hit with %u cached paths: %.0f ns (including snprintf)\n", (unsigned)cnt,
+           (now_ms() - t) * 1e6 / (rounds * cnt));
+    lv_img_cache_invalidate_src(NULL);
+    CHECK(test_dec_opened() == 0);
+
+    return true;
+}
+
+/**
+ * Prefetching must use only the free room of the cache, report the size it takes
+ * and give the image to the next draw without opening it again.
+ */
+static bool test_img_prefetch(void)
+{
+    test_dec_init();
+    lv_img_cache_invalidate_src(NULL);
+    uint32_t img_size = lv_img_buf_get_img_size(32, 32, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    lv_img_cache_set_max_size(3 * img_size);
+
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat);
+    uint32_t evict_cnt = stat.evict_cnt;
+    uint32_t open_cnt = test_dec_open_cnt;
+
+    uint32_t size;
+    CHECK(lv_img_cache_prefetch("T:32x32/p0", &size) == LV_RES_OK);
+    CHECK(size == img_size);
+    CHECK(test_dec_open_cnt == open_cnt + 1);
+
+    /*Already cached: takes no more room*/
+    CHECK(lv_img_cache_prefetch("T:32x32/p0", &size) == LV_RES_OK);
+    CHECK(size == 0);
+    CHECK(test_dec_open_cnt == open_cnt + 1);
+
+    /*Only the free room is used*/
+    CHECK(lv_img_cache_prefetch("T:32x32/p1", &size) == LV_RES_OK);
+    CHECK(lv_img_cache_prefetch("T:32x32/p2", NULL) == LV_RES_OK);
+    CHECK(lv_img_cache_prefetch("T:32x32/p3", &size) == LV_RES_INV);
+    CHECK(size == 0);
+    CHECK(lv_img_cache_prefetch("T:32x32/missing", NULL) == LV_RES_INV);
+    lv_img_cache_get_stat(&stat);
+    CHECK(stat.evict_cnt == evict_cnt);
+    CHECK(stat.entry_cnt == 3);
+
+    CHECK(_lv_img_cache_open("T:32x32/p1", lv_color_black(), 0) != NULL);
+    CHECK(test_dec_open_cnt == open_cnt + 3);
+    lv_img_cache_invalidate_src(NULL);
+
+#if LV_IMG_CACHE_ASYNC
+    /*Queued for the decoding thread: the room is reserved until it's cached*/
+    lv_img_decoder_set_async(test_dec, true);
+    test_dec_delay_ms = 20;
+    CHECK(lv_img_cache_prefetch("T:32x32/q0", &size) == LV_RES_OK);
+    CHECK(size == img_size);
+    CHECK(lv_img_cache_prefetch("T:32x32/q0", &size) == LV_RES_OK);
+    CHECK(size == 0);
+    CHECK(lv_img_cache_prefetch("T:32x32/q1", NULL) == LV_RES_OK);
+    CHECK(lv_img_cache_prefetch("T:32x32/q2", NULL) == LV_RES_OK);
+    CHECK(lv_img_cache_prefetch("T:32x32/q3", &size) == LV_RES_INV);
+    CHECK(size == 0);
+    CHECK(wait_decoded());
+    wait_ms(50);    /*Let the job timer add them to the cache*/
+    lv_img_cache_get_stat(&stat);
+    CHECK(stat.entry_cnt == 3);
+    CHECK(stat.evict_cnt == evict_cnt);
+
+    /*Canceled before decoding: never opened*/
+    lv_img_cache_invalidate_src(NULL);
+    open_cnt = test_dec_open_cnt;
+    CHECK(lv_img_cache_prefetch("T:32x32/c0", NULL) == LV_RES_OK);
+    CHECK(lv_img_cache_prefetch("T:32x32/c1", NULL) == LV_RES_OK);
+    CHECK(lv_img_cache_prefetch("T:32x32/c2", NULL) == LV_RES_OK);
+    lv_img_cache_prefetch_cancel();
+    CHECK(wait_decoded());
+    CHECK(test_dec_open_cnt - open_cnt <= 1);     /*The one being decoded is finished*/
+
+    test_dec_delay_ms = 0;
+    lv_img_decoder_set_async(test_dec, false);
+#endif
+
+    lv_img_cache_set_max_size(LV_IMG_CACHE_MEM_SIZE);
+    lv_img_cache_invalidate_src(NULL);
+    CHECK(test_dec_opened() == 0);
+
+    return true;
+}
+
+#if LV_IMG_CACHE_ASYNC && LV_USE_IMG
+
+/**
+ * An async decoder's image must be decoded on the background thread which calls only its `open_cb`,
+ * then be redrawn from the cache. Removing a display with queued images must be safe.
+ */
+static bool test_img_async(void)
+{
+    test_dec_init();
+    lv_img_decoder_set_async(test_dec, true);
+    lv_img_cache_invalidate_src(NULL);
+    test_dec_info_bg_cnt = 0;
+    test_dec_delay_ms = 50;
+
+    lv_obj_t * scr = scr_new();
+    lv_obj_t * img = lv_img_create(scr);
+    lv_img_set_src(img, "T:64x64/async");
+
+    /*Nothing is drawn until it's decoded*/
+    uint32_t open_cnt = test_dec_open_cnt;
+    lv_refr_now(disp);
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat);
+    CHECK(stat.pending_cnt == 1);
+
+    CHECK(wait_decoded());
+    CHECK(test_dec_open_cnt == open_cnt + 1);
+    lv_img_cache_get_stat(&stat);
+    uint32_t hit_cnt = stat.hit_cnt;
+    CHECK(_lv_img_cache_open("T:64x64/async", lv_color_black(), 0) != NULL);
+    lv_img_cache_get_stat(&stat);
+    CHECK(stat.hit_cnt == hit_cnt + 1);
+    CHECK(test_dec_open_cnt == open_cnt + 1);
+    CHECK(test_dec_info_bg_cnt == 0);
+
+    /*Remove a display while its image is being decoded*/
+    static lv_color_t disp2_buf[100 * 100];
+    static lv_disp_draw_buf_t disp2_draw_buf;
+    lv_disp_draw_buf_init(&disp2_draw_buf, disp2_buf, NULL, 100 * 100);
+    static lv_disp_drv_t disp2_drv;
+    lv_disp_drv_init(&disp2_drv);
+    disp2_drv.draw_buf = &disp2_draw_buf;
+    disp2_drv.flush_cb = flush_cb;
+    disp2_drv.hor_res = 100;
+    disp2_drv.ver_res = 100;
+    lv_disp_t * disp2 = lv_disp_drv_register(&disp2_drv);
+    CHECK(disp2 != NULL);
+    lv_img_set_src(lv_img_create(lv_disp_get_scr_act(disp2)), "T:64x64/removed");
+    lv_refr_now(disp2);
+    lv_disp_remove(disp2);
+    lv_disp_set_default(disp);
+    CHECK(wait_decoded());
+
+    test_dec_delay_ms = 0;
+    lv_img_decoder_set_async(test_dec, false);
+    lv_img_cache_invalidate_src(NULL);
+    CHECK(test_dec_opened() == 0);
+    CHECK(test_dec_info_bg_cnt == 0);
+
+    return true;
+}
+
+#endif /*LV_IMG_CACHE_ASYNC && LV_USE_IMG*/
+
+#endif /*LV_IMG_CACHE_DEF_SIZE*/
+
+#if LV_IMG_TRANSFORM_CACHE_SIZE && LV_USE_IMG
+
+#define HAND_W      32
+#define HAND_H      240
+
+static uint8_t hour_map[HAND_W * HAND_H * LV_IMG_PX_SIZE_ALPHA_BYTE];
+static uint8_t sec_map[HAND_W * HAND_H * LV_IMG_PX_SIZE_ALPHA_BYTE];
+
+/**
+ * Create a clock hand like image: an opaque bar with anti-aliased, semi-transparent edges
+ */
+static lv_obj_t * hand_create(lv_obj_t * parent, lv_img_dsc_t * dsc, uint8_t * map, lv_color_t color)
+{
+    uint32_t i;
+    for(i = 0; i < HAND_W * HAND_H; i++) {
+        lv_coord_t x = i % HAND_W;
+        uint8_t * p = &map[i * LV_IMG_PX_SIZE_ALPHA_BYTE];
+        lv_memcpy(p, &color, sizeof(lv_color_t));
+        p[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = x == 0 || x == HAND_W - 1 ? LV_OPA_50 : LV_OPA_COVER;
+    }
+
+    lv_memset_00(dsc, sizeof(lv_img_dsc_t));
+    dsc->header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    dsc->header.w = HAND_W;
+    dsc->header.h = HAND_H;
+    dsc->data_size = sizeof(hour_map);
+    dsc->data = map;
+
+    lv_obj_t * img = lv_img_create(parent);
+    lv_img_set_src(img, dsc);
+    lv_img_set_pivot(img, HAND_W / 2, HAND_H - HAND_W / 2);
+    lv_obj_align(img, LV_ALIGN_CENTER, 0, -HAND_H / 2 + HAND_W / 2);
+    lv_img_set_transform_cache(img, true);
+    return img;
+}
+
+/**
+ * Tick a second hand over a still hour hand for `frames` seconds
+ * @return average time of a frame in ms
+ */
+static double clock_frames(lv_obj_t * sec, uint32_t frames)
+{
+    double t = now_ms();
+    uint32_t f;
+    for(f = 0; f < frames; f++) {
+        lv_img_set_angle(sec, (f % 60) * 60);
+        lv_refr_now(disp);
+    }
+    return (now_ms() - t) / frames;
+}
+
+/**
+ * A clock: the still hour hand is drawn from the cache on every tick, while the 60 angles of the
+ * cycling second hand don't fit into the budget together with it, so the second hand must not
+ * be cached (it would evict every entry before reusing it).
+ * Also compare the timing with the cache disabled.
+ */
+static bool test_transform_cache(void)
+{
+    static lv_img_dsc_t hour_dsc;
+    static lv_img_dsc_t sec_dsc;
+
+    lv_obj_t * scr = scr_new();
+    lv_obj_t * hour = hand_create(scr, &hour_dsc, hour_map, lv_color_black());
+    lv_obj_t * sec = hand_create(scr, &sec_dsc, sec_map, lv_palette_main(LV_PALETTE_RED));
+    lv_img_set_angle(hour, 1300);
+    lv_img_set_angle(sec, 0);
+    _lv_draw_transform_cache_invalidate_src(NULL);
+
+    /*The cached result is the same as the transformed one, apart from rounding on the edges*/
+    render(1);
+    memcpy(fb_saved, fb, sizeof(fb));
+    lv_img_set_transform_cache(hour, false);
+    lv_img_set_transform_cache(sec, false);
+    render(1);
+    uint32_t i;
+    for(i = 0; i < HOR_RES * VER_RES; i++) {
+        CHECK(LV_ABS(fb[i].ch.red - fb_saved[i].ch.red) <= 2);
+        CHECK(LV_ABS(fb[i].ch.green - fb_saved[i].ch.green) <= 2);
+        CHECK(LV_ABS(fb[i].ch.blue - fb_saved[i].ch.blue) <= 2);
+    }
+    lv_img_set_transform_cache(hour, true);
+    lv_img_set_transform_cache(sec, true);
+
+    /*Enough full cycles to get past the first decision window of the second hand*/
+    const uint32_t frames = 60 * 5;
+    lv_draw_transform_cache_stat_t s1;
+    lv_draw_transform_cache_stat_t s2;
+    lv_draw_transform_cache_get_stat(&s1);
+    double t_cache = clock_frames(sec, frames);
+    lv_draw_transform_cache_get_stat(&s2);
+
+    uint32_t hit = s2.hit_cnt - s1.hit_cnt;
+    uint32_t miss = s2.miss_cnt - s1.miss_cnt;
+    uint32_t bypass = s2.bypass_cnt - s1.bypass_cnt;
+    printf("  hit: %u, miss: %u, bypass: %u, entries: %u, used: %u bytes\n",
+           (unsigned)hit, (unsigned)miss, (unsigned)bypass, (unsigned)s2.entry_cnt, (unsigned)s2.used_size);
+
+    /*The hour hand hits on every tick*/
+    CHECK(hit >= frames);
+    CHECK(hit * 100 / (hit + miss) >= 80);
+    /*The second hand stops being cached after its first window*/
+    CHECK(miss < frames / 4);
+    CHECK(bypass > frames / 2);
+    CHECK(s2.used_size <= LV_IMG_TRANSFORM_CACHE_SIZE);
+
+    /*A stopped second hand is cached again*/
+    lv_img_set_angle(sec, 450);
+    render(64);
+    lv_draw_transform_cache_get_stat(&s1);
+    render(1);
+    lv_draw_transform_cache_get_stat(&s2);
+    CHECK(s2.hit_cnt - s1.hit_cnt == 2);
+    CHECK(s2.bypass_cnt == s1.bypass_cnt);
+
+    lv_img_set_transform_cache(hour, false);
+    lv_img_set_transform_cache(sec, false);
+    double t_plain = clock_frames(sec, frames);
+    printf("  clock tick: %.3f ms cached, %.3f ms not cached\n", t_cache, t_plain);
+
+    _lv_draw_transform_cache_invalidate_src(NULL);
+    return true;
+}
+
+#endif /*LV_IMG_TRANSFORM_CACHE_SIZE && LV_USE_IMG*/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char * argv[])
+{
+    lv_init();
+    disp_init();
+
+    int fail = 0;
+    size_t i;
+    for(i = 0; i < sizeof(sections) / sizeof(sections[0]); i++) {
+        if(argc > 1) {
+            int a;
+            for(a = 1; a < argc; a++) {
+                if(strcmp(argv[a], sections[i].name) == 0) break;
+            }
+            if(a == argc) continue;
+        }
+
+        printf("%s\n", sections[i].name);
+        if(!sections[i].run()) {
+            printf("%s: FAILED\n", sections[i].name);
+            fail = 1;
+        }
+    }
+
+    return fail;
+}
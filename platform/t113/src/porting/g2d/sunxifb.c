@@ -453,6 +453,86 @@ void sunxifb_flush(lv_disp_drv_t *drv, const lv_area_t *area,
     lv_disp_flush_ready(drv);
 }
 
+bool sunxifb_copy(lv_disp_drv_t *drv, const lv_area_t *area, lv_coord_t dx,
+        lv_coord_t dy) {
+    LV_UNUSED(drv);
+
+    /*Move the pixels in the image `sunxifb_flush` draws into and keeps between the frames:
+     *the not rotated image which is blitted to the screen with rotation (rotatefbp),
+     *or the back buffer which is synced with the front buffer after each frame*/
+    char *buf = fbp;
+#if defined(USE_SUNXIFB_DOUBLE_BUFFER) && defined(USE_SUNXIFB_G2D) && defined(USE_SUNXIFB_G2D_ROTATE)
+    if (sinfo.fbnum > 1) {
+        if (sinfo.rotatefbp == NULL)
+            return false;
+        buf = sinfo.rotatefbp;
+    }
+#endif /* USE_SUNXIFB_DOUBLE_BUFFER && USE_SUNXIFB_G2D && USE_SUNXIFB_G2D_ROTATE */
+
+    if (buf == NULL)
+        return false;
+
+    /*The same pixel size as in `sunxifb_flush`*/
+    uint32_t px_size;
+    if (vinfo.bits_per_pixel == 32 || vinfo.bits_per_pixel == 24)
+        px_size = 4;
+    else if (vinfo.bits_per_pixel == 16)
+        px_size = 2;
+    else if (vinfo.bits_per_pixel == 8)
+        px_size = 1;
+    else
+        return false;
+
+    /*Truncate the area to the screen*/
+    lv_area_t scr_area;
+    lv_area_t fb_area = { 0, 0, (lv_coord_t) fbp_w - 1, (lv_coord_t) fbp_h - 1 };
+    if (!_lv_area_intersect(&scr_area, area, &fb_area))
+        return true;
+
+    /*The pixels which remain visible after moving them by dx, dy*/
+    lv_area_t dest_area = scr_area;
+    lv_area_move(&dest_area, dx, dy);
+    if (!_lv_area_intersect(&dest_area, &dest_area, &scr_area))
+        return true;
+
+    long int line_length;
+    int32_t ofs_x = 0;
+    int32_t ofs_y = 0;
+#ifdef USE_SUNXIFB_DOUBLE_BUFFER
+    if (sinfo.fbnum > 1)
+        line_length = fbp_line_length;
+    else
+#endif /* USE_SUNXIFB_DOUBLE_BUFFER */
+    {
+        line_length = finfo.line_length;
+        ofs_x = vinfo.xoffset;
+        ofs_y = vinfo.yoffset;
+    }
+
+    size_t row_size = lv_area_get_width(&dest_area) * px_size;
+    int32_t h = lv_area_get_height(&dest_area);
+    char *dest = buf + (dest_area.y1 + ofs_y) * line_length
+            + (dest_area.x1 + ofs_x) * px_size;
+    char *src = dest - dy * line_length - dx * px_size;
+
+    /*Copy the rows from the bottom if the content moves down to not overwrite the source*/
+    long int step = line_length;
+    if (dy > 0) {
+        dest += (h - 1) * line_length;
+        src += (h - 1) * line_length;
+        step = -line_length;
+    }
+
+    int32_t y;
+    for (y = 0; y < h; y++) {
+        memmove(dest, src, row_size);
+        dest += step;
+        src += step;
+    }
+
+    return true;
+}
+
 void sunxifb_get_sizes(uint32_t *width, uint32_t *height) {
     if (width)
         *width = vinfo.xres;
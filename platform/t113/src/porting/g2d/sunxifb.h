@@ -43,6 +43,7 @@ extern "C" {
 void sunxifb_init(uint32_t rotated);
 void sunxifb_exit(void);
 void sunxifb_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+bool sunxifb_copy(lv_disp_drv_t * drv, const lv_area_t * area, lv_coord_t dx, lv_coord_t dy);
 void sunxifb_get_sizes(uint32_t *width, uint32_t *height);
 void* sunxifb_alloc(size_t size, char *label);
 void sunxifb_free(void **data, char *label);
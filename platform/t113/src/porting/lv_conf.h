@@ -59,6 +59,18 @@
         #undef LV_MEM_POOL_ALLOC
     #endif
 
+    /*1: Serve the small allocations (up to 256 bytes) from size-class slabs in a dedicated region of the pool.
+     *It's faster than TLSF and keeps the small objects from fragmenting the rest of the pool.*/
+    #define LV_USE_MEM_SLAB 1
+    #if LV_USE_MEM_SLAB
+        /*Size of the slab region in bytes. The small allocations fall back to TLSF if it's full.*/
+        #define LV_MEM_SLAB_SIZE (2 * 1024U * 1024U)          /*[bytes]*/
+    #endif
+
+    /*1: Enable `lv_mem_arena_begin/end()` to allocate the objects of a screen from 16 kB chunks by bumping a pointer.
+     *A chunk is given back at once when all its blocks are freed.*/
+    #define LV_USE_MEM_ARENA 1
+
 #else       /*LV_MEM_CUSTOM*/
     #define LV_MEM_CUSTOM_INCLUDE <stdlib.h>   /*Header for the dynamic memory function*/
     #define LV_MEM_CUSTOM_ALLOC   malloc
@@ -70,9 +82,28 @@
  *You will see an error log message if there wasn't enough buffers. */
 #define LV_MEM_BUF_MAX_NUM 16
 
+/*1: Serve `lv_mem_buf_get()` from a LIFO stack of the calling thread instead of searching `LV_MEM_BUF_MAX_NUM` buffers.
+ *The buffers are aligned to 16 bytes. The ones not fitting into the stack are allocated from the heap.*/
+#define LV_USE_MEM_BUF_STACK 1
+#if LV_USE_MEM_BUF_STACK
+    /*Size of the stack of a thread in bytes*/
+    #define LV_MEM_BUF_STACK_SIZE (64U * 1024U)
+    /*Max. number of threads having an own stack. More than 1 makes sense only if `LV_ATTRIBUTE_THREAD_LOCAL` is set.*/
+    #define LV_MEM_BUF_STACK_CNT 4
+#endif
+
 /*Use the standard `memcpy` and `memset` instead of LVGL's own functions. (Might or might not be faster).*/
 #define LV_MEMCPY_MEMSET_STD 0
 
+/*1: Use NEON or SSE2 in `lv_memcpy` and `lv_memset` if the CPU supports it (checked at run time).
+ *Has effect only if `LV_MEMCPY_MEMSET_STD == 0`*/
+#define LV_USE_MEMCPY_SIMD 1
+#if LV_USE_MEMCPY_SIMD
+    /*Copy and set at least this many bytes with non-temporal stores to not flush the caches
+     *(e.g. copying a whole frame buffer). Used only if the CPU has such stores.*/
+    #define LV_MEMCPY_SIMD_NT_SIZE (128 * 1024)
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -80,6 +111,11 @@
 /*Default display refresh period. LVG will redraw changed areas with this period time*/
 #define LV_DISP_DEF_REFR_PERIOD 17      /*[ms]*/
 
+/*Extra cost of refreshing an area separately instead of joining it with an other one, in pixels.
+ *Two invalid areas are joined if the joined area is smaller than their sum plus this value.
+ *If there is no place for a new area the cheapest join is done instead of redrawing the whole screen.*/
+#define LV_DISP_INV_AREA_COST 2048
+
 /*Input device read period in milliseconds*/
 #define LV_INDEV_DEF_READ_PERIOD 17     /*[ms]*/
 
@@ -118,6 +154,13 @@
     * radius * 4 bytes are used per circle (the most often used radiuses are saved)
     * 0: to disable caching */
     #define LV_CIRCLE_CACHE_SIZE 4
+
+    /* Set number of maximally cached arc rings.
+    * The anti-aliased coverage of 1/4 ring is saved per (radius, width) so that redrawing an arc
+    * applies only the angle mask.
+    * radius * radius bytes are used per ring (the most often used rings are saved)
+    * 0: to disable caching */
+    #define LV_ARC_RING_CACHE_SIZE 8
 #endif /*LV_DRAW_COMPLEX*/
 
 /**
@@ -143,6 +186,22 @@
  *0: to disable caching*/
 #define LV_IMG_CACHE_DEF_SIZE 32
 
+/*Memory budget of the image cache in bytes (decoded data of the cached images).
+ *The least recently used images are closed when a new one would exceed it.
+ *0: only LV_IMG_CACHE_DEF_SIZE limits the cache*/
+#define LV_IMG_CACHE_MEM_SIZE (8 * 1024 * 1024)
+
+/*1: Decode PNG files on a background thread instead of in the draw call.
+ *Nothing is drawn in place of the image until it's ready. Requires pthread.*/
+#define LV_IMG_CACHE_ASYNC 1
+
+/*Memory budget of the image transformation cache in bytes.
+ *Images enabled with `lv_img_set_transform_cache()` keep their rotated/zoomed result
+ *so that repeated angles (e.g. clock hands) are blitted instead of transformed again.
+ *Images whose transformations are rarely reused are transformed in place instead.
+ *0: to disable caching*/
+#define LV_IMG_TRANSFORM_CACHE_SIZE (4 * 1024 * 1024)
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS 2
@@ -169,6 +228,17 @@
  *Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF (10*1024)
 
+/*1: Split large software blend operations (fills and image copies) into horizontal bands
+ *and blend them on a pool of worker threads. Requires pthread.*/
+#define LV_USE_PARALLEL_RENDER 1
+#if LV_USE_PARALLEL_RENDER
+    /*Number of threads blending together, including the rendering thread*/
+    #define LV_PARALLEL_RENDER_THREADS 2
+
+    /*Smaller areas are blended on the rendering thread as waking up the workers costs more than it saves [px]*/
+    #define LV_PARALLEL_RENDER_MIN_PX (16 * 1024)
+#endif
+
 /*-------------
  * GPU
  *-----------*/
@@ -283,6 +353,33 @@
 /*1: Draw random colored rectangles over the redrawn areas*/
 #define LV_USE_REFR_DEBUG 0
 
+/*1: Skip drawing the parts of widgets which are covered by opaque siblings or children drawn later.
+ *The saving can be read with `lv_refr_get_overdraw()`*/
+#define LV_USE_REFR_OCCLUSION 1
+
+/*1: Cache the style property values read by `lv_obj_get_style_prop` per object, part and state.
+ *The cache is dropped when any style, object state or parent changes.*/
+#define LV_USE_STYLE_CACHE 1
+#if LV_USE_STYLE_CACHE
+    /*Number of cached values. Must be a power of 2*/
+    #define LV_STYLE_CACHE_SIZE 512
+#endif
+
+/*1: Remember the state of the children after a flex/grid layout run and skip the next run of
+ *the container if its size and its children's position, size and flags haven't changed since.
+ *The state is stored per container, it takes a pointer, the flags and 4 coordinates per child.
+ *`lv_obj_mark_layout_as_dirty()` always runs the layout.*/
+#define LV_USE_LAYOUT_CACHE 1
+
+/*1: Step the animations in batches: evaluate all the animations first, then apply the values
+ *while refreshing the style of each animated object only once, and run the step right before
+ *the display refresh to show the new values in the same frame.*/
+#define LV_USE_ANIM_BATCH 1
+#if LV_USE_ANIM_BATCH
+    /*Max. number of objects whose style refresh can be coalesced in one step. The others are refreshed immediately*/
+    #define LV_ANIM_BATCH_OBJ_MAX 32
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #define LV_SPRINTF_CUSTOM 0
 #if LV_SPRINTF_CUSTOM
@@ -337,6 +434,10 @@
 /*Prefix variables that are used in GPU accelerated operations, often these need to be placed in RAM sections that are DMA accessible*/
 #define LV_ATTRIBUTE_DMA
 
+/*Prefix variables having a separate instance in each thread. E.g. `__thread` or `_Thread_local`.
+ *Leave empty if LVGL is used from one thread only.*/
+#define LV_ATTRIBUTE_THREAD_LOCAL __thread
+
 /*Export integer constant to binding. This macro is used with constants in the form of LV_<CONST> that
  *should also appear on LVGL binding API such as Micropython.*/
 #define LV_EXPORT_CONST_INT(int_value) struct _silence_gcc_warning /*The default value just prevents GCC warning*/
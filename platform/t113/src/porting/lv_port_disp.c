@@ -66,6 +66,7 @@ void lv_port_disp_init(bool is_disp_orientation)
     lv_disp_drv_init(&disp_drv);
     disp_drv.draw_buf = &draw_buf_dsc;
 	disp_drv.flush_cb = sunxifb_flush;
+	disp_drv.copy_cb = sunxifb_copy;
 	disp_drv.hor_res = width;
     disp_drv.ver_res = height;
 	disp_drv.rotated = rotated;
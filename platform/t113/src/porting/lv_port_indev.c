@@ -89,3 +89,9 @@ void lv_port_indev_init(void)
 void lv_port_indev_deinit(){
     lv_indev_delete(indev);
 }
+
+/*Return the touchscreen's evdev fd so the main loop can wait on it (-1 if not opened)*/
+int lv_port_indev_get_fd(void)
+{
+    return evdev_fd;
+}
@@ -12,6 +12,8 @@ void lv_port_indev_init(void);
 
 void lv_port_indev_deinit();
 
+int lv_port_indev_get_fd(void);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
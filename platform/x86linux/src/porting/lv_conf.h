@@ -103,6 +103,22 @@
  *0: to disable caching*/
 #define LV_IMG_CACHE_DEF_SIZE 0
 
+/*Memory budget of the image cache in bytes (decoded data of the cached images).
+ *The least recently used images are closed when a new one would exceed it.
+ *0: only LV_IMG_CACHE_DEF_SIZE limits the cache*/
+#define LV_IMG_CACHE_MEM_SIZE 0
+
+/*1: Decode PNG files on a background thread instead of in the draw call.
+ *Nothing is drawn in place of the image until it's ready. Requires pthread.*/
+#define LV_IMG_CACHE_ASYNC 0
+
+/*Memory budget of the image transformation cache in bytes.
+ *Images enabled with `lv_img_set_transform_cache()` keep their rotated/zoomed result
+ *so that repeated angles (e.g. clock hands) are blitted instead of transformed again.
+ *Images whose transformations are rarely reused are transformed in place instead.
+ *0: to disable caching*/
+#define LV_IMG_TRANSFORM_CACHE_SIZE 0
+
 #define LV_GRADIENT_MAX_STOPS 3
 
 /*Maximum buffer size to allocate for rotation. Only used if software rotation is enabled in the display driver.*/
@@ -30,6 +30,12 @@ void lv_port_indev_init(void){}
 
 void lv_port_indev_deinit(void){}
 
+/*SDL input is polled, there is no fd to wait on*/
+int lv_port_indev_get_fd(void)
+{
+  return -1;
+}
+
 void lv_port_disp_deinit(void){}
 
 void lv_port_disp_init(bool is_disp_orientation)